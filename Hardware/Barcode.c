@@ -0,0 +1,341 @@
+#include "Barcode.h"
+
+/*全局变量*********************/
+
+/**
+  * Code128符号0~105的条空图案，每个11个模块，最高位为第一个模块，1为条
+  * 103~105为起始符A/B/C
+  */
+static const uint16_t Barcode_Code128[106] = {
+	0x6CC, 0x66C, 0x666, 0x498, 0x48C, 0x44C, 0x4C8, 0x4C4,
+	0x464, 0x648, 0x644, 0x624, 0x59C, 0x4DC, 0x4CE, 0x5CC,
+	0x4EC, 0x4E6, 0x672, 0x65C, 0x64E, 0x6E4, 0x674, 0x76E,
+	0x74C, 0x72C, 0x726, 0x764, 0x734, 0x732, 0x6D8, 0x6C6,
+	0x636, 0x518, 0x458, 0x446, 0x588, 0x468, 0x462, 0x688,
+	0x628, 0x622, 0x5B8, 0x58E, 0x46E, 0x5D8, 0x5C6, 0x476,
+	0x776, 0x68E, 0x62E, 0x6E8, 0x6E2, 0x6EE, 0x758, 0x746,
+	0x716, 0x768, 0x762, 0x71A, 0x77A, 0x642, 0x78A, 0x530,
+	0x50C, 0x4B0, 0x486, 0x42C, 0x426, 0x590, 0x584, 0x4D0,
+	0x4C2, 0x434, 0x432, 0x612, 0x650, 0x7BA, 0x614, 0x47A,
+	0x53C, 0x4BC, 0x49E, 0x5E4, 0x4F4, 0x4F2, 0x7A4, 0x794,
+	0x792, 0x6DE, 0x6F6, 0x7B6, 0x578, 0x51E, 0x45E, 0x5E8,
+	0x5E2, 0x7A8, 0x7A2, 0x5DE, 0x5EE, 0x75E, 0x7AE, 0x684,
+	0x690, 0x69C};
+
+/*Code128终止符，13个模块*/
+#define BARCODE_CODE128_STOP	0x18EB
+
+/*Code128特殊符号值*/
+#define BARCODE_CODE_C			99		//切换到C字符集
+#define BARCODE_CODE_B			100		//A、C中切换到B字符集
+#define BARCODE_CODE_A			101		//B、C中切换到A字符集
+#define BARCODE_START_A			103
+
+/*EAN-13数字的L编码，7个模块，R编码为其取反，G编码为R编码左右颠倒*/
+static const uint8_t Barcode_EanL[10] = {
+	0x0D, 0x19, 0x13, 0x3D, 0x23, 0x31, 0x2F, 0x3B, 0x37, 0x0B};
+
+/*EAN-13左侧6位使用G编码的位置，由第1位数字决定，B5对应左侧第1位*/
+static const uint8_t Barcode_EanParity[10] = {
+	0x00, 0x0B, 0x0D, 0x0E, 0x13, 0x19, 0x1C, 0x15, 0x16, 0x1A};
+
+/*绘制状态，测量时Canvas为NULL*/
+static const Canvas_t *Barcode_Canvas;
+static int16_t Barcode_X;				//下一段条空的起始横坐标
+static int16_t Barcode_Y;
+static int16_t Barcode_Height;
+static uint8_t Barcode_Module;			//模块宽度（像素）
+static uint8_t Barcode_Color;			//当前段的颜色，1为条
+static uint16_t Barcode_Run;			//当前段已累计的模块数
+static uint16_t Barcode_Width;			//已输出的总模块数
+
+/*********************全局变量*/
+
+
+/*工具函数*********************/
+
+/*工具函数仅供内部部分函数使用*/
+
+/**
+  * 函    数：输出当前段，同色相邻模块合并为一段，整段一次填充
+  * 参    数：无
+  * 返 回 值：无
+  */
+static void Barcode_Flush(void)
+{
+	if (Barcode_Run && Barcode_Canvas)
+	{
+		Canvas_FillRect(Barcode_Canvas, Barcode_X, Barcode_Y, Barcode_Run * Barcode_Module, Barcode_Height, Barcode_Color);
+	}
+	Barcode_X += Barcode_Run * Barcode_Module;
+	Barcode_Run = 0;
+}
+
+/**
+  * 函    数：输出若干模块
+  * 参    数：Bits 模块图案，高位先输出，1为条，0为空
+  * 参    数：Count 模块数，范围：1~16
+  * 返 回 值：无
+  */
+static void Barcode_Put(uint16_t Bits, uint8_t Count)
+{
+	uint8_t Color;
+	
+	while (Count --)
+	{
+		Color = (Bits >> Count) & 0x01;
+		if (Color != Barcode_Color)
+		{
+			Barcode_Flush();
+			Barcode_Color = Color;
+		}
+		Barcode_Run ++;
+		Barcode_Width ++;
+	}
+}
+
+/**
+  * 函    数：输出空白区
+  * 参    数：Count 模块数
+  * 返 回 值：无
+  */
+static void Barcode_PutQuiet(uint8_t Count)
+{
+	while (Count --)
+	{
+		Barcode_Put(0, 1);
+	}
+}
+
+/**
+  * 函    数：统计字符串开头连续数字的个数
+  * 参    数：String 指定字符串
+  * 返 回 值：连续数字的个数
+  */
+static uint16_t Barcode_CountDigits(const char *String)
+{
+	uint16_t Count = 0;
+	
+	while (String[Count] >= '0' && String[Count] <= '9')
+	{
+		Count ++;
+	}
+	return Count;
+}
+
+/**
+  * 函    数：Code128编码并输出
+  * 参    数：Text 指定字符串，范围：ASCII码0~127，不含'\0'
+  * 返 回 值：1：成功，0：包含无法编码的字符
+  * 说    明：连续4个以上数字位于末尾或连续6个以上数字时切换到C字符集，每个符号编码2个数字
+  *           遇到控制字符时切换到A字符集，遇到小写字母时切换到B字符集
+  *           符号值随输出累加校验和，不需要缓冲区
+  */
+static uint8_t Barcode_EncodeCode128(const char *Text)
+{
+	const char *p;
+	uint32_t Sum;
+	uint16_t Weight = 1, Digits;
+	uint8_t Set, Value;
+	
+	for (p = Text; *p != '\0'; p ++)
+	{
+		if ((uint8_t)*p > 127) {return 0;}
+	}
+	
+	/*选择起始字符集*/
+	Digits = Barcode_CountDigits(Text);
+	if ((Digits >= 4 && Digits % 2 == 0) || (Digits >= 2 && Text[Digits] == '\0' && Digits % 2 == 0))
+	{
+		Set = 'C';
+	}
+	else
+	{
+		Set = ((uint8_t)Text[0] < 32) ? 'A' : 'B';
+	}
+	Value = BARCODE_START_A + Set - 'A';
+	Barcode_Put(Barcode_Code128[Value], 11);
+	Sum = Value;
+	
+	p = Text;
+	while (*p != '\0')
+	{
+		if (Set == 'C')
+		{
+			if (Barcode_CountDigits(p) >= 2)		//两个数字编为一个符号
+			{
+				Value = (p[0] - '0') * 10 + (p[1] - '0');
+				p += 2;
+			}
+			else									//数字不足两个，切换回A或B
+			{
+				Set = ((uint8_t)*p < 32) ? 'A' : 'B';
+				Value = (Set == 'A') ? BARCODE_CODE_A : BARCODE_CODE_B;
+			}
+		}
+		else
+		{
+			Digits = Barcode_CountDigits(p);
+			if ((Digits >= 4 && p[Digits] == '\0') || Digits >= 6)
+			{
+				if (Digits % 2)						//奇数个数字，先在当前字符集编一个
+				{
+					Value = *p - 32;
+					p ++;
+				}
+				else
+				{
+					Set = 'C';
+					Value = BARCODE_CODE_C;
+				}
+			}
+			else if (Set == 'B' && (uint8_t)*p < 32)
+			{
+				Set = 'A';
+				Value = BARCODE_CODE_A;
+			}
+			else if (Set == 'A' && (uint8_t)*p >= 96)
+			{
+				Set = 'B';
+				Value = BARCODE_CODE_B;
+			}
+			else
+			{
+				Value = ((uint8_t)*p < 32) ? *p + 64 : *p - 32;
+				p ++;
+			}
+		}
+		Barcode_Put(Barcode_Code128[Value], 11);
+		Sum += (uint32_t)Value * Weight;
+		Weight ++;
+	}
+	
+	Barcode_Put(Barcode_Code128[Sum % 103], 11);		//校验符
+	Barcode_Put(BARCODE_CODE128_STOP, 13);
+	return 1;
+}
+
+/**
+  * 函    数：EAN-13编码并输出
+  * 参    数：Text 指定12位或13位数字
+  * 返 回 值：1：成功，0：格式错误或校验位错误
+  */
+static uint8_t Barcode_EncodeEan13(const char *Text)
+{
+	uint8_t Digit[13], Length, Sum = 0, i, Code;
+	
+	Length = Barcode_CountDigits(Text);
+	if ((Length != 12 && Length != 13) || Text[Length] != '\0') {return 0;}
+	
+	/*校验位：奇数位权1，偶数位权3*/
+	for (i = 0; i < 12; i ++)
+	{
+		Digit[i] = Text[i] - '0';
+		Sum += Digit[i] * (i % 2 ? 3 : 1);
+	}
+	Digit[12] = (10 - Sum % 10) % 10;
+	if (Length == 13 && Text[12] - '0' != Digit[12]) {return 0;}
+	
+	Barcode_Put(0x05, 3);								//起始符101
+	for (i = 1; i <= 6; i ++)
+	{
+		Code = Barcode_EanL[Digit[i]];
+		if ((Barcode_EanParity[Digit[0]] >> (6 - i)) & 0x01)
+		{
+			/*G编码：L编码取反后左右颠倒*/
+			Code = ~Code & 0x7F;
+			Code = ((Code & 0x01) << 6) | ((Code & 0x02) << 4) | ((Code & 0x04) << 2) | (Code & 0x08)
+				 | ((Code & 0x10) >> 2) | ((Code & 0x20) >> 4) | ((Code & 0x40) >> 6);
+		}
+		Barcode_Put(Code, 7);
+	}
+	Barcode_Put(0x0A, 5);								//中间分隔符01010
+	for (i = 7; i <= 12; i ++)
+	{
+		Barcode_Put(~Barcode_EanL[Digit[i]] & 0x7F, 7);	//R编码
+	}
+	Barcode_Put(0x05, 3);								//终止符101
+	return 1;
+}
+
+/**
+  * 函    数：编码并输出完整的条码，含两侧空白区
+  * 参    数：Type 条码类型
+  * 参    数：Text 条码内容
+  * 返 回 值：条码总模块数，内容无效时返回0
+  */
+static uint16_t Barcode_Encode(uint8_t Type, const char *Text)
+{
+	uint8_t Result = 0;
+	
+	Barcode_Color = 0;
+	Barcode_Run = 0;
+	Barcode_Width = 0;
+	
+	if (Type == BARCODE_CODE128)
+	{
+		Barcode_PutQuiet(10);
+		Result = Barcode_EncodeCode128(Text);
+		Barcode_PutQuiet(10);
+	}
+	else if (Type == BARCODE_EAN13)
+	{
+		Barcode_PutQuiet(11);
+		Result = Barcode_EncodeEan13(Text);
+		Barcode_PutQuiet(7);
+	}
+	Barcode_Flush();
+	
+	return Result ? Barcode_Width : 0;
+}
+
+/*********************工具函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：测量条码的宽度
+  * 参    数：Type 条码类型，范围：BARCODE_CODE128或BARCODE_EAN13
+  * 参    数：Text 条码内容
+  * 参    数：Module 模块宽度（像素），范围：1~255
+  * 返 回 值：条码宽度（像素），含两侧空白区，内容无效时返回0
+  * 说    明：编码过程与Barcode_Draw完全相同，只是不写显存
+  */
+uint16_t Barcode_Measure(uint8_t Type, const char *Text, uint8_t Module)
+{
+	Barcode_Canvas = 0;
+	Barcode_Module = Module;
+	return Barcode_Encode(Type, Text) * Module;
+}
+
+/**
+  * 函    数：在画布上绘制条码
+  * 参    数：Canvas 指定画布，范围：&EPD_Canvas或&OLED_Canvas
+  * 参    数：X 指定条码左上角（含空白区）的横坐标，范围：-32768~32767
+  * 参    数：Y 指定条码左上角的纵坐标，范围：-32768~32767
+  * 参    数：Type 条码类型，范围：BARCODE_CODE128或BARCODE_EAN13
+  * 参    数：Text 条码内容
+  *           Code128：ASCII码0~127组成的字符串
+  *           EAN-13：12位数字（自动计算校验位）或13位数字（检查校验位）
+  * 参    数：Module 模块宽度（像素），范围：1~255，每个条空的宽度都是它的整数倍
+  * 参    数：Height 条的高度（像素）
+  * 返 回 值：条码宽度（像素），含两侧空白区，内容无效时返回0且不写显存
+  * 说    明：两侧空白区（Code128各10个模块，EAN-13左11右7个模块）会被清空
+  *           同色相邻模块合并为一段竖直条带，整段以Canvas_FillRect按页填充
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+uint16_t Barcode_Draw(const Canvas_t *Canvas, int16_t X, int16_t Y, uint8_t Type, const char *Text,
+					  uint8_t Module, int16_t Height)
+{
+	if (Barcode_Measure(Type, Text, Module) == 0) {return 0;}	//先检查内容，避免画出半个条码
+	
+	Barcode_Canvas = Canvas;
+	Barcode_X = X;
+	Barcode_Y = Y;
+	Barcode_Height = Height;
+	Barcode_Module = Module;
+	return Barcode_Encode(Type, Text) * Module;
+}
+
+/*********************功能函数*/
@@ -0,0 +1,24 @@
+#ifndef __BARCODE_H
+#define __BARCODE_H
+
+#include <stdint.h>
+#include "Canvas.h"
+
+/*参数宏定义*********************/
+
+/*Type参数取值*/
+#define BARCODE_CODE128			0		//Code128，自动切换A/B/C字符集
+#define BARCODE_EAN13			1		//EAN-13，12位数字自动计算校验位，或13位数字含校验位
+
+/*********************参数宏定义*/
+
+
+/*函数声明*********************/
+
+uint16_t Barcode_Measure(uint8_t Type, const char *Text, uint8_t Module);
+uint16_t Barcode_Draw(const Canvas_t *Canvas, int16_t X, int16_t Y, uint8_t Type, const char *Text,
+					  uint8_t Module, int16_t Height);
+
+/*********************函数声明*/
+
+#endif
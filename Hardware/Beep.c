@@ -1,31 +1,257 @@
 #include "stm32f10x.h"                  // Device header
+#include "Beep.h"
+#include "Power.h"
 
+/*全局变量*********************/
 
+const Beep_Note_t Beep_Click[] = {{4000, 8}, {0, 0}};
+const Beep_Note_t Beep_Alert[] = {{1568, 80}, {0, 20}, {2093, 80}, {0, 20}, {2637, 160}, {0, 0}};
+const Beep_Note_t Beep_Error[] = {{392, 150}, {0, 80}, {392, 300}, {0, 0}};
+
+/*旋律队列，Head只由主循环写，Tail只由SysTick中断写，打断播放时在关中断状态下同时修改*/
+static const Beep_Note_t *Beep_Queue[BEEP_QUEUE_SIZE];
+static volatile uint8_t Beep_Head;
+static volatile uint8_t Beep_Tail;
+
+/*正在播放的音符与其剩余时间，剩余时间为0表示空闲*/
+static const Beep_Note_t *Beep_Note;
+static volatile uint16_t Beep_Remain;
+
+/*********************全局变量*/
+
+
+/*引脚配置*********************/
+
+/**
+  * 函    数：设置PB8的模式
+  * 参    数：Timer 1：TIM4通道3复用推挽输出，0：开漏输出高电平（蜂鸣器不响，OLED可用）
+  * 返 回 值：无
+  */
+static void Beep_SetPin(uint8_t Timer)
+{
+	GPIO_InitTypeDef GPIO_InitStructure;
+	
+	GPIO_SetBits(GPIOB, GPIO_Pin_8);
+	GPIO_InitStructure.GPIO_Mode = Timer ? GPIO_Mode_AF_PP : GPIO_Mode_Out_OD;
+	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_8;
+	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+	GPIO_Init(GPIOB, &GPIO_InitStructure);
+}
+
+/**
+  * 函    数：通道3输出PWM
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：按CCR3输出PWM，同时退出Beep_ON/Beep_OFF设置的强制输出
+  */
+static void Beep_SetPWM(void)
+{
+	TIM_OCInitTypeDef TIM_OCInitStructure;
+	
+	TIM_OCStructInit(&TIM_OCInitStructure);
+	TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM1;
+	TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Enable;
+	TIM_OCInitStructure.TIM_OCPolarity = BEEP_ACTIVE_LOW ? TIM_OCPolarity_Low : TIM_OCPolarity_High;
+	TIM_OCInitStructure.TIM_Pulse = 0;
+	TIM_OC3Init(TIM4, &TIM_OCInitStructure);
+	TIM_OC3PreloadConfig(TIM4, TIM_OCPreload_Enable);
+}
+
+/**
+  * 函    数：蜂鸣器初始化
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：TIM4计数时钟分频为1MHz，ARR决定音调，CCR3为ARR的一半，即50%占空比
+  *           ARR与CCR3开启预装载，切换音符在下一个周期开始时生效，不产生毛刺
+  */
 void Beep_Init(void)
 {
-	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB,ENABLE);
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB, ENABLE);
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM4, ENABLE);
+	
+	Beep_SetPin(0);
+	
+	TIM_TimeBaseInitTypeDef TIM_TimeBaseInitStructure;
+	TIM_TimeBaseInitStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+	TIM_TimeBaseInitStructure.TIM_CounterMode = TIM_CounterMode_Up;
+	TIM_TimeBaseInitStructure.TIM_Period = 1000 - 1;					//ARR
+	TIM_TimeBaseInitStructure.TIM_Prescaler = SystemCoreClock / 1000000 - 1;	//PSC
+	TIM_TimeBaseInitStructure.TIM_RepetitionCounter = 0;
+	TIM_TimeBaseInit(TIM4, &TIM_TimeBaseInitStructure);
+	TIM_ARRPreloadConfig(TIM4, ENABLE);
+	
+	Beep_SetPWM();
+}
+
+/*********************引脚配置*/
+
+
+/*工具函数*********************/
+
+/**
+  * 函    数：开始播放下一个音符
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：当前旋律结束时从队列取下一个旋律，队列为空时停止TIM4并恢复PB8
+  *           在SysTick中断中或关中断状态下调用
+  */
+static void Beep_Next(void)
+{
+	uint16_t Period;
+	
+	if (Beep_Note && Beep_Note->Time) {Beep_Note ++;}
+	if (Beep_Note == 0 || Beep_Note->Time == 0)
+	{
+		Beep_Note = 0;
+		if (Beep_Tail != Beep_Head)
+		{
+			Beep_Note = Beep_Queue[Beep_Tail % BEEP_QUEUE_SIZE];
+			Beep_Tail ++;
+		}
+	}
 	
-	GPIO_InitTypeDef GPIO_Initstructure_B;
-	GPIO_Initstructure_B.GPIO_Mode=GPIO_Mode_IPU ;
-	GPIO_Initstructure_B.GPIO_Pin=GPIO_Pin_8 ;
-	GPIO_Initstructure_B.GPIO_Speed= GPIO_Speed_50MHz;
-	GPIO_Init(GPIOB,&GPIO_Initstructure_B);
+	if (Beep_Note == 0 || Beep_Note->Time == 0)
+	{
+		Beep_Note = 0;
+		Beep_Remain = 0;
+		TIM_Cmd(TIM4, DISABLE);
+		Beep_SetPin(0);
+		Power_Unblock(POWER_BLOCK_BEEP);
+		return;
+	}
+	
+	/*每个音符只计算一次周期，休止时比较值为0，输出保持不响*/
+	if (Beep_Note->Freq)
+	{
+		Period = (uint16_t)(1000000 / Beep_Note->Freq);
+		TIM_SetAutoreload(TIM4, Period - 1);
+		TIM_SetCompare3(TIM4, Period / 2);
+	}
+	else
+	{
+		TIM_SetCompare3(TIM4, 0);
+	}
+	Beep_Remain = Beep_Note->Time;
 }
 
+/*********************工具函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：蜂鸣器持续响
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：清空队列，强制输出响的电平（强制输出不依赖计数器，TIM4停止时同样有效），
+  *           直到调用Beep_OFF或Beep_Play，与原来的用法兼容
+  *           无源蜂鸣器需要用Beep_Play播放一定频率才会响
+  */
 void Beep_ON(void)
 {
-	GPIO_WriteBit(GPIOB,GPIO_Pin_8,Bit_RESET);
+	uint32_t Primask = __get_PRIMASK();
+	
+	__disable_irq();
+	Beep_Tail = Beep_Head;
+	Beep_Note = 0;
+	Beep_Remain = 0;
+	__set_PRIMASK(Primask);
+	
+	TIM_Cmd(TIM4, DISABLE);
+	TIM_ForcedOC3Config(TIM4, TIM_ForcedAction_Active);
+	Beep_SetPin(1);
 }
 
+/**
+  * 函    数：蜂鸣器停止
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：清空队列，停止当前旋律，PB8恢复为开漏输出高电平
+  */
 void Beep_OFF(void)
 {
-	GPIO_WriteBit(GPIOB,GPIO_Pin_8,Bit_SET);
+	uint32_t Primask = __get_PRIMASK();
+	
+	__disable_irq();
+	Beep_Tail = Beep_Head;
+	Beep_Note = 0;
+	Beep_Remain = 0;
+	__set_PRIMASK(Primask);
+	
+	TIM_Cmd(TIM4, DISABLE);
+	TIM_ForcedOC3Config(TIM4, TIM_ForcedAction_InActive);
+	Beep_SetPin(0);
+	Power_Unblock(POWER_BLOCK_BEEP);
 }
 
+/**
+  * 函    数：播放旋律
+  * 参    数：Melody 旋律，音符数组，以Time为0的音符结束，需为静态或常量数组，播放期间不能释放
+  * 参    数：Mode 播放方式，范围：BEEP_APPEND 排在队列末尾
+  *                                BEEP_PREEMPT 清空队列，打断当前旋律立即播放
+  * 返 回 值：1：已加入队列，0：队列已满
+  * 说    明：立即返回，不等待播放，只能在主循环中调用
+  *           播放期间禁止进入STOP模式，播放完后自动解除
+  */
+uint8_t Beep_Play(const Beep_Note_t *Melody, uint8_t Mode)
+{
+	uint8_t Head = Beep_Head;
+	uint32_t Primask = __get_PRIMASK();
+	
+	if (Mode == BEEP_PREEMPT)
+	{
+		__disable_irq();
+		Beep_Tail = Head;
+		Beep_Note = 0;
+		Beep_Remain = 0;
+		__set_PRIMASK(Primask);
+	}
+	if ((uint8_t)(Head - Beep_Tail) >= BEEP_QUEUE_SIZE) {return 0;}
+	
+	Beep_Queue[Head % BEEP_QUEUE_SIZE] = Melody;
+	Beep_Head = Head + 1;
+	
+	/*空闲时由此开始播放，播放中的旋律结束后由SysTick中断接着播放*/
+	__disable_irq();
+	if (Beep_Remain == 0)
+	{
+		Power_Block(POWER_BLOCK_BEEP);
+		Beep_SetPWM();
+		Beep_SetPin(1);
+		TIM_Cmd(TIM4, ENABLE);
+		Beep_Next();
+		TIM_GenerateEvent(TIM4, TIM_EventSource_Update);		//立即装载第一个音符的ARR与CCR3
+	}
+	__set_PRIMASK(Primask);
+	return 1;
+}
 
+/**
+  * 函    数：获取是否正在播放
+  * 参    数：无
+  * 返 回 值：1：正在播放，PB8不能用于OLED，0：空闲
+  */
+uint8_t Beep_IsPlaying(void)
+{
+	return Beep_Remain != 0;
+}
 
+/*********************功能函数*/
 
 
+/*中断函数*********************/
 
+/**
+  * 函    数：蜂鸣器节拍
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：在SysTick_Handler中每1ms调用一次，空闲时立即返回，当前音符到时后切换到下一个
+  */
+void Beep_Tick(void)
+{
+	if (Beep_Remain == 0) {return;}
+	if (-- Beep_Remain) {return;}
+	Beep_Next();
+}
 
-
+/*********************中断函数*/
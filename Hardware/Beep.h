@@ -1,9 +1,61 @@
 #ifndef __BEEP_H__
 #define __BEEP_H__
 
+#include <stdint.h>
+
+/**
+  * 蜂鸣器
+  * PB8由TIM4通道3输出PWM，频率即音调，旋律由音符表描述，在SysTick中断中按时长切换音符
+  * 每1ms只做一次计数比较，每个音符只计算一次ARR，播放期间主循环不需要任何操作
+  * 旋律排队播放，新的旋律可追加到队列末尾，也可打断当前旋律立即播放
+  * 注意：PB8同时是OLED的SCL引脚，播放期间PB8为复用输出，OLED不能通信，
+  *       空闲时PB8恢复为开漏输出高电平，蜂鸣器不响，OLED可正常使用
+  */
+
+/*参数宏定义*********************/
+
+/*蜂鸣器低电平响（与原Beep_ON一致），为0时高电平响*/
+#define BEEP_ACTIVE_LOW			1
+
+/*旋律队列长度，必须为2的整数次方，队列满时新的旋律被丢弃*/
+#define BEEP_QUEUE_SIZE			4
+
+/*Beep_Play的Mode参数取值*/
+#define BEEP_APPEND				0		//排在队列末尾
+#define BEEP_PREEMPT			1		//清空队列，打断当前旋律立即播放
+
+/*********************参数宏定义*/
+
+
+/*旋律描述*********************/
+
+/**
+  * 音符，旋律为音符数组，以Time为0的音符结束
+  */
+typedef struct
+{
+	uint16_t Freq;		//频率，单位Hz，范围：16~20000，0为休止
+	uint16_t Time;		//时长，单位ms
+} Beep_Note_t;
+
+/*内置旋律*/
+extern const Beep_Note_t Beep_Click[];		//按键音
+extern const Beep_Note_t Beep_Alert[];		//提示音，上行三音
+extern const Beep_Note_t Beep_Error[];		//错误音，低音两声
+
+/*********************旋律描述*/
+
+
+/*函数声明*********************/
+
 void Beep_Init(void);
-void Beep_OFF(void);
 void Beep_ON(void);
+void Beep_OFF(void);
+uint8_t Beep_Play(const Beep_Note_t *Melody, uint8_t Mode);
+uint8_t Beep_IsPlaying(void);
+
+void Beep_Tick(void);
 
+/*********************函数声明*/
 
 #endif
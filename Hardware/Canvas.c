@@ -0,0 +1,288 @@
+#include "Canvas.h"
+#include <string.h>
+#include "Format.h"
+
+/*显存数组，分别定义于EPD.c与OLED.c*/
+extern uint8_t EPD_DisplayBuf[16][248];
+extern uint8_t OLED_DisplayBuf[8][128];
+
+/*全局变量*********************/
+
+const Canvas_t EPD_Canvas = {EPD_DisplayBuf[0], 248, 128, 1};
+const Canvas_t OLED_Canvas = {OLED_DisplayBuf[0], 128, 64, 0};
+
+/**
+  * 放大查找表，将4个像素每个重复Zoom次，B0在上
+  * 第0行对应Zoom为2，第1行对应Zoom为3，第2行对应Zoom为4
+  */
+static const uint16_t Canvas_ZoomTable[3][16] = {
+	{0x0000, 0x0003, 0x000C, 0x000F, 0x0030, 0x0033, 0x003C, 0x003F,
+	 0x00C0, 0x00C3, 0x00CC, 0x00CF, 0x00F0, 0x00F3, 0x00FC, 0x00FF},
+	{0x0000, 0x0007, 0x0038, 0x003F, 0x01C0, 0x01C7, 0x01F8, 0x01FF,
+	 0x0E00, 0x0E07, 0x0E38, 0x0E3F, 0x0FC0, 0x0FC7, 0x0FF8, 0x0FFF},
+	{0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF,
+	 0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF},
+};
+
+/*********************全局变量*/
+
+
+/*基本操作*********************/
+
+/**
+  * 函    数：获取指定行所在页的首地址
+  * 参    数：Canvas 指定画布
+  * 参    数：Y 指定行的纵坐标，范围：0~Canvas->Height-1
+  * 返 回 值：该行所在页第0列字节的地址，该行在页内的位为Y % 8
+  * 说    明：调用者需自行保证Y在画布范围内
+  */
+uint8_t *Canvas_GetPage(const Canvas_t *Canvas, int16_t Y)
+{
+	int16_t Page = Y / 8;
+
+	if (Canvas->PageFlip)				//页序反转时，第0行位于最后一页
+	{
+		Page = Canvas->Height / 8 - 1 - Page;
+	}
+	return Canvas->Buf + Page * Canvas->Width;
+}
+
+/**
+  * 函    数：在画布指定位置画一个点
+  * 参    数：Canvas 指定画布
+  * 参    数：X 指定点的横坐标，范围：-32768~32767
+  * 参    数：Y 指定点的纵坐标，范围：-32768~32767
+  * 参    数：Color 点的颜色，1：置1，0：清零
+  * 返 回 值：无
+  * 说    明：超出画布的点不显示
+  */
+void Canvas_DrawPoint(const Canvas_t *Canvas, int16_t X, int16_t Y, uint8_t Color)
+{
+	uint8_t *Page;
+
+	if (X >= 0 && X < Canvas->Width && Y >= 0 && Y < Canvas->Height)	//超出画布的内容不显示
+	{
+		Page = Canvas_GetPage(Canvas, Y);
+		if (Color)
+		{
+			Page[X] |= 0x01 << (Y % 8);
+		}
+		else
+		{
+			Page[X] &= ~(0x01 << (Y % 8));
+		}
+	}
+}
+
+/**
+  * 函    数：获取画布指定位置点的值
+  * 参    数：Canvas 指定画布
+  * 参    数：X 指定点的横坐标，范围：-32768~32767
+  * 参    数：Y 指定点的纵坐标，范围：-32768~32767
+  * 返 回 值：指定位置点的值，1：置1，0：清零，超出画布时返回0
+  */
+uint8_t Canvas_GetPoint(const Canvas_t *Canvas, int16_t X, int16_t Y)
+{
+	if (X >= 0 && X < Canvas->Width && Y >= 0 && Y < Canvas->Height)
+	{
+		return (Canvas_GetPage(Canvas, Y)[X] >> (Y % 8)) & 0x01;
+	}
+	return 0;
+}
+
+/**
+  * 函    数：向画布写入一列像素
+  * 参    数：Canvas 指定画布
+  * 参    数：X 指定列的横坐标，范围：-32768~32767
+  * 参    数：Y 指定列顶端的纵坐标，范围：-32768~32767
+  * 参    数：Bits 列像素数据，B0对应第Y行，向下依次排列
+  * 参    数：Height 列的高度，范围：0~24
+  * 返 回 值：无
+  * 说    明：指定的Height行被Bits覆盖，列外的像素保持不变
+  *           一列最多跨越4页，每页只做一次读改写，是文字与图形绘制的基础
+  */
+void Canvas_WriteColumn(const Canvas_t *Canvas, int16_t X, int16_t Y, uint32_t Bits, uint8_t Height)
+{
+	uint32_t Mask;
+	int16_t Page, Step;
+	uint8_t *Byte;
+
+	if (X < 0 || X >= Canvas->Width) {return;}	//超出画布的内容不显示
+
+	/*裁剪画布上方和下方的部分*/
+	if (Y < 0)
+	{
+		if (-Y >= Height) {return;}
+		Bits >>= -Y;
+		Height += Y;
+		Y = 0;
+	}
+	if (Y + Height > Canvas->Height)
+	{
+		if (Y >= Canvas->Height) {return;}
+		Height = Canvas->Height - Y;
+	}
+
+	/*将列数据对齐到页内位置*/
+	Mask = ((1UL << Height) - 1) << (Y % 8);
+	Bits = (Bits << (Y % 8)) & Mask;
+
+	/*逐页读改写，页序反转时向前一页前进*/
+	Page = Y / 8;
+	Step = Canvas->Width;
+	if (Canvas->PageFlip)
+	{
+		Page = Canvas->Height / 8 - 1 - Page;
+		Step = -Step;
+	}
+	Byte = Canvas->Buf + Page * Canvas->Width + X;
+	while (Mask)
+	{
+		*Byte = (*Byte & ~(uint8_t)Mask) | (uint8_t)Bits;
+		Mask >>= 8;
+		Bits >>= 8;
+		Byte += Step;
+	}
+}
+
+/**
+  * 函    数：在画布上填充矩形
+  * 参    数：Canvas 指定画布
+  * 参    数：X 指定矩形左上角的横坐标，范围：-32768~32767
+  * 参    数：Y 指定矩形左上角的纵坐标，范围：-32768~32767
+  * 参    数：Width 指定矩形的宽度，范围：0~32767
+  * 参    数：Height 指定矩形的高度，范围：0~32767
+  * 参    数：Color 填充颜色，1：置1，0：清零
+  * 返 回 值：无
+  * 说    明：矩形完整覆盖的页直接用memset整段填充，只覆盖一部分的页按位掩码填充
+  *           超出画布的部分不显示
+  */
+void Canvas_FillRect(const Canvas_t *Canvas, int16_t X, int16_t Y, int16_t Width, int16_t Height, uint8_t Color)
+{
+	int16_t Row, End, Top, i;
+	uint8_t *Byte, Mask;
+	
+	/*裁剪到画布范围内*/
+	if (X < 0) {Width += X; X = 0;}
+	if (Y < 0) {Height += Y; Y = 0;}
+	if (Width > Canvas->Width - X) {Width = Canvas->Width - X;}
+	if (Height > Canvas->Height - Y) {Height = Canvas->Height - Y;}
+	if (Width <= 0 || Height <= 0) {return;}
+	
+	Row = Y;
+	End = Y + Height;
+	while (Row < End)
+	{
+		/*本页内属于矩形的行*/
+		Top = Row - Row % 8;
+		Mask = 0xFF << (Row - Top);
+		if (End - Top < 8) {Mask &= 0xFF >> (8 - (End - Top));}
+		
+		Byte = Canvas_GetPage(Canvas, Row) + X;
+		if (Mask == 0xFF)
+		{
+			memset(Byte, Color ? 0xFF : 0x00, Width);
+		}
+		else
+		{
+			for (i = 0; i < Width; i ++)
+			{
+				Byte[i] = Color ? (Byte[i] | Mask) : (Byte[i] & ~Mask);
+			}
+		}
+		Row = Top + 8;
+	}
+}
+
+/**
+  * 函    数：在画布上放大显示图像
+  * 参    数：Canvas 指定画布
+  * 参    数：X 指定放大后图像左上角的横坐标，范围：-32768~32767
+  * 参    数：Y 指定放大后图像左上角的纵坐标，范围：-32768~32767
+  * 参    数：Width 指定原图像的宽度，范围：0~255
+  * 参    数：Height 指定原图像的高度，范围：0~255
+  * 参    数：Image 指定原图像，格式与EPD_ShowImage一致，按页存储，每页Width个字节，B0在上
+  * 参    数：Zoom 放大倍数，范围：1~4
+  * 返 回 值：无
+  * 说    明：放大后的Width*Zoom*Height*Zoom区域会被整体覆盖
+  *           原图像每列按4个像素一组查表放大，不逐像素循环，直接写入显存
+  *           同一原图像列放大出的Zoom列完全相同，只计算一次
+  */
+void Canvas_DrawZoomImage(const Canvas_t *Canvas, int16_t X, int16_t Y, uint8_t Width, uint8_t Height,
+						  const uint8_t *Image, uint8_t Zoom)
+{
+	const uint16_t *Table = Canvas_ZoomTable[0];
+	uint32_t Bits;
+	uint16_t Row;
+	uint8_t i, k, Byte, Group, Count;
+	
+	if (Zoom < 1 || Zoom > 4) {return;}
+	if (Zoom > 1) {Table = Canvas_ZoomTable[Zoom - 2];}
+	
+	/*Canvas_WriteColumn一次最多写24行，放大后每次处理的原像素数*/
+	Group = (Zoom <= 3) ? 8 : 4;
+	
+	for (i = 0; i < Width; i ++)
+	{
+		for (Row = 0; Row < Height; Row += Group)
+		{
+			/*取出原图像本列从Row开始的Group个像素*/
+			Byte = Image[Row / 8 * Width + i] >> (Row % 8);
+			Count = (Height - Row < Group) ? Height - Row : Group;
+			
+			/*查表放大，8个像素时拼接两次查表结果*/
+			if (Zoom == 1)
+			{
+				Bits = Byte;
+			}
+			else
+			{
+				Bits = Table[Byte & 0x0F];
+				if (Group == 8) {Bits |= (uint32_t)Table[Byte >> 4] << (4 * Zoom);}
+			}
+			
+			/*同样的一列写入Zoom次*/
+			for (k = 0; k < Zoom; k ++)
+			{
+				Canvas_WriteColumn(Canvas, X + i * Zoom + k, Y + Row * Zoom, Bits, Count * Zoom);
+			}
+		}
+	}
+}
+
+/**
+  * 函    数：将画布输出为PBM图像
+  * 参    数：Canvas 指定画布
+  * 参    数：Put 字节接收函数，如串口发送函数
+  * 参    数：Arg 字节接收函数的参数
+  * 返 回 值：无
+  * 说    明：输出二进制PBM（P4）格式，逐行从左到右，每字节8个像素，高位在左，1为黑
+  *           显存按页纵向存储，输出时逐行转置，不需要整幅图像的缓冲区
+  *           可将显存内容保存为图片，在电脑上查看或与参考图像比对
+  */
+void Canvas_WritePBM(const Canvas_t *Canvas, Format_PutFunc Put, void *Arg)
+{
+	const uint8_t *Page;
+	int16_t X, Y;
+	uint8_t Byte, Bit;
+	
+	Format_Print(Put, Arg, "P4\n%d %d\n", Canvas->Width, Canvas->Height);
+	for (Y = 0; Y < Canvas->Height; Y ++)
+	{
+		Page = Canvas_GetPage(Canvas, Y);
+		Bit = Y % 8;
+		Byte = 0;
+		for (X = 0; X < Canvas->Width; X ++)
+		{
+			Byte = (Byte << 1) | ((Page[X] >> Bit) & 0x01);
+			if (X % 8 == 7)
+			{
+				Put(Byte, Arg);
+				Byte = 0;
+			}
+		}
+		if (X % 8) {Put(Byte << (8 - X % 8), Arg);}		//行末不足8个像素时低位补0
+	}
+}
+
+/*********************基本操作*/
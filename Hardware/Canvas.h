@@ -0,0 +1,43 @@
+#ifndef __CANVAS_H
+#define __CANVAS_H
+
+#include <stdint.h>
+#include "Format.h"
+
+/*画布描述*********************/
+
+/**
+  * 画布即显存数组的统一描述，EPD与OLED的显存均按页组织
+  * 每页Width个字节，每个字节纵向8个像素，B0在上，B7在下
+  * OLED第0页位于屏幕最上方，EPD第0页位于屏幕最下方（PageFlip为1）
+  * 坐标轴定义与OLED一致：左上角为(0, 0)点，X轴向右，Y轴向下
+  */
+typedef struct
+{
+	uint8_t *Buf;		//显存数组首地址
+	int16_t Width;		//宽度，即每页的字节数
+	int16_t Height;		//高度，为8的整数倍
+	uint8_t PageFlip;	//页序是否反转，0：第0页在上，1：第0页在下
+} Canvas_t;
+
+/*EPD与OLED的显存画布*/
+extern const Canvas_t EPD_Canvas;
+extern const Canvas_t OLED_Canvas;
+
+/*********************画布描述*/
+
+
+/*函数声明*********************/
+
+uint8_t *Canvas_GetPage(const Canvas_t *Canvas, int16_t Y);
+void Canvas_DrawPoint(const Canvas_t *Canvas, int16_t X, int16_t Y, uint8_t Color);
+uint8_t Canvas_GetPoint(const Canvas_t *Canvas, int16_t X, int16_t Y);
+void Canvas_WriteColumn(const Canvas_t *Canvas, int16_t X, int16_t Y, uint32_t Bits, uint8_t Height);
+void Canvas_FillRect(const Canvas_t *Canvas, int16_t X, int16_t Y, int16_t Width, int16_t Height, uint8_t Color);
+void Canvas_DrawZoomImage(const Canvas_t *Canvas, int16_t X, int16_t Y, uint8_t Width, uint8_t Height,
+						  const uint8_t *Image, uint8_t Zoom);
+void Canvas_WritePBM(const Canvas_t *Canvas, Format_PutFunc Put, void *Arg);
+
+/*********************函数声明*/
+
+#endif
@@ -0,0 +1,299 @@
+#include "Chart.h"
+#include <string.h>
+
+/*工具函数*********************/
+
+/*工具函数仅供内部部分函数使用*/
+
+/**
+  * 函    数：获取第Index个采样值
+  * 参    数：Chart 指定曲线图
+  * 参    数：Index 采样点序号，0为最旧的采样点
+  * 返 回 值：采样值
+  */
+static int16_t Chart_Get(const Chart_t *Chart, uint16_t Index)
+{
+	Index += Chart->Head;
+	if (Index >= Chart->Width) {Index -= Chart->Width;}
+	return Chart->Buf[Index];
+}
+
+/**
+  * 函    数：计算采样值在绘图区域内的行号
+  * 参    数：Chart 指定曲线图
+  * 参    数：Value 采样值
+  * 返 回 值：行号，0为最上一行，超出纵轴范围时限制在区域边缘
+  */
+static int16_t Chart_GetRow(const Chart_t *Chart, int16_t Value)
+{
+	if (Value <= Chart->Min) {return Chart->Height - 1;}
+	if (Value >= Chart->Max) {return 0;}
+	return Chart->Height - 1 - (int32_t)(Value - Chart->Min) * (Chart->Height - 1) / (Chart->Max - Chart->Min);
+}
+
+/**
+  * 函    数：重画绘图区域的一列
+  * 参    数：Chart 指定曲线图
+  * 参    数：Column 列号，0为最左一列
+  * 参    数：Row0 线段一端的行号
+  * 参    数：Row1 线段另一端的行号
+  * 返 回 值：无
+  * 说    明：Row0与Row1之间（含）的点置1，本列其余的点清零，每24行写一次显存
+  */
+static void Chart_DrawColumn(const Chart_t *Chart, int16_t Column, int16_t Row0, int16_t Row1)
+{
+	int16_t Top, Bottom, Row, Count;
+	uint32_t Bits;
+	
+	Top = Row0 < Row1 ? Row0 : Row1;
+	Bottom = Row0 < Row1 ? Row1 : Row0;
+	
+	for (Row = 0; Row < Chart->Height; Row += 24)
+	{
+		Count = Chart->Height - Row < 24 ? Chart->Height - Row : 24;
+		
+		/*线段与本段24行的交集*/
+		Bits = 0;
+		if (Top < Row + Count && Bottom >= Row)
+		{
+			Bits = 0xFFFFFFUL;
+			if (Bottom - Row < 23) {Bits &= (1UL << (Bottom - Row + 1)) - 1;}
+			if (Top > Row) {Bits &= ~((1UL << (Top - Row)) - 1);}
+		}
+		Canvas_WriteColumn(Chart->Canvas, Chart->X + Column, Chart->Y + Row, Bits, Count);
+	}
+}
+
+/**
+  * 函    数：绘图区域整体左移一列
+  * 参    数：Chart 指定曲线图
+  * 返 回 值：无
+  * 说    明：区域完整覆盖的页直接用memmove移动，区域只覆盖一部分的页按位掩码移动
+  *           最右一列保持原样，由调用者重画
+  */
+static void Chart_Shift(const Chart_t *Chart)
+{
+	int16_t Row = Chart->Y, End = Chart->Y + Chart->Height, Top, i;
+	uint8_t *Byte, Mask;
+	
+	while (Row < End)
+	{
+		/*本页内属于绘图区域的行*/
+		Top = Row - Row % 8;
+		Mask = 0xFF << (Row - Top);
+		if (End - Top < 8) {Mask &= 0xFF >> (8 - (End - Top));}
+		
+		Byte = Canvas_GetPage(Chart->Canvas, Row) + Chart->X;
+		if (Mask == 0xFF)
+		{
+			memmove(Byte, Byte + 1, Chart->Width - 1);
+		}
+		else
+		{
+			for (i = 0; i < Chart->Width - 1; i ++)
+			{
+				Byte[i] = (Byte[i] & ~Mask) | (Byte[i + 1] & Mask);
+			}
+		}
+		Row = Top + 8;
+	}
+}
+
+/**
+  * 函    数：根据缓冲区内的数据调整纵轴范围
+  * 参    数：Chart 指定曲线图
+  * 参    数：Low 缓冲区内的最小值
+  * 参    数：High 缓冲区内的最大值
+  * 返 回 值：纵轴范围是否改变，1：改变，0：未改变
+  * 说    明：数据超出范围时扩大，数据跨度不足范围的三分之一时缩小，避免频繁全部重画
+  *           新的范围在数据上下各留出跨度的1/4加1的余量，持续上升或下降的信号
+  *           每变化约1/4跨度才重画一次，而不是每个采样都重画
+  *           刚调整后的范围为跨度的1.5倍加2，不会立即满足缩小的条件
+  */
+static uint8_t Chart_Rescale(Chart_t *Chart, int16_t Low, int16_t High)
+{
+	int32_t Span, Pad, Min, Max;
+	
+	if (High <= Low) {High = Low + 1;}
+	Span = (int32_t)High - Low;
+	
+	if (Low < Chart->Min || High > Chart->Max
+		|| Span * 3 < (int32_t)Chart->Max - Chart->Min)
+	{
+		Pad = Span / 4 + 1;
+		Min = Low - Pad;
+		Max = High + Pad;
+		if (Min < -32768) {Min = -32768;}
+		if (Max > 32767) {Max = 32767;}
+		if (Min != Chart->Min || Max != Chart->Max)
+		{
+			Chart->Min = (int16_t)Min;
+			Chart->Max = (int16_t)Max;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*********************工具函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：初始化曲线图
+  * 参    数：Chart 指定要初始化的曲线图
+  * 参    数：Canvas 指定画布，范围：&EPD_Canvas或&OLED_Canvas
+  * 参    数：X 指定绘图区域左上角的横坐标
+  * 参    数：Y 指定绘图区域左上角的纵坐标
+  * 参    数：Width 指定绘图区域的宽度，范围：1~CHART_MAX_WIDTH，超出时限制在范围内
+  * 参    数：Height 指定绘图区域的高度，范围：1~画布高度，小于1时按1处理
+  * 参    数：Min 指定纵轴下限
+  * 参    数：Max 指定纵轴上限，需大于Min，自动调整时作为初始范围
+  * 参    数：AutoScale 是否自动调整纵轴范围，范围：CHART_FIXED或CHART_AUTO
+  * 返 回 值：无
+  * 说    明：绘图区域需完全位于画布之内，初始化时清空绘图区域
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void Chart_Init(Chart_t *Chart, const Canvas_t *Canvas, int16_t X, int16_t Y, int16_t Width, int16_t Height,
+				int16_t Min, int16_t Max, uint8_t AutoScale)
+{
+	if (Width > CHART_MAX_WIDTH) {Width = CHART_MAX_WIDTH;}
+	if (Width < 1) {Width = 1;}			//宽度用作环形缓冲区的模，不能为0
+	if (Height < 1) {Height = 1;}
+	
+	Chart->Canvas = Canvas;
+	Chart->X = X;
+	Chart->Y = Y;
+	Chart->Width = Width;
+	Chart->Height = Height;
+	Chart->Min = Min;
+	Chart->Max = Max > Min ? Max : Min + 1;
+	Chart->AutoScale = AutoScale;
+	Chart->Head = 0;
+	Chart->Count = 0;
+	
+	Chart_Redraw(Chart);
+}
+
+/**
+  * 函    数：重画整个绘图区域
+  * 参    数：Chart 指定曲线图
+  * 返 回 值：无
+  * 说    明：相邻采样点之间以竖线连接，没有数据的列清空
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void Chart_Redraw(Chart_t *Chart)
+{
+	int16_t i, Row, Last = -1;
+	
+	for (i = 0; i < Chart->Width; i ++)
+	{
+		if (i < Chart->Count)
+		{
+			Row = Chart_GetRow(Chart, Chart_Get(Chart, i));
+			Chart_DrawColumn(Chart, i, Last < 0 ? Row : Last, Row);
+			Last = Row;
+		}
+		else
+		{
+			Chart_DrawColumn(Chart, i, -1, -1);		//行号-1在区域之外，即清空本列
+		}
+	}
+}
+
+/**
+  * 函    数：向曲线图添加一个采样点
+  * 参    数：Chart 指定曲线图
+  * 参    数：Value 采样值
+  * 参    数：Dirty 返回显存被改写的矩形，可直接作为局部刷新的区域，不需要时给NULL
+  * 返 回 值：是否全部重画，1：纵轴范围改变，全部重画，0：只画了新的一列
+  * 说    明：缓冲区未满时新点画在已有数据的右侧，改写区域只有一列
+  *           缓冲区已满时丢弃最旧的点，绘图区域左移一列后只画最右一列，
+  *           并重画最左一列，去掉与被丢弃的点之间的连线
+  *           左移只影响曲线经过的行，改写区域的高度限制在新旧数据的范围之内
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+uint8_t Chart_Push(Chart_t *Chart, int16_t Value, TextRect_t *Dirty)
+{
+	int16_t Low, High, Sample, Column, Row, Last, Top, Bottom;
+	uint16_t i;
+	uint8_t Scroll = 0;
+	
+	/*左移前的数据范围，决定左移改写了哪些行*/
+	Low = High = Value;
+	for (i = 0; i < Chart->Count; i ++)
+	{
+		Sample = Chart_Get(Chart, i);
+		if (Sample < Low) {Low = Sample;}
+		if (Sample > High) {High = Sample;}
+	}
+	Top = Chart_GetRow(Chart, High);
+	Bottom = Chart_GetRow(Chart, Low);
+	
+	/*写入环形缓冲区，已满时覆盖最旧的点*/
+	if (Chart->Count < Chart->Width)
+	{
+		Chart->Buf[(Chart->Head + Chart->Count) % Chart->Width] = Value;
+		Chart->Count ++;
+	}
+	else
+	{
+		Chart->Buf[Chart->Head] = Value;
+		Chart->Head = (Chart->Head + 1) % Chart->Width;
+		Scroll = 1;
+	}
+	
+	/*纵轴范围改变时全部重画*/
+	if (Chart->AutoScale)
+	{
+		/*被丢弃的点不再参与范围计算，需要重新统计*/
+		Low = High = Value;
+		for (i = 0; i < Chart->Count; i ++)
+		{
+			Sample = Chart_Get(Chart, i);
+			if (Sample < Low) {Low = Sample;}
+			if (Sample > High) {High = Sample;}
+		}
+		if (Chart_Rescale(Chart, Low, High))
+		{
+			Chart_Redraw(Chart);
+			if (Dirty)
+			{
+				Dirty->X = Chart->X;
+				Dirty->Y = Chart->Y;
+				Dirty->Width = Chart->Width;
+				Dirty->Height = Chart->Height;
+			}
+			return 1;
+		}
+	}
+	
+	/*左移一列，最左一列原本连向被丢弃的点，改为只画一个点，新点画在最右侧已有数据之后*/
+	if (Scroll)
+	{
+		Chart_Shift(Chart);
+		Row = Chart_GetRow(Chart, Chart_Get(Chart, 0));
+		Chart_DrawColumn(Chart, 0, Row, Row);
+	}
+	Column = Chart->Count - 1;
+	Row = Chart_GetRow(Chart, Value);
+	Last = Column > 0 ? Chart_GetRow(Chart, Chart_Get(Chart, Column - 1)) : Row;
+	Chart_DrawColumn(Chart, Column, Last, Row);
+	
+	if (Dirty)
+	{
+		Dirty->X = Scroll ? Chart->X : Chart->X + Column;
+		Dirty->Width = Scroll ? Chart->Width : 1;
+		if (!Scroll)		//未左移时只改写了新的一列，上下范围为连线的两端
+		{
+			Top = Row < Last ? Row : Last;
+			Bottom = Row < Last ? Last : Row;
+		}
+		Dirty->Y = Chart->Y + Top;
+		Dirty->Height = Bottom - Top + 1;
+	}
+	return 0;
+}
+
+/*********************功能函数*/
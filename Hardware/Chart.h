@@ -0,0 +1,53 @@
+#ifndef __CHART_H
+#define __CHART_H
+
+#include <stdint.h>
+#include "Canvas.h"
+#include "Text.h"
+
+/*参数宏定义*********************/
+
+/*绘图区域最大宽度，即环形缓冲区的容量*/
+#define CHART_MAX_WIDTH			248
+
+/*AutoScale参数取值*/
+#define CHART_FIXED				0		//固定纵轴范围
+#define CHART_AUTO				1		//根据缓冲区内的数据自动调整纵轴范围
+
+/*********************参数宏定义*/
+
+
+/*控件描述*********************/
+
+/**
+  * 滚动曲线图，最新的采样点位于最右列，每次采样整体左移一列
+  * 采样值保存在环形缓冲区中，缓冲区容量等于绘图区域宽度
+  */
+typedef struct
+{
+	const Canvas_t *Canvas;				//所在画布
+	int16_t X;							//绘图区域左上角横坐标
+	int16_t Y;							//绘图区域左上角纵坐标
+	int16_t Width;						//绘图区域宽度，范围：1~CHART_MAX_WIDTH
+	int16_t Height;						//绘图区域高度
+	int16_t Min;						//纵轴下限，对应最下一行
+	int16_t Max;						//纵轴上限，对应最上一行
+	uint8_t AutoScale;					//是否自动调整纵轴范围
+	uint16_t Head;						//最旧采样点在缓冲区中的位置
+	uint16_t Count;						//缓冲区内的采样点数量
+	int16_t Buf[CHART_MAX_WIDTH];		//采样值环形缓冲区
+} Chart_t;
+
+/*********************控件描述*/
+
+
+/*函数声明*********************/
+
+void Chart_Init(Chart_t *Chart, const Canvas_t *Canvas, int16_t X, int16_t Y, int16_t Width, int16_t Height,
+				int16_t Min, int16_t Max, uint8_t AutoScale);
+void Chart_Redraw(Chart_t *Chart);
+uint8_t Chart_Push(Chart_t *Chart, int16_t Value, TextRect_t *Dirty);
+
+/*********************函数声明*/
+
+#endif
@@ -0,0 +1,118 @@
+#include "Digits.h"
+#include "Format.h"
+
+/*功能函数*********************/
+
+/**
+  * 函    数：初始化数字控件
+  * 参    数：Digits 指定要初始化的控件
+  * 参    数：Canvas 指定画布，范围：&EPD_Canvas或&OLED_Canvas
+  * 参    数：X 指定控件左上角的横坐标，范围：-32768~32767
+  * 参    数：Y 指定控件左上角的纵坐标，范围：-32768~32767
+  * 参    数：Length 指定字符格数量，范围：1~10
+  * 参    数：Font 指定字体
+  * 返 回 值：无
+  * 说    明：初始化不写显存，第一次显示时画出全部字符格
+  */
+void Digits_Init(Digits_t *Digits, const Canvas_t *Canvas, int16_t X, int16_t Y, uint8_t Length, const Font_t *Font)
+{
+	uint8_t Advance;
+	char Char;
+	
+	if (Length > DIGITS_MAX_LENGTH) {Length = DIGITS_MAX_LENGTH;}
+	
+	Digits->Canvas = Canvas;
+	Digits->Font = Font;
+	Digits->X = X;
+	Digits->Y = Y;
+	Digits->Length = Length;
+	
+	/*比例字体的数字宽度可能不同，取最宽者作为字符格宽度，保证数字不会左右跳动*/
+	Digits->CellWidth = 0;
+	for (Char = '0'; Char <= '9'; Char ++)
+	{
+		Advance = Font_GetAdvance(Font, Char);
+		if (Advance > Digits->CellWidth) {Digits->CellWidth = Advance;}
+	}
+	
+	Digits_Invalidate(Digits);
+}
+
+/**
+  * 函    数：使数字控件下次显示时全部重画
+  * 参    数：Digits 指定控件
+  * 返 回 值：无
+  * 说    明：显存被其他函数改写后（如清屏），需调用此函数
+  */
+void Digits_Invalidate(Digits_t *Digits)
+{
+	uint8_t i;
+	
+	for (i = 0; i < DIGITS_MAX_LENGTH; i ++)
+	{
+		Digits->Last[i] = '\0';
+	}
+}
+
+/**
+  * 函    数：数字控件显示字符串
+  * 参    数：Digits 指定控件
+  * 参    数：String 指定要显示的字符串，如"12:34"，超出字符格数量的部分不显示，不足的字符格显示空白
+  * 参    数：Dirty 返回被改写的最小矩形，没有改写时宽高为0，可直接作为局部刷新的区域，不需要时给NULL
+  * 返 回 值：重画的字符格数量
+  * 说    明：只重画内容与上次不同的字符格，每个字符格的列只写一次显存
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+uint8_t Digits_ShowString(Digits_t *Digits, const char *String, TextRect_t *Dirty)
+{
+	uint8_t i, j, Count = 0, First = 0, Last = 0, Advance;
+	int16_t X;
+	char Char;
+	
+	for (i = 0; i < Digits->Length; i ++)
+	{
+		Char = (*String != '\0') ? *String ++ : ' ';
+		if (Char == Digits->Last[i]) {continue;}		//内容未变化，跳过
+		
+		/*字符左对齐，字符格剩余的列清空*/
+		X = Digits->X + i * Digits->CellWidth;
+		Advance = Font_ShowChar(Digits->Canvas, X, Digits->Y, Char, Digits->Font);
+		for (j = Advance; j < Digits->CellWidth; j ++)
+		{
+			Canvas_WriteColumn(Digits->Canvas, X + j, Digits->Y, 0, Digits->Font->Height);
+		}
+		Digits->Last[i] = Char;
+		
+		if (Count == 0) {First = i;}
+		Last = i;
+		Count ++;
+	}
+	
+	if (Dirty)
+	{
+		Dirty->X = Digits->X + First * Digits->CellWidth;
+		Dirty->Y = Digits->Y;
+		Dirty->Width = Count ? (Last - First + 1) * Digits->CellWidth : 0;
+		Dirty->Height = Count ? Digits->Font->Height : 0;
+	}
+	return Count;
+}
+
+/**
+  * 函    数：数字控件显示数字（十进制，正整数）
+  * 参    数：Digits 指定控件
+  * 参    数：Number 指定要显示的数字，范围：0~4294967295
+  * 参    数：Dirty 返回被改写的最小矩形，同Digits_ShowString
+  * 返 回 值：重画的字符格数量
+  * 说    明：显示格式与EPD_ShowNum一致，位数为字符格数量，不足时补0，超出时只显示低位
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+uint8_t Digits_ShowNum(Digits_t *Digits, uint32_t Number, TextRect_t *Dirty)
+{
+	char String[DIGITS_MAX_LENGTH + 1];
+	
+	Format_Dec(String, Number, Digits->Length);
+	return Digits_ShowString(Digits, String, Dirty);
+}
+
+/*********************功能函数*/
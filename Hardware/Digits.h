@@ -0,0 +1,46 @@
+#ifndef __DIGITS_H
+#define __DIGITS_H
+
+#include <stdint.h>
+#include "Canvas.h"
+#include "Font.h"
+#include "Text.h"
+
+/*参数宏定义*********************/
+
+/*最大位数，与uint32_t的十进制位数一致*/
+#define DIGITS_MAX_LENGTH		10
+
+/*********************参数宏定义*/
+
+
+/*控件描述*********************/
+
+/**
+  * 数字控件，用于计数器、时钟等只有少数几位经常变化的显示
+  * 每位占用一个等宽的字符格，记住上次显示的内容，只重画变化了的字符格
+  */
+typedef struct
+{
+	const Canvas_t *Canvas;				//所在画布
+	const Font_t *Font;					//字体
+	int16_t X;							//左上角横坐标
+	int16_t Y;							//左上角纵坐标
+	uint8_t Length;						//字符格数量
+	uint8_t CellWidth;					//字符格宽度，取数字中最大的步进宽度
+	char Last[DIGITS_MAX_LENGTH];		//上次显示的内容，'\0'表示需要重画
+} Digits_t;
+
+/*********************控件描述*/
+
+
+/*函数声明*********************/
+
+void Digits_Init(Digits_t *Digits, const Canvas_t *Canvas, int16_t X, int16_t Y, uint8_t Length, const Font_t *Font);
+void Digits_Invalidate(Digits_t *Digits);
+uint8_t Digits_ShowString(Digits_t *Digits, const char *String, TextRect_t *Dirty);
+uint8_t Digits_ShowNum(Digits_t *Digits, uint32_t Number, TextRect_t *Dirty);
+
+/*********************函数声明*/
+
+#endif
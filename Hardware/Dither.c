@@ -0,0 +1,288 @@
+#include "Dither.h"
+
+/**
+  * 灰度约定：
+  * 输入为8位灰度，0为最深，255为最浅
+  * 较深的像素在显存中置1，较浅的像素清零，与字模数据中置1即显示的约定一致
+  *
+  * 行缓存约定：
+  * 误差扩散只保存一行误差状态（DITHER_MAX_WIDTH * 2字节）
+  * Floyd-Steinberg每列一个int16_t，记录扩散到下一行的误差
+  * Atkinson每列两个int8_t，分别记录扩散到下一行和下下行的误差
+  * Atkinson每次只扩散1/8误差，单项不超过±16，累加后不会溢出int8_t
+  */
+
+/*全局变量*********************/
+
+/*4*4有序抖动阈值表，阈值 = 矩阵值 * 16 + 8*/
+static const uint8_t Dither_Bayer4[4][4] = {
+	{  8, 136,  40, 168},
+	{200,  72, 232, 104},
+	{ 56, 184,  24, 152},
+	{248, 120, 216,  88},
+};
+
+/*8*8有序抖动阈值表，阈值 = 矩阵值 * 4 + 2*/
+static const uint8_t Dither_Bayer8[8][8] = {
+	{  2, 130,  34, 162,  10, 138,  42, 170},
+	{194,  66, 226,  98, 202,  74, 234, 106},
+	{ 50, 178,  18, 146,  58, 186,  26, 154},
+	{242, 114, 210,  82, 250, 122, 218,  90},
+	{ 14, 142,  46, 174,   6, 134,  38, 166},
+	{206,  78, 238, 110, 198,  70, 230, 102},
+	{ 62, 190,  30, 158,  54, 182,  22, 150},
+	{254, 126, 222,  94, 246, 118, 214,  86},
+};
+
+/*Atkinson单列误差状态*/
+typedef struct
+{
+	int8_t Next;		//扩散到下一行的误差
+	int8_t Next2;		//扩散到下下行的误差
+} DitherAtkinson_t;
+
+/*误差行缓存，两种误差扩散方式共用同一块内存*/
+static union
+{
+	int16_t Floyd[DITHER_MAX_WIDTH];
+	DitherAtkinson_t Atkinson[DITHER_MAX_WIDTH];
+} Dither_Line;
+
+/*当前抖动任务*/
+static const Canvas_t *Dither_Canvas;
+static int16_t Dither_X, Dither_Y;
+static uint16_t Dither_Width;
+static uint8_t Dither_Mode;
+
+/*********************全局变量*/
+
+
+/*工具函数*********************/
+
+/*工具函数仅供内部部分函数使用*/
+
+/**
+  * 函    数：将一行中的一个像素写入显存
+  * 参    数：Page 当前行所在页的首地址，为0时表示当前行在画布外
+  * 参    数：Mask 当前行在页内的位掩码
+  * 参    数：X 像素的横坐标
+  * 参    数：Ink 1：置1，0：清零
+  * 返 回 值：无
+  */
+static void Dither_Put(uint8_t *Page, uint8_t Mask, int16_t X, uint8_t Ink)
+{
+	if (Page && X >= 0 && X < Dither_Canvas->Width)		//超出画布的内容不显示
+	{
+		if (Ink)
+		{
+			Page[X] |= Mask;
+		}
+		else
+		{
+			Page[X] &= ~Mask;
+		}
+	}
+}
+
+/**
+  * 函    数：将误差限制在±127以内
+  * 参    数：Error 量化误差
+  * 返 回 值：限幅后的误差
+  */
+static int16_t Dither_Clamp(int16_t Error)
+{
+	if (Error > 127) {return 127;}
+	if (Error < -127) {return -127;}
+	return Error;
+}
+
+/*********************工具函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：开始一次逐行抖动
+  * 参    数：Canvas 指定目标画布，范围：&EPD_Canvas或&OLED_Canvas
+  * 参    数：X 指定图像左上角的横坐标，范围：-32768~32767
+  * 参    数：Y 指定图像左上角的纵坐标，范围：-32768~32767
+  * 参    数：Width 图像宽度，范围：0~DITHER_MAX_WIDTH，为0时之后的Dither_Row不输出
+  * 参    数：Mode 抖动方式
+  *           范围：DITHER_BAYER4		4*4有序抖动
+  *                 DITHER_BAYER8		8*8有序抖动
+  *                 DITHER_FLOYD		Floyd-Steinberg误差扩散
+  *                 DITHER_ATKINSON		Atkinson误差扩散
+  * 返 回 值：无
+  * 说    明：之后每调用一次Dither_Row，输出一行，可逐行从Flash或串口数据流中送入
+  */
+void Dither_Begin(const Canvas_t *Canvas, int16_t X, int16_t Y, uint16_t Width, uint8_t Mode)
+{
+	uint16_t i;
+
+	if (Width > DITHER_MAX_WIDTH) {Width = DITHER_MAX_WIDTH;}
+
+	Dither_Canvas = Canvas;
+	Dither_X = X;
+	Dither_Y = Y;
+	Dither_Width = Width;
+	Dither_Mode = Mode;
+
+	/*清空误差行缓存*/
+	for (i = 0; i < Width; i ++)
+	{
+		Dither_Line.Floyd[i] = 0;
+	}
+}
+
+/**
+  * 函    数：抖动一行灰度数据并写入显存
+  * 参    数：Gray 一行灰度数据，长度为Dither_Begin指定的Width
+  * 返 回 值：无
+  * 说    明：每调用一次，输出行自动下移一行
+  *           超出画布的行与列不显示，但仍参与误差扩散
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void Dither_Row(const uint8_t *Gray)
+{
+	uint8_t *Page = 0;
+	uint8_t Mask;
+	uint16_t i;
+	int16_t X, Value, Error;
+	int16_t Right, Right2, Below, BelowNext, Eighth;
+	const uint8_t *Threshold;
+
+	/*宽度为0时没有像素，也不能写行缓存末尾的误差*/
+	if (Dither_Width == 0) {Dither_Y ++; return;}
+
+	/*确定当前行在显存中的位置*/
+	if (Dither_Y >= 0 && Dither_Y < Dither_Canvas->Height)
+	{
+		Page = Canvas_GetPage(Dither_Canvas, Dither_Y);
+	}
+	Mask = 0x01 << (Dither_Y & 0x07);
+
+	if (Dither_Mode == DITHER_BAYER4 || Dither_Mode == DITHER_BAYER8)
+	{
+		/*有序抖动，每个像素只与阈值表比较，无需误差状态*/
+		if (Page)
+		{
+			if (Dither_Mode == DITHER_BAYER4)
+			{
+				Threshold = Dither_Bayer4[Dither_Y & 0x03];
+				for (i = 0; i < Dither_Width; i ++)
+				{
+					X = Dither_X + i;
+					Dither_Put(Page, Mask, X, Gray[i] < Threshold[X & 0x03]);
+				}
+			}
+			else
+			{
+				Threshold = Dither_Bayer8[Dither_Y & 0x07];
+				for (i = 0; i < Dither_Width; i ++)
+				{
+					X = Dither_X + i;
+					Dither_Put(Page, Mask, X, Gray[i] < Threshold[X & 0x07]);
+				}
+			}
+		}
+	}
+	else if (Dither_Mode == DITHER_FLOYD)
+	{
+		/*Floyd-Steinberg：右7/16，左下3/16，下5/16，右下1/16*/
+		/*Floyd[i]在读出本行误差后，立即被改写为下一行的误差*/
+		Right = 0;			//扩散到本行下一列的误差
+		Below = 0;			//扩散到下一行上一列的累计误差
+		BelowNext = 0;		//扩散到下一行本列的累计误差
+		for (i = 0; i < Dither_Width; i ++)
+		{
+			Value = Gray[i] + Dither_Line.Floyd[i] + Right;
+			if (Value < 128)
+			{
+				Dither_Put(Page, Mask, Dither_X + i, 1);
+				Error = Value;
+			}
+			else
+			{
+				Dither_Put(Page, Mask, Dither_X + i, 0);
+				Error = Value - 255;
+			}
+			Error = Dither_Clamp(Error);
+
+			Right = Error * 7 / 16;
+			if (i > 0)
+			{
+				Dither_Line.Floyd[i - 1] = Below + Error * 3 / 16;
+			}
+			Below = BelowNext + Error * 5 / 16;
+			BelowNext = Error / 16;
+		}
+		Dither_Line.Floyd[Dither_Width - 1] = Below;
+	}
+	else if (Dither_Mode == DITHER_ATKINSON)
+	{
+		/*Atkinson：右、右二、左下、下、右下、下二各1/8，其余2/8舍弃*/
+		Right = 0;			//扩散到本行下一列的误差
+		Right2 = 0;			//扩散到本行下二列的误差
+		Below = 0;			//扩散到下一行上一列的累计误差
+		BelowNext = 0;		//扩散到下一行本列的累计误差
+		Eighth = 0;			//上一列的1/8误差
+		for (i = 0; i < Dither_Width; i ++)
+		{
+			Value = Gray[i] + Dither_Line.Atkinson[i].Next + Right;
+			Right = Right2;
+			if (Value < 128)
+			{
+				Dither_Put(Page, Mask, Dither_X + i, 1);
+				Error = Value;
+			}
+			else
+			{
+				Dither_Put(Page, Mask, Dither_X + i, 0);
+				Error = Value - 255;
+			}
+			Error = Dither_Clamp(Error) / 8;
+
+			Right += Error;
+			Right2 = Error;
+			if (i > 0)
+			{
+				/*上一列的下一行误差已收齐，写回行缓存，并记录其下下行误差*/
+				Dither_Line.Atkinson[i - 1].Next = Dither_Line.Atkinson[i - 1].Next2 + Below + Error;
+				Dither_Line.Atkinson[i - 1].Next2 = Eighth;
+			}
+			Below = BelowNext + Error;
+			BelowNext = Error;
+			Eighth = Error;
+		}
+		Dither_Line.Atkinson[Dither_Width - 1].Next = Dither_Line.Atkinson[Dither_Width - 1].Next2 + Below;
+		Dither_Line.Atkinson[Dither_Width - 1].Next2 = Eighth;
+	}
+
+	Dither_Y ++;
+}
+
+/**
+  * 函    数：抖动一幅完整的灰度图像并写入显存
+  * 参    数：Canvas 指定目标画布，范围：&EPD_Canvas或&OLED_Canvas
+  * 参    数：X 指定图像左上角的横坐标，范围：-32768~32767
+  * 参    数：Y 指定图像左上角的纵坐标，范围：-32768~32767
+  * 参    数：Width 图像宽度，范围：0~DITHER_MAX_WIDTH，为0时不输出
+  * 参    数：Height 图像高度
+  * 参    数：Gray 灰度图像数据，逐行存储，每行Width字节
+  * 参    数：Mode 抖动方式，取值同Dither_Begin
+  * 返 回 值：无
+  * 说    明：调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void Dither_Image(const Canvas_t *Canvas, int16_t X, int16_t Y, uint16_t Width, uint16_t Height,
+				  const uint8_t *Gray, uint8_t Mode)
+{
+	uint16_t j;
+
+	Dither_Begin(Canvas, X, Y, Width, Mode);
+	for (j = 0; j < Height; j ++)
+	{
+		Dither_Row(Gray + (uint32_t)j * Width);
+	}
+}
+
+/*********************功能函数*/
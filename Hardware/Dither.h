@@ -0,0 +1,30 @@
+#ifndef __DITHER_H
+#define __DITHER_H
+
+#include <stdint.h>
+#include "Canvas.h"
+
+/*参数宏定义*********************/
+
+/*Mode参数取值*/
+#define DITHER_BAYER4			0		//4*4有序抖动
+#define DITHER_BAYER8			1		//8*8有序抖动
+#define DITHER_FLOYD			2		//Floyd-Steinberg误差扩散
+#define DITHER_ATKINSON			3		//Atkinson误差扩散
+
+/*单行最大宽度，决定误差行缓存的大小*/
+#define DITHER_MAX_WIDTH		248
+
+/*********************参数宏定义*/
+
+
+/*函数声明*********************/
+
+void Dither_Begin(const Canvas_t *Canvas, int16_t X, int16_t Y, uint16_t Width, uint8_t Mode);
+void Dither_Row(const uint8_t *Gray);
+void Dither_Image(const Canvas_t *Canvas, int16_t X, int16_t Y, uint16_t Width, uint16_t Height,
+				  const uint8_t *Gray, uint8_t Mode);
+
+/*********************函数声明*/
+
+#endif
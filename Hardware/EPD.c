@@ -2,10 +2,13 @@
 #include "EPD.h"
 #include <string.h>
 #include <math.h>
-#include <stdio.h>
 #include <stdarg.h>
+#include "Format.h"
+#include "Canvas.h"
 #include "Delay.h"
 #include "EPD_Data.h"
+#include "EPD_Sim.h"
+#include "Trace.h"
 
 /*宏定义*********************/
 #define EPD_SCL 	GPIO_Pin_0
@@ -28,6 +31,9 @@
   */
 uint8_t EPD_DisplayBuf[16][248];
 
+/*是否有已开始、未结束的刷新，由EPD_UpdateStart与EPD_UpdateAreaStart置1，EPD_UpdateFinish清0*/
+static uint8_t EPD_Refreshing;
+
 /*********************全局变量*/
 
 
@@ -44,7 +50,11 @@ uint8_t EPD_DisplayBuf[16][248];
 void EPD_W_D0(uint8_t BitValue)
 {
 	/*根据BitValue的值，将D0置高电平或者低电平*/
+#ifdef EPD_SIM
+	EPD_Sim_Pin(EPD_SIM_SCL, BitValue);
+#else
 	GPIO_WriteBit(GPIOA, EPD_SCL, (BitAction)BitValue);
+#endif
 }
 
 /**
@@ -58,7 +68,11 @@ void EPD_W_D0(uint8_t BitValue)
 void EPD_W_D1(uint8_t BitValue)
 {
 	/*根据BitValue的值，将D1置高电平或者低电平*/
+#ifdef EPD_SIM
+	EPD_Sim_Pin(EPD_SIM_SDA, BitValue);
+#else
 	GPIO_WriteBit(GPIOA, EPD_SDA, (BitAction)BitValue);
+#endif
 }
 
 /**
@@ -72,7 +86,11 @@ void EPD_W_D1(uint8_t BitValue)
 void EPD_W_RES(uint8_t BitValue)
 {
 	/*根据BitValue的值，将RES置高电平或者低电平*/
+#ifdef EPD_SIM
+	EPD_Sim_Pin(EPD_SIM_RES, BitValue);
+#else
 	GPIO_WriteBit(GPIOA, EPD_RES, (BitAction)BitValue);
+#endif
 }
 
 /**
@@ -86,7 +104,11 @@ void EPD_W_RES(uint8_t BitValue)
 void EPD_W_DC(uint8_t BitValue)
 {
 	/*根据BitValue的值，将DC置高电平或者低电平*/
+#ifdef EPD_SIM
+	EPD_Sim_Pin(EPD_SIM_DC, BitValue);
+#else
 	GPIO_WriteBit(GPIOA, EPD_DC, (BitAction)BitValue);
+#endif
 }
 
 /**
@@ -100,7 +122,28 @@ void EPD_W_DC(uint8_t BitValue)
 void EPD_W_CS(uint8_t BitValue)
 {
 	/*根据BitValue的值，将CS置高电平或者低电平*/
+#ifdef EPD_SIM
+	EPD_Sim_Pin(EPD_SIM_CS, BitValue);
+#else
 	GPIO_WriteBit(GPIOA, EPD_CS, (BitAction)BitValue);
+#endif
+}
+
+/**
+  * 函    数：EPD读BUSY电平
+  * 参    数：无
+  * 返 回 值：BUSY的电平值，范围：0/1
+  * 说    明：当上层函数需要读BUSY时，此函数会被调用
+  *           用户需要返回BUSY引脚当前的电平，1表示EPD正忙
+  */
+uint8_t EPD_R_BUSY(void)
+{
+	/*读取BUSY引脚的输入电平*/
+#ifdef EPD_SIM
+	return EPD_Sim_ReadBusy();
+#else
+	return GPIO_ReadInputDataBit(GPIOA, EPD_BUSY);
+#endif
 }
 
 /**
@@ -112,14 +155,6 @@ void EPD_W_CS(uint8_t BitValue)
   */
 void EPD_GPIO_Init(void)
 {
-	uint32_t i, j;
-	
-	/*在初始化前，加入适量延时，待EPD供电稳定*/
-	for (i = 0; i < 1000; i ++)
-	{
-		for (j = 0; j < 1000; j ++);
-	}
-	
 	/*将D0、D1、RES、DC和CS引脚初始化为推挽输出模式*/
     RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA, ENABLE);
 	
@@ -220,15 +255,17 @@ void EPD_WriteDatas(uint8_t *Data, uint16_t Count)
 void EPD_WaitBusy(void)
 {
 	uint8_t x=1;
+	TRACE_BEGIN(TRACE_EPD_BUSY);
 	while(1)
 	{
-		x=GPIO_ReadInputDataBit(GPIOA,EPD_BUSY);
+		x=EPD_R_BUSY();
 		if(x==0)
 		{
 			Delay_ms(10);
 			break;
 		}
 	}
+	TRACE_END(TRACE_EPD_BUSY);
 }
 
 /*********************busy线*/
@@ -245,6 +282,14 @@ void EPD_WaitBusy(void)
   */
 void EPD_Init(void)
 {
+	uint32_t i, j;
+	
+	/*在初始化前，加入适量延时，待EPD供电稳定*/
+	for (i = 0; i < 1000; i ++)
+	{
+		for (j = 0; j < 1000; j ++);
+	}
+	
 	EPD_GPIO_Init();
 	EPD_W_RES(0);
 	Delay_ms(15);
@@ -289,7 +334,6 @@ void EPD_Init(void)
 	EPD_WriteData(0x32);				//VSL
 	
 	EPD_WriteCommand(0x32);
-	uint8_t i;
 	for( i=0;i<224;i++)
 	{
 		EPD_WriteData(0xFF);
@@ -298,6 +342,20 @@ void EPD_Init(void)
 
 }
 
+/**
+  * 函    数：MCU从待机模式唤醒后恢复EPD
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：代替EPD_Init，用于MCU待机（STANDBY）唤醒后的复位
+  *           MCU待机期间EPD保持供电，控制器的配置与RAM中的图像都还在，只需重新配置引脚
+  *           不等待上电稳定、不复位EPD、不重新写入配置与波形，也不需要清屏与全屏更新
+  *           此时显存数组已被清零，调用者应只用局部更新发送重新画过的区域
+  */
+void EPD_Resume(void)
+{
+	EPD_GPIO_Init();
+}
+
 void EPD_DisplaySet(uint8_t XStart,uint8_t XStop,uint8_t XCount,
 					uint8_t YStart,uint8_t YStop,uint8_t YCount,uint8_t Mode)
 {
@@ -414,6 +472,114 @@ uint8_t EPD_IsInAngle(int16_t X, int16_t Y, int16_t StartAngle, int16_t EndAngle
 	return 0;		//不满足以上条件，则判断判定指定点不在指定角度
 }
 
+/**
+  * 函    数：解码字符串中的一个字符
+  * 参    数：String 指向字符的首字节
+  * 参    数：Code 用于返回字符编码，UTF-8格式下为Unicode码点，GB2312格式下为两字节内码
+  * 返 回 值：该字符占用的字节数，遇到不完整或非法的编码时，返回已检查的字节数，Code为0xFFFD
+  * 说    明：ASCII字符占用1个字节，编码格式由EPD_CHN_CHAR_WIDTH决定
+  */
+uint8_t EPD_DecodeChar(const char *String, uint32_t *Code)
+{
+	uint8_t Byte = String[0];
+#if EPD_CHN_CHAR_WIDTH == 3
+	uint8_t Length, i;
+#endif
+	
+	if (Byte < 0x80)						//ASCII字符
+	{
+		*Code = Byte;
+		return 1;
+	}
+	
+#if EPD_CHN_CHAR_WIDTH == 3
+	/*UTF-8格式，由首字节确定长度*/
+	if ((Byte & 0xE0) == 0xC0)		{Length = 2; *Code = Byte & 0x1F;}
+	else if ((Byte & 0xF0) == 0xE0)	{Length = 3; *Code = Byte & 0x0F;}
+	else if ((Byte & 0xF8) == 0xF0)	{Length = 4; *Code = Byte & 0x07;}
+	else							//孤立的后续字节或非法首字节
+	{
+		*Code = 0xFFFD;
+		return 1;
+	}
+	
+	for (i = 1; i < Length; i ++)
+	{
+		Byte = String[i];
+		if ((Byte & 0xC0) != 0x80)	//后续字节不足，不越过字符串结尾
+		{
+			*Code = 0xFFFD;
+			return i;
+		}
+		*Code = (*Code << 6) | (Byte & 0x3F);
+	}
+	return Length;
+#else
+	/*GB2312格式，高位为1的字节与下一字节组成一个汉字*/
+	if (String[1] == '\0')			//后续字节缺失，不越过字符串结尾
+	{
+		*Code = 0xFFFD;
+		return 1;
+	}
+	*Code = ((uint32_t)Byte << 8) | (uint8_t)String[1];
+	return 2;
+#endif
+}
+
+/**
+  * 函    数：在汉字字模库中查找指定汉字
+  * 参    数：Code 汉字编码，由EPD_DecodeChar得到
+  * 返 回 值：汉字在EPD_CF16x16中的索引，未找到时返回默认图形的索引
+  * 说    明：字模库按编码从小到大排列，使用二分查找，5000个汉字最多比较13次
+  */
+uint16_t EPD_FindChinese(uint32_t Code)
+{
+	uint16_t Low = 0, High = EPD_CF16x16_Num, Mid;
+	uint32_t MidCode;
+	
+	while (Low < High)
+	{
+		Mid = (Low + High) / 2;
+		EPD_DecodeChar(EPD_CF16x16[Mid].Index, &MidCode);
+		if (MidCode < Code)
+		{
+			Low = Mid + 1;
+		}
+		else if (MidCode > Code)
+		{
+			High = Mid;
+		}
+		else
+		{
+			return Mid;
+		}
+	}
+	return EPD_CF16x16_Num;		//未找到，返回末尾的默认图形
+}
+
+/*格式化打印的光标，供EPD_PrintfPut逐字符显示使用*/
+typedef struct
+{
+	int16_t X;
+	int16_t Y;
+	uint8_t FontSize;
+} EPD_Cursor_t;
+
+/**
+  * 函    数：格式化打印的字符输出函数
+  * 参    数：Char 要显示的字符
+  * 参    数：Arg 光标，类型为EPD_Cursor_t *
+  * 返 回 值：无
+  * 说    明：由Format_Stream逐字符调用，显示后光标右移一个字符宽度
+  */
+static void EPD_PrintfPut(char Char, void *Arg)
+{
+	EPD_Cursor_t *Cursor = Arg;
+	
+	EPD_ShowChar(Cursor->X, Cursor->Y, Char, Cursor->FontSize);
+	Cursor->X += Cursor->FontSize;
+}
+
 /*********************工具函数*/
 
 /**
@@ -424,12 +590,60 @@ uint8_t EPD_IsInAngle(int16_t X, int16_t Y, int16_t StartAngle, int16_t EndAngle
   *           随后调用EPD_Update函数或EPD_UpdateArea函数
   *           才会将显存数组的数据发送到EPD硬件，进行显示
   *           故调用显示函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  *           此函数等待刷新完成后才返回（约2秒），不想等待时改用EPD_UpdateStart
   */
 void EPD_Update(void)
 {
+	TRACE_BEGIN(TRACE_EPD_UPDATE);
+	EPD_UpdateStart();
+	EPD_UpdateFinish();
+	TRACE_END(TRACE_EPD_UPDATE);
+}
+
+/**
+  * 函    数：将EPD显存数组部分更新到EPD屏幕
+  * 参    数：X 指定区域左上角的横坐标，范围：-32768~32767，屏幕区域：0~247
+  * 参    数：Y 指定区域左上角的纵坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：Width 指定区域的宽度，范围：0~248
+  * 参    数：Height 指定区域的高度，范围：0~128
+  * 返 回 值：无
+  * 说    明：只把指定区域所在的RAM窗口发送到EPD，传输量与区域面积成正比
+  *           如果更新区域Y轴只包含部分页，则同一页的剩余部分会跟随一起更新
+  *           刷新波形与EPD_Update相同，区域外的RAM保持上次发送的内容
+  *           此函数等待刷新完成后才返回，不想等待时改用EPD_UpdateAreaStart
+  * 说    明：所有的显示函数，都只是对EPD显存数组进行读写
+  *           随后调用EPD_Update函数或EPD_UpdateArea函数
+  *           才会将显存数组的数据发送到EPD硬件，进行显示
+  *           故调用显示函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void EPD_UpdateArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
+{
+	TRACE_BEGIN(TRACE_EPD_AREA);
+	EPD_UpdateAreaStart(X, Y, Width, Height);
+	EPD_UpdateFinish();
+	TRACE_END(TRACE_EPD_AREA);
+}
+
+/**
+  * 函    数：发送EPD显存数组并开始全屏刷新，不等待刷新完成
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：发送数据并发出刷新命令后立即返回，之后BUSY为高，约2秒后变低
+  *           刷新期间不能再与EPD通信，BUSY变低后调用EPD_UpdateFinish结束本次刷新
+  *           BUSY的下降沿可经EXTI第5线产生中断，刷新期间MCU可以休眠
+  *           上一次刷新未结束时，先等待它结束
+  */
+void EPD_UpdateStart(void)
+{
+	uint16_t Page, X;
+	
+	EPD_UpdateFinish();
+	
+	TRACE_BEGIN(TRACE_EPD_SETUP);
 	EPD_DisplaySet(0,15,15,0,247,247,7);
-	EPD_WriteCommand(0x24);	//黑白RAM
-	uint16_t Page,X;
+	EPD_WriteCommand(0x24);			//黑白RAM
+	TRACE_END(TRACE_EPD_SETUP);
+	TRACE_BEGIN(TRACE_EPD_SEND);
 	for(Page=0;Page<16;Page++)
 	{
 		for(X=0;X<248;X++)
@@ -437,10 +651,84 @@ void EPD_Update(void)
 			EPD_WriteData(EPD_DisplayBuf[Page][X]);
 		}
 	}
+	TRACE_END(TRACE_EPD_SEND);
 	EPD_WriteCommand(0x22);			//设置更新
 	EPD_WriteData(0xF7);			//选择模式一
 	EPD_WriteCommand(0x20);
+	EPD_Refreshing = 1;
+}
+
+/**
+  * 函    数：发送EPD显存数组的指定区域并开始刷新，不等待刷新完成
+  * 参    数：X 指定区域左上角的横坐标，范围：-32768~32767，屏幕区域：0~247
+  * 参    数：Y 指定区域左上角的纵坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：Width 指定区域的宽度，范围：0~248
+  * 参    数：Height 指定区域的高度，范围：0~128
+  * 返 回 值：1：已开始刷新，0：区域完全在屏幕外，没有发送
+  * 说    明：发送的数据与EPD_UpdateArea相同，刷新的结束方式与EPD_UpdateStart相同
+  */
+uint8_t EPD_UpdateAreaStart(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
+{
+	int16_t X1 = X + Width - 1, Y1 = Y + Height - 1;
+	int16_t Page, Page1, i;
+	
+	/*裁剪到屏幕范围内*/
+	if (X < 0) {X = 0;}
+	if (Y < 0) {Y = 0;}
+	if (X1 > 247) {X1 = 247;}
+	if (Y1 > 127) {Y1 = 127;}
+	if (X > X1 || Y > Y1) {return 0;}
+	
+	EPD_UpdateFinish();
+	
+	/*显存第0页位于屏幕最下方，区域底端所在的页为起始页*/
+	Page = 15 - Y1 / 8;
+	Page1 = 15 - Y / 8;
+	
+	/*RAM窗口的X为页，Y为列，光标置于窗口起点*/
+	TRACE_BEGIN(TRACE_EPD_SETUP);
+	EPD_DisplaySet(Page, Page1, Page, X, X1, X, 7);
+	EPD_WriteCommand(0x24);			//黑白RAM
+	TRACE_END(TRACE_EPD_SETUP);
+	TRACE_BEGIN(TRACE_EPD_SEND);
+	for (; Page <= Page1; Page ++)
+	{
+		for (i = X; i <= X1; i ++)
+		{
+			EPD_WriteData(EPD_DisplayBuf[Page][i]);
+		}
+	}
+	TRACE_END(TRACE_EPD_SEND);
+	EPD_WriteCommand(0x22);			//设置更新
+	EPD_WriteData(0xF7);			//选择模式一
+	EPD_WriteCommand(0x20);
+	EPD_Refreshing = 1;
+	return 1;
+}
+
+/**
+  * 函    数：获取刷新是否仍在进行
+  * 参    数：无
+  * 返 回 值：1：已开始的刷新还未完成（BUSY为高），0：没有正在进行的刷新，或BUSY已变低
+  * 说    明：只读一次BUSY引脚，不等待
+  */
+uint8_t EPD_IsBusy(void)
+{
+	return EPD_Refreshing && EPD_R_BUSY();
+}
+
+/**
+  * 函    数：结束一次刷新
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：等待BUSY变低并延时10ms，之后才能再次与EPD通信
+  *           在BUSY变低后调用时只有这10ms的延时，没有正在进行的刷新时立即返回
+  */
+void EPD_UpdateFinish(void)
+{
+	if (!EPD_Refreshing) {return;}
 	EPD_WaitBusy();
+	EPD_Refreshing = 0;
 }
 
 /**
@@ -471,18 +759,8 @@ void EPD_Clear(void)
   */
 void EPD_ClearArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
 {
-	int16_t i, j;
-	
-	for (j = Y; j < Y + Height; j ++)		//遍历指定页
-	{
-		for (i = X; i < X + Width; i ++)	//遍历指定列
-		{
-			if (i >= 0 && i <=247 && j >=0 && j <= 127)				//超出屏幕的内容不显示
-			{
-				EPD_DisplayBuf[j / 8][i] &= ~(0x01 << (j % 8));	//将显存数组指定数据清零0x01
-			}
-		}
-	}
+	/*按EPD画布的坐标清零，第0页位于屏幕最下方*/
+	Canvas_FillRect(&EPD_Canvas, X, Y, Width, Height, 0);
 }
 
 /**
@@ -494,9 +772,9 @@ void EPD_ClearArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
 void EPD_Reverse(void)
 {
 	uint8_t i, j;
-	for (j = 0; j < 16; j ++)				//遍历8页
+	for (j = 0; j < 16; j ++)				//遍历16页
 	{
-		for (i = 0; i < 247; i ++)			//遍历128列
+		for (i = 0; i < 248; i ++)			//遍历248列
 		{
 			EPD_DisplayBuf[j][i] ^= 0xFF;	//将显存数组数据全部取反
 		}
@@ -505,10 +783,10 @@ void EPD_Reverse(void)
 	
 /**
   * 函    数：将EPD显存数组部分取反
-  * 参    数：X 指定区域左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
-  * 参    数：Y 指定区域左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
-  * 参    数：Width 指定区域的宽度，范围：0~128
-  * 参    数：Height 指定区域的高度，范围：0~64
+  * 参    数：X 指定区域左上角的横坐标，范围：-32768~32767，屏幕区域：0~247
+  * 参    数：Y 指定区域左上角的纵坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：Width 指定区域的宽度，范围：0~248
+  * 参    数：Height 指定区域的高度，范围：0~128
   * 返 回 值：无
   * 说    明：调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
   */
@@ -522,7 +800,7 @@ void EPD_ReverseArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
 		{
 			if (i >= 0 && i <= 247 && j >=0 && j <= 127)			//超出屏幕的内容不显示
 			{
-				EPD_DisplayBuf[j / 8][i] ^= 0x01 << (j % 8);	//将显存数组指定数据取反
+				Canvas_GetPage(&EPD_Canvas, j)[i] ^= 0x01 << (j % 8);	//将显存数组指定数据取反，第0页位于屏幕最下方
 			}
 		}
 	}
@@ -538,48 +816,14 @@ void EPD_ReverseArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
   * 参    数：Image 指定要显示的图像
   * 返 回 值：无
   * 说    明：调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  *           图像按EPD画布的坐标写入，图像所在区域被整体覆盖，与EPD_ShowZoomChar等放大显示的位置一致
   */
 void EPD_ShowImage(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image)
 {
-	uint8_t i = 0, j = 0;
-	int16_t Page, Shift;
-	X=X;
-	Y=128-Y-Height;
-	/*将图像所在区域清空*/
-	EPD_ClearArea(X, Y, Width, Height);
-	
-	/*遍历指定图像涉及的相关页*/
-	/*(Height - 1) / 8 + 1的目的是Height / 8并向上取整*/
-	for (j = 0; j < (Height - 1) / 8 + 1; j ++)
-	{
-		/*遍历指定图像涉及的相关列*/
-		for (i = 0; i < Width; i ++)
-		{
-			if (X + i >= 0 && X + i <= 248)		//超出屏幕的内容不显示
-			{
-				/*负数坐标在计算页地址和移位时需要加一个偏移*/
-				Page = Y / 8;
-				Shift = Y % 8;
-				if (Y < 0)
-				{
-					Page -= 1;
-					Shift += 8;
-				}
-				
-				if (Page - j >= 0 && Page - j <= 16)		//超出屏幕的内容不显示
-				{
-					/*显示图像在当前页的内容*/
-					EPD_DisplayBuf[Page - j][X + i] |= Image[j * Width + i] << (Shift);
-				}
-				
-				if (Page - j - 1 >= 0 && Page - j - 1 <= 16)		//超出屏幕的内容不显示
-				{					
-					/*显示图像在下一页的内容*/
-					EPD_DisplayBuf[Page - j - 1][X + i] |= Image[j * Width + i] >> (8 - Shift);
-				}
-			}
-		}
-	}
+	TRACE_BEGIN(TRACE_EPD_IMAGE);
+	/*图像按列写入，区域内原有内容被覆盖，不需要先清空*/
+	Canvas_DrawZoomImage(&EPD_Canvas, X, Y, Width, Height, Image, 1);
+	TRACE_END(TRACE_EPD_IMAGE);
 }
 
 
@@ -622,12 +866,61 @@ void EPD_ShowChar(int16_t X, int16_t Y, char Char, uint8_t FontSize)
   */
 void EPD_ShowString(int16_t X, int16_t Y, char *String, uint8_t FontSize)
 {
-	uint8_t i;
+	uint16_t i;
+	TRACE_BEGIN(TRACE_EPD_STRING);
 	for (i = 0; String[i] != '\0'; i++)		//遍历字符串的每个字符
 	{
 		/*调用EPD_ShowChar函数，依次显示每个字符*/
 		EPD_ShowChar(X + i * FontSize, Y, String[i], FontSize);
 	}
+	TRACE_END(TRACE_EPD_STRING);
+}
+
+/**
+  * 函    数：EPD放大显示一个字符
+  * 参    数：X 指定字符左上角的横坐标，范围：-32768~32767，屏幕区域：0~247
+  * 参    数：Y 指定字符左上角的纵坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：Char 指定要显示的字符，范围：ASCII码可见字符
+  * 参    数：FontSize 指定字体大小
+  *           范围：EPD_8X16		宽8像素，高16像素
+  *                 EPD_6X8		宽6像素，高8像素
+  * 参    数：Zoom 放大倍数，范围：1~4，显示的字符宽高均为原来的Zoom倍
+  * 返 回 值：无
+  * 说    明：直接由EPD_F8x16与EPD_F6x8的字模查表放大，不需要额外的大字体字模
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void EPD_ShowZoomChar(int16_t X, int16_t Y, char Char, uint8_t FontSize, uint8_t Zoom)
+{
+	if (FontSize == EPD_8X16)		//字体为宽8像素，高16像素
+	{
+		Canvas_DrawZoomImage(&EPD_Canvas, X, Y, 8, 16, EPD_F8x16[Char - ' '], Zoom);
+	}
+	else if (FontSize == EPD_6X8)	//字体为宽6像素，高8像素
+	{
+		Canvas_DrawZoomImage(&EPD_Canvas, X, Y, 6, 8, EPD_F6x8[Char - ' '], Zoom);
+	}
+}
+
+/**
+  * 函    数：EPD放大显示字符串
+  * 参    数：X 指定字符串左上角的横坐标，范围：-32768~32767，屏幕区域：0~247
+  * 参    数：Y 指定字符串左上角的纵坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：String 指定要显示的字符串，范围：ASCII码可见字符组成的字符串
+  * 参    数：FontSize 指定字体大小
+  *           范围：EPD_8X16		宽8像素，高16像素
+  *                 EPD_6X8		宽6像素，高8像素
+  * 参    数：Zoom 放大倍数，范围：1~4
+  * 返 回 值：无
+  * 说    明：每个字符的横向间隔为FontSize * Zoom
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void EPD_ShowZoomString(int16_t X, int16_t Y, char *String, uint8_t FontSize, uint8_t Zoom)
+{
+	uint16_t i;
+	for (i = 0; String[i] != '\0'; i++)		//遍历字符串的每个字符
+	{
+		EPD_ShowZoomChar(X + i * FontSize * Zoom, Y, String[i], FontSize, Zoom);
+	}
 }
 
 /**
@@ -635,7 +928,7 @@ void EPD_ShowString(int16_t X, int16_t Y, char *String, uint8_t FontSize)
   * 参    数：X 指定数字左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
   * 参    数：Y 指定数字左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
   * 参    数：Number 指定要显示的数字，范围：0~4294967295
-  * 参    数：Length 指定数字的长度，范围：0~10
+  * 参    数：Length 指定数字的长度，范围：0~255，超过10位时高位显示0
   * 参    数：FontSize 指定字体大小
   *           范围：EPD_8X16		宽8像素，高16像素
   *                 EPD_6X8		宽6像素，高8像素
@@ -644,14 +937,19 @@ void EPD_ShowString(int16_t X, int16_t Y, char *String, uint8_t FontSize)
   */
 void EPD_ShowNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize)
 {
-	uint8_t i;
-	for (i = 0; i < Length; i++)		//遍历数字的每一位							
+	char String[11];
+	
+	/*超出缓冲区的高位全部为0，先逐个显示前导0*/
+	while (Length > 10)
 	{
-		/*调用EPD_ShowChar函数，依次显示每个数字*/
-		/*Number / EPD_Pow(10, Length - i - 1) % 10 可以十进制提取数字的每一位*/
-		/*+ '0' 可将数字转换为字符格式*/
-		EPD_ShowChar(X + i * FontSize, Y, Number / EPD_Pow(10, Length - i - 1) % 10 + '0', FontSize);
+		EPD_ShowChar(X, Y, '0', FontSize);
+		X += FontSize;
+		Length --;
 	}
+	
+	/*逐位提取数字并转换为字符，再作为字符串一次显示*/
+	Format_Dec(String, Number, Length);
+	EPD_ShowString(X, Y, String, FontSize);
 }
 
 /**
@@ -659,7 +957,7 @@ void EPD_ShowNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t
   * 参    数：X 指定数字左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
   * 参    数：Y 指定数字左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
   * 参    数：Number 指定要显示的数字，范围：-2147483648~2147483647
-  * 参    数：Length 指定数字的长度，范围：0~10
+  * 参    数：Length 指定数字的长度，范围：0~255，超过10位时高位显示0
   * 参    数：FontSize 指定字体大小
   *           范围：EPD_8X16		宽8像素，高16像素
   *                 EPD_6X8		宽6像素，高8像素
@@ -668,7 +966,7 @@ void EPD_ShowNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t
   */
 void EPD_ShowSignedNum(int16_t X, int16_t Y, int32_t Number, uint8_t Length, uint8_t FontSize)
 {
-	uint8_t i;
+	char String[11];
 	uint32_t Number1;
 	
 	if (Number >= 0)						//数字大于等于0
@@ -679,16 +977,21 @@ void EPD_ShowSignedNum(int16_t X, int16_t Y, int32_t Number, uint8_t Length, uin
 	else									//数字小于0
 	{
 		EPD_ShowChar(X, Y, '-', FontSize);	//显示-号
-		Number1 = -Number;					//Number1等于Number取负
+		Number1 = 0 - (uint32_t)Number;		//Number1等于Number取负
 	}
+	X += FontSize;
 	
-	for (i = 0; i < Length; i++)			//遍历数字的每一位								
+	/*超出缓冲区的高位全部为0，先逐个显示前导0*/
+	while (Length > 10)
 	{
-		/*调用EPD_ShowChar函数，依次显示每个数字*/
-		/*Number1 / EPD_Pow(10, Length - i - 1) % 10 可以十进制提取数字的每一位*/
-		/*+ '0' 可将数字转换为字符格式*/
-		EPD_ShowChar(X + (i + 1) * FontSize, Y, Number1 / EPD_Pow(10, Length - i - 1) % 10 + '0', FontSize);
+		EPD_ShowChar(X, Y, '0', FontSize);
+		X += FontSize;
+		Length --;
 	}
+	
+	/*符号之后逐位提取数字，再作为字符串一次显示*/
+	Format_Dec(String, Number1, Length);
+	EPD_ShowString(X, Y, String, FontSize);
 }
 
 /**
@@ -696,7 +999,7 @@ void EPD_ShowSignedNum(int16_t X, int16_t Y, int32_t Number, uint8_t Length, uin
   * 参    数：X 指定数字左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
   * 参    数：Y 指定数字左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
   * 参    数：Number 指定要显示的数字，范围：0x00000000~0xFFFFFFFF
-  * 参    数：Length 指定数字的长度，范围：0~8
+  * 参    数：Length 指定数字的长度，范围：0~255，超过8位时高位显示0
   * 参    数：FontSize 指定字体大小
   *           范围：EPD_8X16		宽8像素，高16像素
   *                 EPD_6X8		宽6像素，高8像素
@@ -705,25 +1008,19 @@ void EPD_ShowSignedNum(int16_t X, int16_t Y, int32_t Number, uint8_t Length, uin
   */
 void EPD_ShowHexNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize)
 {
-	uint8_t i, SingleNumber;
-	for (i = 0; i < Length; i++)		//遍历数字的每一位
+	char String[9];
+	
+	/*超出缓冲区的高位全部为0，先逐个显示前导0*/
+	while (Length > 8)
 	{
-		/*以十六进制提取数字的每一位*/
-		SingleNumber = Number / EPD_Pow(16, Length - i - 1) % 16;
-		
-		if (SingleNumber < 10)			//单个数字小于10
-		{
-			/*调用EPD_ShowChar函数，显示此数字*/
-			/*+ '0' 可将数字转换为字符格式*/
-			EPD_ShowChar(X + i * FontSize, Y, SingleNumber + '0', FontSize);
-		}
-		else							//单个数字大于10
-		{
-			/*调用EPD_ShowChar函数，显示此数字*/
-			/*+ 'A' 可将数字转换为从A开始的十六进制字符*/
-			EPD_ShowChar(X + i * FontSize, Y, SingleNumber - 10 + 'A', FontSize);
-		}
+		EPD_ShowChar(X, Y, '0', FontSize);
+		X += FontSize;
+		Length --;
 	}
+	
+	/*以十六进制逐位提取数字，每位取4个Bit*/
+	Format_Hex(String, Number, Length);
+	EPD_ShowString(X, Y, String, FontSize);
 }
 
 /**
@@ -731,7 +1028,7 @@ void EPD_ShowHexNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8
   * 参    数：X 指定数字左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
   * 参    数：Y 指定数字左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
   * 参    数：Number 指定要显示的数字，范围：0x00000000~0xFFFFFFFF
-  * 参    数：Length 指定数字的长度，范围：0~16
+  * 参    数：Length 指定数字的长度，范围：0~255，超过32位时高位显示0
   * 参    数：FontSize 指定字体大小
   *           范围：EPD_8X16		宽8像素，高16像素
   *                 EPD_6X8		宽6像素，高8像素
@@ -740,14 +1037,19 @@ void EPD_ShowHexNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8
   */
 void EPD_ShowBinNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize)
 {
-	uint8_t i;
-	for (i = 0; i < Length; i++)		//遍历数字的每一位	
+	char String[33];
+	
+	/*超出缓冲区的高位全部为0，先逐个显示前导0*/
+	while (Length > 32)
 	{
-		/*调用EPD_ShowChar函数，依次显示每个数字*/
-		/*Number / EPD_Pow(2, Length - i - 1) % 2 可以二进制提取数字的每一位*/
-		/*+ '0' 可将数字转换为字符格式*/
-		EPD_ShowChar(X + i * FontSize, Y, Number / EPD_Pow(2, Length - i - 1) % 2 + '0', FontSize);
+		EPD_ShowChar(X, Y, '0', FontSize);
+		X += FontSize;
+		Length --;
 	}
+	
+	/*以二进制逐位提取数字，每位取1个Bit*/
+	Format_Bin(String, Number, Length);
+	EPD_ShowString(X, Y, String, FontSize);
 }
 
 /**
@@ -794,50 +1096,132 @@ void EPD_ShowFloatNum(int16_t X, int16_t Y, double Number, uint8_t IntLength, ui
 	EPD_ShowNum(X + (IntLength + 2) * FontSize, Y, FraNum, FraLength, FontSize);
 }
 
+/**
+  * 函    数：EPD显示定点数字（Q16.16，小数）
+  * 参    数：X 指定数字左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：Y 指定数字左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
+  * 参    数：Number 指定要显示的Q16.16定点数，即实际值乘以65536，范围：-32768.0~32767.99998
+  *           浮点数可先用Format_FloatToQ16转换，全程不使用软件浮点运算
+  * 参    数：IntLength 指定数字的整数位长度，范围：0~10
+  * 参    数：FraLength 指定数字的小数位长度，范围：0~4，小数进行四舍五入显示
+  * 参    数：FontSize 指定字体大小
+  *           范围：EPD_8X16		宽8像素，高16像素
+  *                 EPD_6X8		宽6像素，高8像素
+  * 返 回 值：无
+  * 说    明：显示格式和四舍五入方式与EPD_ShowFloatNum一致
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void EPD_ShowFixedNum(int16_t X, int16_t Y, int32_t Number, uint8_t IntLength, uint8_t FraLength, uint8_t FontSize)
+{
+	char String[22];
+	
+	if (IntLength > 10) {IntLength = 10;}
+	
+	Format_Q16(String, Number, IntLength, FraLength);
+	EPD_ShowString(X, Y, String, FontSize);
+}
+
+/**
+  * 函    数：EPD显示缩放整数（十进制，小数）
+  * 参    数：X 指定数字左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：Y 指定数字左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
+  * 参    数：Number 指定要显示的缩放整数，实际值为Number / 10^Scale，范围：-2147483648~2147483647
+  * 参    数：Scale 缩放的小数位数，范围：0~9，例如传感器以0.01为单位时给2
+  * 参    数：IntLength 指定数字的整数位长度，范围：0~10
+  * 参    数：FraLength 指定数字的小数位长度，范围：0~9，少于Scale时四舍五入显示
+  * 参    数：FontSize 指定字体大小
+  *           范围：EPD_8X16		宽8像素，高16像素
+  *                 EPD_6X8		宽6像素，高8像素
+  * 返 回 值：无
+  * 说    明：显示格式与EPD_ShowFloatNum一致
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void EPD_ShowScaledNum(int16_t X, int16_t Y, int32_t Number, uint8_t Scale, uint8_t IntLength, uint8_t FraLength, uint8_t FontSize)
+{
+	char String[22];
+	
+	if (IntLength > 10) {IntLength = 10;}
+	
+	Format_Scaled(String, Number, Scale, IntLength, FraLength);
+	EPD_ShowString(X, Y, String, FontSize);
+}
+
 /**
   * 函    数：EPD显示汉字串
   * 参    数：X 指定汉字串左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
   * 参    数：Y 指定汉字串左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
-  * 参    数：Chinese 指定要显示的汉字串，范围：必须全部为汉字或者全角字符，不要加入任何半角字符
+  * 参    数：Chinese 指定要显示的汉字串，范围：汉字、全角字符与ASCII码可见字符可以混合
   *           显示的汉字需要在EPD_Data.c里的EPD_CF16x16数组定义
   *           未找到指定汉字时，会显示默认图形（一个方框，内部一个问号）
+  *           ASCII字符以EPD_8X16字体显示，宽8像素，汉字宽16像素
   * 返 回 值：无
   * 说    明：调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
   */
 void EPD_ShowChinese(int16_t X, int16_t Y, char *Chinese)
 {
-	uint8_t pChinese = 0;
-	uint8_t pIndex;
-	uint8_t i;
-	char SingleChinese[EPD_CHN_CHAR_WIDTH + 1] = {0};
+	uint32_t Code;
 	
-	for (i = 0; Chinese[i] != '\0'; i ++)		//遍历汉字串
+	while (*Chinese != '\0')					//遍历汉字串
 	{
-		SingleChinese[pChinese] = Chinese[i];	//提取汉字串数据到单个汉字数组
-		pChinese ++;							//计次自增
+		/*解码一个字符，并移动到下一个字符*/
+		Chinese += EPD_DecodeChar(Chinese, &Code);
 		
-		/*当提取次数到达EPD_CHN_CHAR_WIDTH时，即代表提取到了一个完整的汉字*/
-		if (pChinese >= EPD_CHN_CHAR_WIDTH)
+		if (Code < 0x80)						//ASCII字符
 		{
-			pChinese = 0;		//计次归零
-			
-			/*遍历整个汉字字模库，寻找匹配的汉字*/
-			/*如果找到最后一个汉字（定义为空字符串），则表示汉字未在字模库定义，停止寻找*/
-			for (pIndex = 0; strcmp(EPD_CF16x16[pIndex].Index, "") != 0; pIndex ++)
+			if (Code >= ' ' && Code <= '~')		//只显示可见字符
 			{
-				/*找到匹配的汉字*/
-				if (strcmp(EPD_CF16x16[pIndex].Index, SingleChinese) == 0)
-				{
-					break;		//跳出循环，此时pIndex的值为指定汉字的索引
-				}
+				EPD_ShowChar(X, Y, Code, EPD_8X16);
+				X += 8;
 			}
-			
+		}
+		else									//汉字或全角字符
+		{
 			/*将汉字字模库EPD_CF16x16的指定数据以16*16的图像格式显示*/
-			EPD_ShowImage(X + ((i + 1) / EPD_CHN_CHAR_WIDTH - 1) * 16, Y, 16, 16, EPD_CF16x16[pIndex].Data);
+			EPD_ShowImage(X, Y, 16, 16, EPD_CF16x16[EPD_FindChinese(Code)].Data);
+			X += 16;
 		}
 	}
 }
 
+/**
+  * 函    数：EPD获取字符串开头汉字的字模
+  * 参    数：String 指向汉字的第一个字节
+  * 参    数：Length 返回该汉字占用的字节数
+  * 返 回 值：16*16的字模数据，格式与EPD_ShowImage一致，未找到时返回默认图形
+  * 说    明：供文字排版模块使用，见Text_Layout
+  */
+const uint8_t *EPD_GetChinese(const char *String, uint8_t *Length)
+{
+	uint32_t Code;
+	
+	*Length = EPD_DecodeChar(String, &Code);
+	return EPD_CF16x16[EPD_FindChinese(Code)].Data;
+}
+
+/**
+  * 函    数：EPD使用printf函数打印格式化字符串
+  * 参    数：X 指定格式化字符串左上角的横坐标，范围：-32768~32767，屏幕区域：0~247
+  * 参    数：Y 指定格式化字符串左上角的纵坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：FontSize 指定字体大小
+  *           范围：EPD_8X16		宽8像素，高16像素
+  *                 EPD_6X8		宽6像素，高8像素
+  * 参    数：format 指定要显示的格式化字符串，范围：ASCII码可见字符组成的字符串
+  *           支持%d %i %u %x %X %c %s %%与定点小数%f，详见Format_Stream
+  * 参    数：... 格式化字符串参数列表
+  * 返 回 值：无
+  * 说    明：格式化的结果逐字符直接显示，不经过中间字符数组，输出长度不受限制
+  *           %f的参数为Q16.16定点数，不是浮点数，可由Format_FloatToQ16转换得到
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void EPD_Printf(int16_t X, int16_t Y, uint8_t FontSize, char *format, ...)
+{
+	EPD_Cursor_t Cursor = {X, Y, FontSize};	//定义光标，从指定位置开始显示
+	va_list arg;							//定义可变参数列表数据类型的变量arg
+	va_start(arg, format);					//从format开始，接收参数列表到arg变量
+	Format_Stream(EPD_PrintfPut, &Cursor, format, arg);		//边格式化边显示
+	va_end(arg);							//结束变量arg
+}
+
 // /*测试函数*********************/
 // const uint8_t EPD_TestArr[]={
 // 0xFF,0x80,0x87,0x88,0x92,0xA4,0xA2,0xA0,0xA2,0xA4,0x92,0x88,0x87,0x80,0xFF,
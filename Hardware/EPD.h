@@ -18,8 +18,14 @@
 
 
 void EPD_Init(void);
+void EPD_Resume(void);
 
 void EPD_Update(void);
+void EPD_UpdateArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
+void EPD_UpdateStart(void);
+uint8_t EPD_UpdateAreaStart(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
+uint8_t EPD_IsBusy(void);
+void EPD_UpdateFinish(void);
 void EPD_Clear(void);
 void EPD_Reverse(void);
 
@@ -28,12 +34,18 @@ void EPD_Test_Image(uint8_t X,uint8_t Y,uint8_t Width,uint8_t Height,const uint8
 
 void EPD_ShowChar(int16_t X, int16_t Y, char Char, uint8_t FontSize);
 void EPD_ShowString(int16_t X, int16_t Y, char *String, uint8_t FontSize);
+void EPD_ShowZoomChar(int16_t X, int16_t Y, char Char, uint8_t FontSize, uint8_t Zoom);
+void EPD_ShowZoomString(int16_t X, int16_t Y, char *String, uint8_t FontSize, uint8_t Zoom);
 void EPD_ShowNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize);
 void EPD_ShowSignedNum(int16_t X, int16_t Y, int32_t Number, uint8_t Length, uint8_t FontSize);
 void EPD_ShowHexNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize);
 void EPD_ShowBinNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize);
 void EPD_ShowFloatNum(int16_t X, int16_t Y, double Number, uint8_t IntLength, uint8_t FraLength, uint8_t FontSize);
+void EPD_ShowFixedNum(int16_t X, int16_t Y, int32_t Number, uint8_t IntLength, uint8_t FraLength, uint8_t FontSize);
+void EPD_ShowScaledNum(int16_t X, int16_t Y, int32_t Number, uint8_t Scale, uint8_t IntLength, uint8_t FraLength, uint8_t FontSize);
 void EPD_ShowChinese(int16_t X, int16_t Y, char *Chinese);
+const uint8_t *EPD_GetChinese(const char *String, uint8_t *Length);
 void EPD_ShowImage(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image);
+void EPD_Printf(int16_t X, int16_t Y, uint8_t FontSize, char *format, ...);
 
 #endif
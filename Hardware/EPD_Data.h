@@ -18,6 +18,7 @@ extern const uint8_t EPD_F8x16[][16];
 extern const uint8_t EPD_F6x8[][6];
 /*汉字字模数据声明*/
 extern const ChineseCell_t EPD_CF16x16[];
+extern const uint16_t EPD_CF16x16_Num;
 
 /*图像数据声明*/
 extern const uint8_t Diode[];
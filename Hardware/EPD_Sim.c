@@ -0,0 +1,392 @@
+#include "EPD_Sim.h"
+
+#ifdef EPD_SIM
+
+#include <string.h>
+
+/*全局变量*********************/
+
+uint8_t EPD_Sim_Ram[2][EPD_SIM_RAM_X][EPD_SIM_RAM_Y];
+uint8_t EPD_Sim_Panel[EPD_SIM_RAM_X][EPD_SIM_RAM_Y];
+
+const Canvas_t EPD_Sim_Canvas = {EPD_Sim_Panel[0], EPD_SIM_RAM_Y, EPD_SIM_RAM_X * 8, 1};
+
+static EPD_SimState_t EPD_Sim_State;
+
+/*引脚电平，与EPD_GPIO_Init置的默认电平一致，全部为高*/
+static uint8_t EPD_Sim_Level[5] = {1, 1, 1, 1, 1};
+
+/*SPI移位寄存器*/
+static uint8_t EPD_Sim_Shift;
+static uint8_t EPD_Sim_BitCount;
+
+/*当前命令及其已收到的参数个数*/
+static uint8_t EPD_Sim_Command;
+static uint16_t EPD_Sim_Param;
+
+/*模拟时钟，单位ns，引脚写入、读BUSY与延时使其前进*/
+static uint64_t EPD_Sim_Clock;
+
+/*BUSY保持为高直到模拟时钟到达此时刻*/
+static uint64_t EPD_Sim_BusyUntil;
+
+/*刷新命令已收到，等待读到BUSY变低后结束本次更新的统计*/
+static uint8_t EPD_Sim_Pending;
+
+/*本次更新开始时的模拟时钟*/
+static uint64_t EPD_Sim_Start;
+
+/*本次更新、上次更新与累计的统计*/
+static EPD_SimStats_t EPD_Sim_Current, EPD_Sim_Last, EPD_Sim_Total;
+
+/*********************全局变量*/
+
+
+/*工具函数*********************/
+
+/*工具函数仅供内部部分函数使用*/
+
+/**
+  * 函    数：控制器复位
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：硬件复位（RES拉低）与软件复位（命令0x12）时调用，寄存器恢复默认值，RAM内容保持不变
+  */
+static void EPD_Sim_ResetController(void)
+{
+	memset(&EPD_Sim_State, 0, sizeof(EPD_Sim_State));
+	EPD_Sim_State.Mux = EPD_SIM_RAM_Y;
+	EPD_Sim_State.Entry = 0x03;				//默认X、Y均递增，先X后Y
+	EPD_Sim_State.XEnd = EPD_SIM_RAM_X - 1;
+	EPD_Sim_State.YEnd = EPD_SIM_RAM_Y - 1;
+	EPD_Sim_Command = 0x00;
+	EPD_Sim_Param = 0;
+	EPD_Sim_BitCount = 0;
+}
+
+/**
+  * 函    数：结束本次更新的统计
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：刷新后读到BUSY变低时调用，驱动未等待BUSY就继续发送时，在下一个字节到来时调用
+  */
+static void EPD_Sim_EndUpdate(void)
+{
+	EPD_Sim_Current.Time = (EPD_Sim_Clock - EPD_Sim_Start) / 1000;
+	EPD_Sim_Last = EPD_Sim_Current;
+	memset(&EPD_Sim_Current, 0, sizeof(EPD_Sim_Current));
+	EPD_Sim_Start = EPD_Sim_Clock;
+	EPD_Sim_Pending = 0;
+}
+
+/**
+  * 函    数：RAM地址计数器前进一步
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：按数据输入顺序移动，B0：X方向，0递减，1递增，B1：Y方向，0递减，1递增
+  *           B2：0先移动X，1先移动Y
+  *           计数器到达窗口终止位后回到起始位，并使另一方向前进一步
+  */
+static void EPD_Sim_Advance(void)
+{
+	EPD_SimState_t *S = &EPD_Sim_State;
+	uint8_t XWrap = 0, YWrap = 0;
+
+	if (S->Entry & 0x04)
+	{
+		/*先移动Y*/
+		if (S->YCount == S->YEnd) {S->YCount = S->YStart; YWrap = 1;}
+		else {S->YCount += (S->Entry & 0x02) ? 1 : -1;}
+		if (YWrap)
+		{
+			if (S->XCount == S->XEnd) {S->XCount = S->XStart;}
+			else {S->XCount += (S->Entry & 0x01) ? 1 : -1;}
+		}
+	}
+	else
+	{
+		/*先移动X*/
+		if (S->XCount == S->XEnd) {S->XCount = S->XStart; XWrap = 1;}
+		else {S->XCount += (S->Entry & 0x01) ? 1 : -1;}
+		if (XWrap)
+		{
+			if (S->YCount == S->YEnd) {S->YCount = S->YStart;}
+			else {S->YCount += (S->Entry & 0x02) ? 1 : -1;}
+		}
+	}
+}
+
+/**
+  * 函    数：处理一个命令字节
+  * 参    数：Command 命令值
+  * 返 回 值：无
+  */
+static void EPD_Sim_OnCommand(uint8_t Command)
+{
+	EPD_Sim_Command = Command;
+	EPD_Sim_Param = 0;
+	EPD_Sim_Current.Commands ++;
+	EPD_Sim_Total.Commands ++;
+
+	switch (Command)
+	{
+		case 0x12:							//软件复位
+			EPD_Sim_ResetController();
+			EPD_Sim_Command = Command;
+			EPD_Sim_BusyUntil = EPD_Sim_Clock + EPD_SIM_RESET_MS * 1000000ULL;
+			break;
+
+		case 0x20:							//启动刷新，按刷新方式把黑白RAM显示到屏幕
+			memcpy(EPD_Sim_Panel, EPD_Sim_Ram[EPD_SIM_RAM_BW], sizeof(EPD_Sim_Panel));
+			EPD_Sim_Current.Refreshes ++;
+			EPD_Sim_Total.Refreshes ++;
+			EPD_Sim_BusyUntil = EPD_Sim_Clock + EPD_SIM_REFRESH_MS * 1000000ULL;
+			EPD_Sim_Pending = 1;
+			break;
+
+		case 0x32:							//写波形表，重新开始
+			EPD_Sim_State.LutLength = 0;
+			break;
+	}
+}
+
+/**
+  * 函    数：处理一个数据字节
+  * 参    数：Data 数据值
+  * 返 回 值：无
+  * 说    明：数据属于最近一次收到的命令，Param为它在该命令参数中的序号
+  */
+static void EPD_Sim_OnData(uint8_t Data)
+{
+	EPD_SimState_t *S = &EPD_Sim_State;
+	uint16_t Param = EPD_Sim_Param ++;
+	uint8_t Ram;
+
+	switch (EPD_Sim_Command)
+	{
+		case 0x01:							//驱动输出控制
+			if (Param == 0) {S->Mux = (S->Mux & 0x100) | Data;}
+			else if (Param == 1) {S->Mux = (S->Mux & 0xFF) | ((Data & 0x01) << 8);}
+			else if (Param == 2) {S->Scan = Data & 0x07;}
+			break;
+
+		case 0x11:							//数据输入顺序
+			if (Param == 0) {S->Entry = Data & 0x07;}
+			break;
+
+		case 0x44:							//RAM的X窗口
+			if (Param == 0) {S->XStart = Data & 0x3F;}
+			else if (Param == 1) {S->XEnd = Data & 0x3F;}
+			break;
+
+		case 0x45:							//RAM的Y窗口，低字节在前
+			if (Param == 0) {S->YStart = (S->YStart & 0x100) | Data;}
+			else if (Param == 1) {S->YStart = (S->YStart & 0xFF) | ((Data & 0x01) << 8);}
+			else if (Param == 2) {S->YEnd = (S->YEnd & 0x100) | Data;}
+			else if (Param == 3) {S->YEnd = (S->YEnd & 0xFF) | ((Data & 0x01) << 8);}
+			break;
+
+		case 0x4E:							//X地址计数器
+			if (Param == 0) {S->XCount = Data & 0x3F;}
+			break;
+
+		case 0x4F:							//Y地址计数器，低字节在前
+			if (Param == 0) {S->YCount = (S->YCount & 0x100) | Data;}
+			else if (Param == 1) {S->YCount = (S->YCount & 0xFF) | ((Data & 0x01) << 8);}
+			break;
+
+		case 0x24:							//写黑白RAM
+		case 0x26:							//写红色RAM
+			Ram = (EPD_Sim_Command == 0x24) ? EPD_SIM_RAM_BW : EPD_SIM_RAM_RED;
+			if (S->XCount < EPD_SIM_RAM_X && S->YCount < EPD_SIM_RAM_Y)	//超出模拟RAM的地址不保存
+			{
+				EPD_Sim_Ram[Ram][S->XCount][S->YCount] = Data;
+			}
+			EPD_Sim_Advance();
+			break;
+
+		case 0x22:							//刷新方式
+			if (Param == 0) {S->Update = Data;}
+			break;
+
+		case 0x32:							//波形表
+			if (S->LutLength < EPD_SIM_LUT_SIZE) {S->Lut[S->LutLength ++] = Data;}
+			break;
+	}
+}
+
+/*********************工具函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：模拟器复位
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：清空RAM、屏幕图像与全部统计，相当于重新上电
+  */
+void EPD_Sim_Reset(void)
+{
+	memset(EPD_Sim_Ram, 0, sizeof(EPD_Sim_Ram));
+	memset(EPD_Sim_Panel, 0, sizeof(EPD_Sim_Panel));
+	memset(&EPD_Sim_Current, 0, sizeof(EPD_Sim_Current));
+	memset(&EPD_Sim_Last, 0, sizeof(EPD_Sim_Last));
+	memset(&EPD_Sim_Total, 0, sizeof(EPD_Sim_Total));
+	memset(EPD_Sim_Level, 1, sizeof(EPD_Sim_Level));
+	EPD_Sim_Clock = 0;
+	EPD_Sim_BusyUntil = 0;
+	EPD_Sim_Start = 0;
+	EPD_Sim_Pending = 0;
+	EPD_Sim_ResetController();
+}
+
+/**
+  * 函    数：模拟器接收一次引脚写入
+  * 参    数：Pin 引脚编号，范围：EPD_SIM_SCL、EPD_SIM_SDA、EPD_SIM_RES、EPD_SIM_DC、EPD_SIM_CS
+  * 参    数：Level 引脚电平，范围：0/1
+  * 返 回 值：无
+  * 说    明：由EPD.c的引脚函数调用，CS为低时在SCL上升沿移入SDA，高位在前
+  *           每满8位，按DC的电平作为命令（0）或数据（1）处理，CS拉高时丢弃不足8位的部分
+  *           每次写入使模拟时钟前进EPD_SIM_WRITE_NS，BUSY为高时收到的字节计入BusyBytes
+  */
+void EPD_Sim_Pin(uint8_t Pin, uint8_t Level)
+{
+	uint8_t Last;
+
+	if (Pin > EPD_SIM_CS) {return;}
+	Level = !!Level;
+	Last = EPD_Sim_Level[Pin];
+	EPD_Sim_Level[Pin] = Level;
+
+	EPD_Sim_Clock += EPD_SIM_WRITE_NS;
+	EPD_Sim_Current.Writes ++;
+	EPD_Sim_Total.Writes ++;
+	if (Level == Last) {return;}
+	EPD_Sim_Current.Toggles ++;
+	EPD_Sim_Total.Toggles ++;
+
+	switch (Pin)
+	{
+		case EPD_SIM_RES:					//RES拉低，硬件复位
+			if (Level == 0) {EPD_Sim_ResetController();}
+			break;
+
+		case EPD_SIM_CS:					//CS拉高，结束一次传输
+			if (Level == 1) {EPD_Sim_BitCount = 0;}
+			break;
+
+		case EPD_SIM_SCL:					//SCL上升沿，移入一位
+			if (Level == 1 && EPD_Sim_Level[EPD_SIM_CS] == 0 && EPD_Sim_Level[EPD_SIM_RES] == 1)
+			{
+				EPD_Sim_Shift = (EPD_Sim_Shift << 1) | EPD_Sim_Level[EPD_SIM_SDA];
+				if (++ EPD_Sim_BitCount == 8)
+				{
+					EPD_Sim_BitCount = 0;
+					if (EPD_Sim_Pending) {EPD_Sim_EndUpdate();}	//上次刷新后没有等待BUSY，此字节属于下一次更新
+					if (EPD_Sim_Clock < EPD_Sim_BusyUntil)		//控制器忙时发送，实际的控制器会丢弃或误处理
+					{
+						EPD_Sim_Current.BusyBytes ++;
+						EPD_Sim_Total.BusyBytes ++;
+					}
+					EPD_Sim_Current.Bytes ++;
+					EPD_Sim_Total.Bytes ++;
+					if (EPD_Sim_Level[EPD_SIM_DC]) {EPD_Sim_OnData(EPD_Sim_Shift);}
+					else {EPD_Sim_OnCommand(EPD_Sim_Shift);}
+				}
+			}
+			break;
+	}
+}
+
+/**
+  * 函    数：模拟器读BUSY电平
+  * 参    数：无
+  * 返 回 值：BUSY的电平值，范围：0/1
+  * 说    明：软件复位后EPD_SIM_RESET_MS、刷新后EPD_SIM_REFRESH_MS内BUSY为高，按模拟时钟判断
+  *           每次读取使模拟时钟前进EPD_SIM_POLL_NS
+  *           BUSY为高时假定调用者会连续读取直到变低，为免在电脑上空转数百万次，
+  *           第一次读到高电平时直接把模拟时钟推进到BUSY变低的时刻，下一次读取即返回0
+  *           因此耗时与一直循环读取相同，而Polls中忙等的多次读取只计为1次
+  */
+uint8_t EPD_Sim_ReadBusy(void)
+{
+	EPD_Sim_Clock += EPD_SIM_POLL_NS;
+	EPD_Sim_Current.Polls ++;
+	EPD_Sim_Total.Polls ++;
+
+	if (EPD_Sim_Clock < EPD_Sim_BusyUntil)
+	{
+		EPD_Sim_Clock = EPD_Sim_BusyUntil;
+		return 1;
+	}
+	if (EPD_Sim_Pending) {EPD_Sim_EndUpdate();}	//刷新完成，本次更新的统计结束
+	return 0;
+}
+
+/**
+  * 函    数：模拟时钟前进指定时间
+  * 参    数：Us 时间，单位us
+  * 返 回 值：无
+  * 说    明：模拟器看不到驱动中的Delay_ms等延时，在电脑上编译时由延时函数的替身调用此函数计入
+  */
+void EPD_Sim_Delay(uint32_t Us)
+{
+	EPD_Sim_Clock += (uint64_t)Us * 1000;
+}
+
+/**
+  * 函    数：获取通信统计
+  * 参    数：Last 上一次完整更新的统计，不需要时传入NULL
+  * 参    数：Total 从复位开始的累计统计，不需要时传入NULL
+  * 返 回 值：无
+  * 说    明：一次更新指从上次刷新完成（读到BUSY变低）到本次刷新完成的全部通信与等待
+  *           每字节翻转数等派生值可由调用者用Toggles/Bytes等自行计算
+  */
+void EPD_Sim_GetStats(EPD_SimStats_t *Last, EPD_SimStats_t *Total)
+{
+	if (Last)
+	{
+		*Last = EPD_Sim_Last;
+	}
+	if (Total)
+	{
+		*Total = EPD_Sim_Total;
+		Total->Time = EPD_Sim_Clock / 1000;
+	}
+}
+
+/**
+  * 函    数：获取控制器状态
+  * 参    数：无
+  * 返 回 值：控制器状态，只读
+  */
+const EPD_SimState_t *EPD_Sim_GetState(void)
+{
+	return &EPD_Sim_State;
+}
+
+/**
+  * 函    数：比较屏幕图像与画布
+  * 参    数：Canvas 指定画布，通常为&EPD_Canvas
+  * 返 回 值：不同的像素个数，0表示屏幕显示的内容与画布完全一致
+  * 说    明：按坐标逐点比较，画布与屏幕大小不同时只比较重叠部分
+  */
+uint32_t EPD_Sim_Compare(const Canvas_t *Canvas)
+{
+	uint32_t Count = 0;
+	int16_t X, Y;
+
+	for (Y = 0; Y < Canvas->Height && Y < EPD_Sim_Canvas.Height; Y ++)
+	{
+		for (X = 0; X < Canvas->Width && X < EPD_Sim_Canvas.Width; X ++)
+		{
+			if (Canvas_GetPoint(Canvas, X, Y) != Canvas_GetPoint(&EPD_Sim_Canvas, X, Y)) {Count ++;}
+		}
+	}
+	return Count;
+}
+
+/*********************功能函数*/
+
+#endif
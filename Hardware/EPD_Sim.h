@@ -0,0 +1,113 @@
+#ifndef __EPD_SIM_H
+#define __EPD_SIM_H
+
+#include <stdint.h>
+#include "Canvas.h"
+
+/**
+  * EPD控制器模拟
+  * 定义EPD_SIM宏编译时（如Keil的Define栏或gcc的-DEPD_SIM），EPD.c的引脚函数不再操作GPIO，
+  * 而是把每次引脚电平交给本模块，由本模块按SPI时序解码出命令和数据，模拟控制器的两块RAM与屏幕
+  * 用于在没有屏幕的情况下检查EPD驱动发出的命令序列、统计每次更新的通信量
+  * 未定义EPD_SIM时本模块不编译任何内容
+  */
+
+/*参数宏定义*********************/
+
+/*引脚编号，EPD_Sim_Pin的Pin参数取值*/
+#define EPD_SIM_SCL				0
+#define EPD_SIM_SDA				1
+#define EPD_SIM_RES				2
+#define EPD_SIM_DC				3
+#define EPD_SIM_CS				4
+
+/*模拟的RAM大小，X方向以字节为单位，与EPD_DisplayBuf一致*/
+#define EPD_SIM_RAM_X			16
+#define EPD_SIM_RAM_Y			248
+
+/*RAM编号*/
+#define EPD_SIM_RAM_BW			0		//黑白RAM，命令0x24写入
+#define EPD_SIM_RAM_RED			1		//红色/旧数据RAM，命令0x26写入
+
+/*波形表最大长度*/
+#define EPD_SIM_LUT_SIZE		227
+
+/*耗时估算参数，可在编译时重新定义，刷新与复位时间为参考值，应按所用屏幕的规格书修改*/
+#ifndef EPD_SIM_WRITE_NS
+#define EPD_SIM_WRITE_NS		250		//每次引脚写入的耗时，单位ns，对应72MHz下GPIO_WriteBit的调用开销
+#endif
+#ifndef EPD_SIM_POLL_NS
+#define EPD_SIM_POLL_NS			300		//每次读BUSY的耗时，单位ns，对应72MHz下EPD_WaitBusy循环一次的开销
+#endif
+#ifndef EPD_SIM_REFRESH_MS
+#define EPD_SIM_REFRESH_MS		2000	//每次刷新（命令0x20）BUSY保持的时间，单位ms
+#endif
+#ifndef EPD_SIM_RESET_MS
+#define EPD_SIM_RESET_MS		10		//软件复位（命令0x12）BUSY保持的时间，单位ms
+#endif
+
+/*********************参数宏定义*/
+
+
+/*状态描述*********************/
+
+/**
+  * 通信统计，刷新（命令0x20）后读到BUSY变低时结束一次更新
+  */
+typedef struct
+{
+	uint32_t Commands;		//命令字节数
+	uint32_t Bytes;			//总字节数，包括命令和数据
+	uint32_t Writes;		//引脚写入次数
+	uint32_t Toggles;		//引脚电平实际翻转的次数
+	uint32_t Refreshes;		//刷新次数
+	uint32_t Polls;			//读BUSY的次数，BUSY为高期间的连续读取合并计为1次
+	uint32_t BusyBytes;		//BUSY为高时收到的字节数，驱动正确等待BUSY时为0
+	uint64_t Time;			//估算耗时，单位us，由模拟时钟得到，包括引脚写入、读BUSY、等待BUSY与EPD_Sim_Delay的时间
+} EPD_SimStats_t;
+
+/**
+  * 控制器状态，由命令设置
+  */
+typedef struct
+{
+	uint16_t Mux;						//命令0x01，驱动的栅极行数
+	uint8_t Scan;						//命令0x01，扫描顺序
+	uint8_t Entry;						//命令0x11，数据输入顺序
+	uint8_t XStart, XEnd;				//命令0x44，RAM的X窗口
+	uint16_t YStart, YEnd;				//命令0x45，RAM的Y窗口
+	uint8_t XCount;						//命令0x4E及写RAM后自动移动，X地址计数器
+	uint16_t YCount;					//命令0x4F及写RAM后自动移动，Y地址计数器
+	uint8_t Update;						//命令0x22，刷新方式
+	uint8_t LutLength;					//命令0x32，已写入的波形表长度
+	uint8_t Lut[EPD_SIM_LUT_SIZE];		//命令0x32，波形表
+} EPD_SimState_t;
+
+/*********************状态描述*/
+
+
+/*全局变量*********************/
+
+/*控制器的两块RAM与屏幕上当前显示的图像，排列方式与EPD_DisplayBuf一致*/
+extern uint8_t EPD_Sim_Ram[2][EPD_SIM_RAM_X][EPD_SIM_RAM_Y];
+extern uint8_t EPD_Sim_Panel[EPD_SIM_RAM_X][EPD_SIM_RAM_Y];
+
+/*屏幕图像的画布，可用Canvas_WritePBM输出*/
+extern const Canvas_t EPD_Sim_Canvas;
+
+/*********************全局变量*/
+
+
+/*函数声明*********************/
+
+void EPD_Sim_Reset(void);
+void EPD_Sim_Pin(uint8_t Pin, uint8_t Level);
+uint8_t EPD_Sim_ReadBusy(void);
+void EPD_Sim_Delay(uint32_t Us);
+void EPD_Sim_GetStats(EPD_SimStats_t *Last, EPD_SimStats_t *Total);
+const EPD_SimState_t *EPD_Sim_GetState(void);
+uint32_t EPD_Sim_Compare(const Canvas_t *Canvas);
+
+/*********************函数声明*/
+
+#endif
@@ -0,0 +1,185 @@
+#include "Font.h"
+
+/*全局变量*********************/
+
+/*已注册的字体，前两项为内置字体*/
+static const Font_t *Font_List[FONT_MAX_NUM] = {&Font_Prop8, &Font_Prop16};
+static uint8_t Font_Num = 2;
+
+/*********************全局变量*/
+
+
+/*工具函数*********************/
+
+/*工具函数仅供内部部分函数使用*/
+
+/**
+  * 函    数：获取字符在字体中的序号
+  * 参    数：Font 指定字体
+  * 参    数：Char 指定字符
+  * 返 回 值：字符序号，字体中没有的字符以'?'代替，'?'也没有时以第一个字符代替
+  */
+static uint8_t Font_GetIndex(const Font_t *Font, char Char)
+{
+	if (Char < Font->First || Char > Font->Last)
+	{
+		Char = ('?' >= Font->First && '?' <= Font->Last) ? '?' : Font->First;
+	}
+	return Char - Font->First;
+}
+
+/**
+  * 函    数：获取字符位图的起始位偏移
+  * 参    数：Font 指定字体
+  * 参    数：Index 字符序号
+  * 返 回 值：位图起始位偏移
+  * 说    明：从所在8字符组的索引开始，累加组内前面字符的位图大小，最多累加7次
+  */
+static uint16_t Font_GetOffset(const Font_t *Font, uint8_t Index)
+{
+	uint16_t Offset = Font->Index[Index / 8];
+	uint8_t i;
+
+	for (i = Index & ~0x07; i < Index; i ++)
+	{
+		if (Font->Glyph[i].Size >> 4)		//位图宽度为0的字符不占用位图
+		{
+			Offset += (Font->Glyph[i].Size >> 4) * ((Font->Glyph[i].Box & 0x0F) + 1);
+		}
+	}
+	return Offset;
+}
+
+/**
+  * 函    数：从位图中读取连续的若干位
+  * 参    数：Bitmap 位图数据
+  * 参    数：Offset 起始位偏移
+  * 参    数：Count 读取的位数，范围：1~16
+  * 返 回 值：读取到的数据，最先读取的位在B0
+  */
+static uint32_t Font_ReadBits(const uint8_t *Bitmap, uint16_t Offset, uint8_t Count)
+{
+	const uint8_t *Byte = Bitmap + Offset / 8;
+	uint32_t Bits;
+
+	Bits = Byte[0] | ((uint32_t)Byte[1] << 8) | ((uint32_t)Byte[2] << 16);
+	return (Bits >> (Offset % 8)) & ((1UL << Count) - 1);
+}
+
+/*********************工具函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：注册一个字体
+  * 参    数：Font 指定要注册的字体
+  * 返 回 值：字体编号，已满时返回0xFF
+  * 说    明：内置字体已预先注册，编号为FONT_PROP8与FONT_PROP16
+  */
+uint8_t Font_Register(const Font_t *Font)
+{
+	if (Font_Num >= FONT_MAX_NUM) {return 0xFF;}
+	Font_List[Font_Num] = Font;
+	return Font_Num ++;
+}
+
+/**
+  * 函    数：根据编号获取已注册的字体
+  * 参    数：Id 字体编号
+  * 返 回 值：字体，编号无效时返回Font_Prop8
+  */
+const Font_t *Font_Get(uint8_t Id)
+{
+	if (Id >= Font_Num) {return &Font_Prop8;}
+	return Font_List[Id];
+}
+
+/**
+  * 函    数：获取字符的步进宽度
+  * 参    数：Font 指定字体
+  * 参    数：Char 指定字符
+  * 返 回 值：步进宽度，即显示此字符后横坐标的增量
+  */
+uint8_t Font_GetAdvance(const Font_t *Font, char Char)
+{
+	return Font->Glyph[Font_GetIndex(Font, Char)].Size & 0x0F;
+}
+
+/**
+  * 函    数：测量字符串的显示宽度
+  * 参    数：Font 指定字体
+  * 参    数：String 指定字符串
+  * 返 回 值：显示宽度，单位像素，不写显存
+  */
+uint16_t Font_MeasureString(const Font_t *Font, const char *String)
+{
+	uint16_t Width = 0;
+
+	while (*String != '\0')
+	{
+		Width += Font_GetAdvance(Font, *String);
+		String ++;
+	}
+	return Width;
+}
+
+/**
+  * 函    数：显示一个比例字体字符
+  * 参    数：Canvas 指定画布，范围：&EPD_Canvas或&OLED_Canvas
+  * 参    数：X 指定字符左上角的横坐标，范围：-32768~32767
+  * 参    数：Y 指定字符左上角的纵坐标，范围：-32768~32767
+  * 参    数：Char 指定要显示的字符
+  * 参    数：Font 指定字体
+  * 返 回 值：步进宽度
+  * 说    明：字符所在的步进宽度*行高区域会被整体覆盖，每列只写一次显存
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+uint8_t Font_ShowChar(const Canvas_t *Canvas, int16_t X, int16_t Y, char Char, const Font_t *Font)
+{
+	uint8_t Index = Font_GetIndex(Font, Char);
+	uint8_t Width = Font->Glyph[Index].Size >> 4;
+	uint8_t Advance = Font->Glyph[Index].Size & 0x0F;
+	uint8_t Top = Font->Glyph[Index].Box >> 4;
+	uint8_t Height = (Font->Glyph[Index].Box & 0x0F) + 1;
+	uint16_t Offset = Font_GetOffset(Font, Index);
+	uint8_t i;
+
+	for (i = 0; i < Advance; i ++)
+	{
+		if (i < Width)
+		{
+			/*位图内的列，读出后移到行内位置写入*/
+			Canvas_WriteColumn(Canvas, X + i, Y, Font_ReadBits(Font->Bitmap, Offset, Height) << Top, Font->Height);
+			Offset += Height;
+		}
+		else
+		{
+			/*字符间距，清空*/
+			Canvas_WriteColumn(Canvas, X + i, Y, 0, Font->Height);
+		}
+	}
+	return Advance;
+}
+
+/**
+  * 函    数：显示比例字体字符串
+  * 参    数：Canvas 指定画布，范围：&EPD_Canvas或&OLED_Canvas
+  * 参    数：X 指定字符串左上角的横坐标，范围：-32768~32767
+  * 参    数：Y 指定字符串左上角的纵坐标，范围：-32768~32767
+  * 参    数：String 指定要显示的字符串，范围：ASCII码可见字符组成的字符串
+  * 参    数：Font 指定字体
+  * 返 回 值：字符串末尾的横坐标
+  * 说    明：调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+int16_t Font_ShowString(const Canvas_t *Canvas, int16_t X, int16_t Y, const char *String, const Font_t *Font)
+{
+	while (*String != '\0')
+	{
+		X += Font_ShowChar(Canvas, X, Y, *String, Font);
+		String ++;
+	}
+	return X;
+}
+
+/*********************功能函数*/
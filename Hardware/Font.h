@@ -0,0 +1,67 @@
+#ifndef __FONT_H
+#define __FONT_H
+
+#include <stdint.h>
+#include "Canvas.h"
+
+/*字体描述*********************/
+
+/**
+  * 比例字体的字符度量
+  * 位图宽度为0表示该字符没有像素（如空格），只占用步进宽度
+  * 单个字符位图最大15*16像素，字体行高最大24像素
+  */
+typedef struct
+{
+	uint8_t Size;		//高4位：位图宽度，低4位：步进宽度
+	uint8_t Box;		//高4位：位图顶端相对行顶的偏移，低4位：位图高度减1
+} FontGlyph_t;
+
+/**
+  * 比例字体
+  * 位图按列存储，每列Height位，B0在上，列与列、字符与字符之间紧密排列不补齐
+  * Index记录每8个字符的首个位图的位偏移，字符位图的位置由此向后累加得到
+  */
+typedef struct
+{
+	const uint8_t *Bitmap;		//位图数据，末尾需多补2个字节0x00
+	const FontGlyph_t *Glyph;	//字符度量表，从First到Last
+	const uint16_t *Index;		//位图位偏移索引，每8个字符一项
+	char First;					//第一个字符
+	char Last;					//最后一个字符
+	uint8_t Height;				//行高
+} Font_t;
+
+/*内置字体*/
+extern const Font_t Font_Prop8;		//由EPD_F6x8生成，行高8像素
+extern const Font_t Font_Prop16;	//由EPD_F8x16生成，行高16像素
+
+/*********************字体描述*/
+
+
+/*参数宏定义*********************/
+
+/*可注册的字体数量*/
+#define FONT_MAX_NUM			4
+
+/*内置字体编号*/
+#define FONT_PROP8				0
+#define FONT_PROP16				1
+
+/*********************参数宏定义*/
+
+
+/*函数声明*********************/
+
+uint8_t Font_Register(const Font_t *Font);
+const Font_t *Font_Get(uint8_t Id);
+
+uint8_t Font_GetAdvance(const Font_t *Font, char Char);
+uint16_t Font_MeasureString(const Font_t *Font, const char *String);
+
+uint8_t Font_ShowChar(const Canvas_t *Canvas, int16_t X, int16_t Y, char Char, const Font_t *Font);
+int16_t Font_ShowString(const Canvas_t *Canvas, int16_t X, int16_t Y, const char *String, const Font_t *Font);
+
+/*********************函数声明*/
+
+#endif
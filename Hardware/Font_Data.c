@@ -0,0 +1,303 @@
+#include "Font.h"
+
+/**
+  * 数据存储格式：
+  * 每个字符的位图按列存储，每列只保存位图高度的位数，B0在上
+  * 所有位从字节的B0开始依次紧密排列，不按字节补齐
+  * 字符度量表与位偏移索引的含义见Font.h
+  * 
+  * 内置字体由ASCII字模库裁剪掉左右空白列和上下空白行得到
+  * 字符步进宽度为位图宽度加1，空格另行指定
+  */
+
+/*比例字体数据*********************/
+
+/*由EPD_F8x16裁剪空白生成，行高16像素*/
+static const uint8_t Font_Prop16_Bitmap[] =
+{
+	0x7F,0x06,0xF0,0x1E,0xEC,0x21,0x02,0xFF,0x8F,0x40,0x04,0xFE,0x1F,0x81,0x08,0x0E,
+	0x43,0x04,0xF9,0xFF,0x85,0x10,0xC6,0xC3,0x03,0x21,0xF4,0x1C,0x18,0xB8,0x37,0x42,
+	0xE0,0x01,0xCF,0x87,0x61,0x8C,0xA4,0xCB,0xC0,0x09,0x42,0x00,0xED,0xC1,0x0F,0x0C,
+	0x8C,0x00,0x14,0x00,0x06,0x80,0x02,0x10,0x03,0x03,0x3F,0x90,0x90,0x60,0xFC,0x63,
+	0x90,0x90,0x40,0x80,0x00,0xE1,0x3F,0x04,0x08,0x10,0xF6,0xFE,0x0F,0x80,0x01,0x0C,
+	0x60,0x00,0x03,0x18,0xC0,0x00,0x04,0x00,0xFE,0x08,0x28,0x80,0x01,0x14,0x10,0x7F,
+	0x04,0x28,0xC0,0xFF,0x03,0x10,0x80,0x0E,0x0E,0x68,0x20,0x83,0x18,0x43,0x07,0x1B,
+	0x2C,0x80,0x11,0x8C,0x60,0x8A,0x8C,0x03,0x0E,0x4C,0x10,0x52,0x90,0xFF,0x07,0xE4,
+	0xCF,0x42,0x18,0xC1,0x08,0x86,0x28,0x38,0xFC,0x11,0x51,0x04,0x23,0x38,0x22,0xE0,
+	0x1C,0x20,0x00,0xE1,0xCF,0xC0,0x01,0x02,0xE0,0xB8,0x28,0x86,0x30,0x84,0x51,0x74,
+	0x1C,0x07,0x44,0x1C,0xC4,0x20,0x8A,0x88,0x3F,0xC3,0xC3,0x00,0x0E,0x3B,0x1C,0x08,
+	0xA0,0x80,0x08,0x82,0x08,0x28,0x80,0x31,0xC6,0x18,0x63,0x0C,0xA0,0x80,0x08,0x82,
+	0x08,0x28,0x80,0xC0,0x01,0x09,0x08,0x70,0xB0,0x43,0xE0,0x01,0x7C,0x18,0x2C,0x9F,
+	0x85,0xEC,0xA3,0xA0,0xF8,0x02,0x40,0xC0,0xE3,0xF1,0x08,0x5C,0x00,0x27,0xC0,0x01,
+	0x18,0xC0,0xFF,0x47,0x30,0x82,0x11,0x74,0x11,0x70,0xF0,0x61,0xB0,0x00,0x06,0x30,
+	0x80,0x01,0x3A,0x48,0x00,0xFF,0x1F,0xC0,0x00,0x06,0x50,0x40,0xFC,0x09,0xE0,0xFF,
+	0x23,0x18,0xC1,0x3E,0x06,0x50,0x60,0x01,0xFC,0x7F,0x04,0x23,0xD0,0x87,0x00,0x08,
+	0x00,0x1F,0x06,0x0B,0x60,0x00,0x83,0x78,0x3C,0x20,0x04,0xF0,0xFF,0x21,0x04,0x01,
+	0x08,0x42,0xF8,0xFF,0x00,0x06,0x30,0x80,0xFF,0x0F,0x60,0x00,0x01,0x30,0x00,0x0C,
+	0x80,0x01,0xF0,0xFF,0x05,0x80,0x00,0x10,0xC0,0xFF,0x47,0x10,0x07,0xC5,0x1C,0x78,
+	0x00,0x03,0xF8,0xFF,0x00,0x02,0x10,0x80,0x00,0x04,0x70,0x00,0xFF,0xFF,0x01,0xF0,
+	0x7F,0xE0,0xFF,0x01,0x0C,0xE0,0xFF,0x0D,0x88,0x01,0x70,0x04,0xEC,0xFF,0x01,0xE0,
+	0x8F,0x80,0x02,0x18,0xC0,0x00,0x0A,0x88,0x3F,0x01,0xFC,0x7F,0x08,0x43,0x10,0x82,
+	0x10,0x78,0x80,0x3F,0x04,0x26,0x90,0x02,0x29,0xE0,0x04,0x94,0x3F,0x03,0xF8,0xFF,
+	0x08,0x46,0x20,0x0E,0x91,0x71,0x30,0x00,0x1D,0x1E,0xC1,0x10,0x86,0x30,0x88,0x87,
+	0x1B,0x40,0x00,0x02,0xF8,0xFF,0x00,0x06,0x60,0x00,0x01,0xF8,0x5F,0x00,0x01,0x08,
+	0xC0,0x00,0xFE,0x2F,0x00,0x01,0x78,0x40,0x3C,0x00,0x0E,0x9C,0x1C,0x1C,0x20,0x00,
+	0x7F,0x08,0x3C,0x38,0x3E,0x00,0x8E,0xC0,0xFF,0x21,0x80,0x03,0x6E,0x2C,0x1C,0xE0,
+	0xD0,0xD8,0x01,0x07,0x30,0x00,0x07,0xC8,0x20,0xF8,0x33,0x78,0x80,0x00,0x08,0x30,
+	0xE0,0xC1,0x0C,0x61,0x06,0x0F,0x18,0xB0,0xFF,0x3F,0x00,0x0C,0x00,0x03,0xC0,0x01,
+	0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x07,0x00,0x0E,0x00,0x03,0xC0,0x00,0xF0,0xFF,
+	0x47,0x92,0x10,0xC2,0xFF,0x88,0xB2,0x64,0xB1,0x58,0xF4,0x03,0x03,0xF0,0x7F,0x10,
+	0x41,0x10,0x82,0x20,0x02,0x0E,0x47,0x14,0x0C,0x06,0x45,0xC0,0x01,0x11,0x04,0x21,
+	0x18,0xA1,0xFF,0x03,0xD0,0x57,0x2C,0x16,0x8B,0x26,0x08,0x42,0xD0,0xFF,0x11,0x8C,
+	0x60,0x04,0x06,0x60,0x2D,0x65,0xCA,0x94,0x27,0x83,0x05,0xF0,0xFF,0x20,0x84,0x00,
+	0x04,0x20,0x08,0x7E,0x00,0x42,0x70,0x82,0xF3,0x07,0x20,0x00,0x01,0x30,0x00,0x84,
+	0x80,0x13,0x70,0xFE,0x05,0xF0,0xFF,0x80,0x04,0x02,0x6C,0x21,0x0C,0xC1,0x00,0x06,
+	0xF0,0xFF,0x00,0x04,0x60,0xF0,0x1F,0x0C,0xFC,0x83,0x01,0x7F,0xF0,0x2F,0x0C,0x04,
+	0xFD,0x40,0x5F,0x30,0x18,0x0C,0xFA,0x02,0xFE,0x17,0x1A,0x24,0x88,0x08,0x0E,0x1C,
+	0x44,0x04,0x09,0x12,0xF4,0x3F,0xC0,0x60,0xF0,0x2F,0x0C,0x06,0x06,0xE6,0x64,0x32,
+	0x99,0x9C,0x11,0x20,0xF0,0x8F,0x20,0xC1,0xC0,0x0F,0x08,0x04,0x86,0xFE,0xC0,0xC0,
+	0xA0,0x03,0x86,0x34,0x06,0x81,0x4F,0x18,0x73,0xC0,0x84,0x3F,0x81,0xE0,0x98,0xDB,
+	0x19,0x07,0x03,0x0E,0xEC,0x08,0x0E,0x46,0x83,0x01,0x01,0x86,0xE1,0x6C,0x71,0x18,
+	0x06,0x02,0x7C,0xBF,0x00,0x30,0x00,0xFC,0xFF,0x0F,0x00,0x03,0x40,0xDF,0x0F,0x08,
+	0x50,0x22,0x52,0x00,0x00,
+};
+
+static const FontGlyph_t Font_Prop16_Glyph[] =
+{
+	{0x04,0x00},//   0
+	{0x23,0x3A},// ! 1
+	{0x56,0x13},// " 2
+	{0x78,0x3A},// # 3
+	{0x56,0x2D},// $ 4
+	{0x78,0x3A},// % 5
+	{0x89,0x3A},// & 6
+	{0x23,0x13},// ' 7
+	{0x45,0x1D},// ( 8
+	{0x45,0x1D},// ) 9
+	{0x78,0x47},// * 10
+	{0x78,0x48},// + 11
+	{0x23,0xC3},// , 12
+	{0x78,0x80},// - 13
+	{0x23,0xC1},// . 14
+	{0x78,0x2C},// / 15
+	{0x67,0x3A},// 0 16
+	{0x56,0x3A},// 1 17
+	{0x67,0x3A},// 2 18
+	{0x67,0x3A},// 3 19
+	{0x67,0x3A},// 4 20
+	{0x67,0x3A},// 5 21
+	{0x67,0x3A},// 6 22
+	{0x67,0x3A},// 7 23
+	{0x67,0x3A},// 8 24
+	{0x67,0x3A},// 9 25
+	{0x23,0x67},// : 26
+	{0x34,0x69},// ; 27
+	{0x67,0x3A},// < 28
+	{0x78,0x64},// = 29
+	{0x67,0x3A},// > 30
+	{0x67,0x3A},// ? 31
+	{0x78,0x3A},// @ 32
+	{0x89,0x3A},// A 33
+	{0x78,0x3A},// B 34
+	{0x78,0x3A},// C 35
+	{0x78,0x3A},// D 36
+	{0x78,0x3A},// E 37
+	{0x78,0x3A},// F 38
+	{0x78,0x3A},// G 39
+	{0x89,0x3A},// H 40
+	{0x56,0x3A},// I 41
+	{0x78,0x3C},// J 42
+	{0x78,0x3A},// K 43
+	{0x78,0x3A},// L 44
+	{0x78,0x3A},// M 45
+	{0x89,0x3A},// N 46
+	{0x78,0x3A},// O 47
+	{0x78,0x3A},// P 48
+	{0x78,0x3B},// Q 49
+	{0x89,0x3A},// R 50
+	{0x67,0x3A},// S 51
+	{0x78,0x3A},// T 52
+	{0x89,0x3A},// U 53
+	{0x89,0x3A},// V 54
+	{0x78,0x3A},// W 55
+	{0x89,0x3A},// X 56
+	{0x78,0x3A},// Y 57
+	{0x78,0x3A},// Z 58
+	{0x45,0x1D},// [ 59
+	{0x67,0x2D},// \ 60
+	{0x45,0x1D},// ] 61
+	{0x78,0x23},// ^ 62
+	{0x89,0xF0},// _ 63
+	{0x34,0x12},// ` 64
+	{0x78,0x76},// a 65
+	{0x78,0x3A},// b 66
+	{0x67,0x76},// c 67
+	{0x78,0x3A},// d 68
+	{0x67,0x76},// e 69
+	{0x78,0x3A},// f 70
+	{0x67,0x78},// g 71
+	{0x89,0x3A},// h 72
+	{0x56,0x3A},// i 73
+	{0x56,0x3C},// j 74
+	{0x78,0x3A},// k 75
+	{0x56,0x3A},// l 76
+	{0x89,0x76},// m 77
+	{0x78,0x76},// n 78
+	{0x67,0x76},// o 79
+	{0x78,0x78},// p 80
+	{0x78,0x78},// q 81
+	{0x78,0x76},// r 82
+	{0x67,0x76},// s 83
+	{0x56,0x58},// t 84
+	{0x89,0x76},// u 85
+	{0x89,0x76},// v 86
+	{0x89,0x76},// w 87
+	{0x67,0x76},// x 88
+	{0x89,0x78},// y 89
+	{0x67,0x76},// z 90
+	{0x45,0x1D},// { 91
+	{0x12,0x0F},// | 92
+	{0x45,0x1D},// } 93
+	{0x78,0x62},// ~ 94
+};
+
+static const uint16_t Font_Prop16_Index[] =
+{
+	0,362,703,1220,1631,2258,2888,3533,4007,4434,4921,5351,
+};
+
+const Font_t Font_Prop16 = {Font_Prop16_Bitmap, Font_Prop16_Glyph, Font_Prop16_Index, ' ', '~', 16};
+
+/*由EPD_F6x8裁剪空白生成，行高8像素*/
+static const uint8_t Font_Prop8_Bitmap[] =
+{
+	0xEF,0x71,0xCA,0x9F,0xF2,0xA7,0x90,0x54,0x7F,0x95,0x64,0x34,0x41,0x90,0xC5,0xB6,
+	0x64,0x55,0x04,0x3D,0x47,0x14,0x0C,0x8A,0x38,0x8A,0x7C,0xA2,0x08,0xF9,0x84,0x74,
+	0xFF,0x21,0x22,0x22,0xF8,0xA2,0xC9,0xA2,0x4F,0xF8,0x07,0x0A,0xC3,0xD1,0xA4,0x31,
+	0x14,0x2C,0x2E,0x63,0x18,0x8A,0xE4,0x0F,0x39,0x15,0x8B,0xC5,0x1C,0x4F,0x99,0x4C,
+	0xC2,0x02,0xF1,0x44,0x61,0x60,0x4B,0x26,0x93,0x36,0x43,0x32,0x99,0xF2,0xEC,0xBD,
+	0x6E,0x08,0x8A,0x28,0xD8,0xB6,0x0D,0x8A,0x28,0x08,0x41,0x20,0x9A,0x30,0xF8,0x92,
+	0xD5,0xAC,0x8B,0x2F,0x89,0x48,0xF8,0xFF,0x64,0x32,0x69,0xF3,0x05,0x83,0x41,0xD1,
+	0x3F,0x18,0x14,0x71,0xFE,0xC9,0x64,0x32,0xF8,0x4F,0x24,0x12,0x01,0x5F,0x30,0x99,
+	0xD4,0xFF,0x11,0x08,0xC4,0x3F,0xF8,0x0F,0x82,0x80,0xC1,0x5F,0xE0,0x8F,0xA0,0x88,
+	0x82,0x7F,0x20,0x10,0x08,0xFC,0x0B,0x18,0x82,0xFF,0x9F,0x80,0x80,0xFC,0x7D,0xC1,
+	0x60,0xD0,0xF7,0x4F,0x24,0x12,0x06,0x5F,0x30,0x1A,0xF2,0xFE,0x13,0x99,0x94,0xD1,
+	0x98,0x4C,0x26,0x63,0x81,0xC0,0x3F,0x10,0xF8,0x01,0x81,0xC0,0xDF,0x07,0x04,0x04,
+	0x7D,0x7E,0x40,0x1C,0xF0,0x37,0xA6,0x20,0x28,0xE3,0x03,0x02,0x8E,0x38,0x84,0xA3,
+	0xC9,0xE2,0xF0,0x1F,0x0C,0x06,0x41,0x10,0x0C,0x06,0xFF,0x54,0xC4,0x1F,0x11,0xD5,
+	0x5A,0xFD,0x1F,0x49,0x24,0xE2,0x5C,0x8C,0x11,0xE1,0x88,0x44,0xE4,0xDF,0xD5,0x5A,
+	0x0D,0xC2,0x9F,0x08,0x08,0x8C,0x34,0x4D,0xBF,0x3F,0x82,0x40,0xC0,0x13,0xFB,0x40,
+	0x20,0x40,0xC2,0xBE,0x3F,0x04,0x45,0x0C,0xFE,0x81,0x3F,0x98,0xE0,0xBF,0x08,0xC1,
+	0xBB,0x18,0xA3,0xFB,0x93,0x24,0x31,0x8C,0x24,0x31,0xFE,0x2F,0x42,0x10,0xB2,0xD6,
+	0x8A,0x08,0x3F,0x22,0x10,0xF4,0x20,0x44,0xFF,0x20,0x88,0xCE,0x83,0x0C,0xBE,0xA8,
+	0x88,0x8A,0x07,0x8A,0xA2,0x5F,0xCC,0x75,0x46,0xC4,0x3F,0xF8,0x0F,0xFE,0x11,0x8A,
+	0x28,0x00,0x00,
+};
+
+static const FontGlyph_t Font_Prop8_Glyph[] =
+{
+	{0x03,0x00},//   0
+	{0x12,0x05},// ! 1
+	{0x34,0x02},// " 2
+	{0x56,0x06},// # 3
+	{0x56,0x06},// $ 4
+	{0x56,0x06},// % 5
+	{0x56,0x06},// & 6
+	{0x12,0x02},// ' 7
+	{0x34,0x06},// ( 8
+	{0x34,0x06},// ) 9
+	{0x56,0x14},// * 10
+	{0x56,0x14},// + 11
+	{0x23,0x52},// , 12
+	{0x56,0x30},// - 13
+	{0x23,0x51},// . 14
+	{0x56,0x14},// / 15
+	{0x56,0x06},// 0 16
+	{0x34,0x06},// 1 17
+	{0x56,0x06},// 2 18
+	{0x56,0x06},// 3 19
+	{0x56,0x06},// 4 20
+	{0x56,0x06},// 5 21
+	{0x56,0x06},// 6 22
+	{0x56,0x06},// 7 23
+	{0x56,0x06},// 8 24
+	{0x56,0x06},// 9 25
+	{0x23,0x14},// : 26
+	{0x23,0x15},// ; 27
+	{0x45,0x06},// < 28
+	{0x56,0x22},// = 29
+	{0x45,0x06},// > 30
+	{0x56,0x06},// ? 31
+	{0x56,0x06},// @ 32
+	{0x56,0x06},// A 33
+	{0x56,0x06},// B 34
+	{0x56,0x06},// C 35
+	{0x56,0x06},// D 36
+	{0x56,0x06},// E 37
+	{0x56,0x06},// F 38
+	{0x56,0x06},// G 39
+	{0x56,0x06},// H 40
+	{0x34,0x06},// I 41
+	{0x56,0x06},// J 42
+	{0x56,0x06},// K 43
+	{0x56,0x06},// L 44
+	{0x56,0x06},// M 45
+	{0x56,0x06},// N 46
+	{0x56,0x06},// O 47
+	{0x56,0x06},// P 48
+	{0x56,0x06},// Q 49
+	{0x56,0x06},// R 50
+	{0x56,0x06},// S 51
+	{0x56,0x06},// T 52
+	{0x56,0x06},// U 53
+	{0x56,0x06},// V 54
+	{0x56,0x06},// W 55
+	{0x56,0x06},// X 56
+	{0x56,0x06},// Y 57
+	{0x56,0x06},// Z 58
+	{0x34,0x06},// [ 59
+	{0x56,0x14},// \ 60
+	{0x34,0x06},// ] 61
+	{0x56,0x02},// ^ 62
+	{0x56,0x60},// _ 63
+	{0x34,0x02},// ` 64
+	{0x56,0x24},// a 65
+	{0x56,0x06},// b 66
+	{0x56,0x24},// c 67
+	{0x56,0x06},// d 68
+	{0x56,0x24},// e 69
+	{0x56,0x06},// f 70
+	{0x56,0x25},// g 71
+	{0x56,0x06},// h 72
+	{0x34,0x06},// i 73
+	{0x45,0x07},// j 74
+	{0x45,0x06},// k 75
+	{0x34,0x06},// l 76
+	{0x56,0x24},// m 77
+	{0x56,0x24},// n 78
+	{0x56,0x24},// o 79
+	{0x56,0x25},// p 80
+	{0x56,0x25},// q 81
+	{0x56,0x24},// r 82
+	{0x56,0x24},// s 83
+	{0x56,0x06},// t 84
+	{0x56,0x24},// u 85
+	{0x56,0x24},// v 86
+	{0x56,0x24},// w 87
+	{0x56,0x24},// x 88
+	{0x56,0x25},// y 89
+	{0x56,0x24},// z 90
+	{0x34,0x06},// { 91
+	{0x12,0x06},// | 92
+	{0x34,0x06},// } 93
+	{0x56,0x22},// ~ 94
+};
+
+static const uint16_t Font_Prop8_Index[] =
+{
+	0,158,290,556,754,1034,1300,1580,1772,1991,2203,2423,
+};
+
+const Font_t Font_Prop8 = {Font_Prop8_Bitmap, Font_Prop8_Glyph, Font_Prop8_Index, ' ', '~', 8};
+
+/*********************比例字体数据*/
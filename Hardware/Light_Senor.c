@@ -1,4 +1,44 @@
 #include "stm32f10x.h"                  // Device header
+#include "Light_Senor.h"
+#include "Sched.h"
+#include "Power.h"
+
+/*亮暗状态*/
+#define LIGHTSENOR_STATE_UNKNOWN	0
+#define LIGHTSENOR_STATE_DARK		1
+#define LIGHTSENOR_STATE_BRIGHT		2
+
+/*全局变量*********************/
+
+/*DMA循环缓冲区，前后两半轮流由DMA写入、由中断处理*/
+static uint16_t LightSenor_Buf[2][LIGHTSENOR_OVERSAMPLE];
+
+/*中值滤波的最近3个值与IIR累加器，累加器为输出值的2^LIGHTSENOR_IIR_SHIFT倍*/
+static uint16_t LightSenor_History[3];
+static uint32_t LightSenor_Acc;
+
+/*滤波后的值与输出值个数*/
+static volatile uint16_t LightSenor_Value;
+static volatile uint32_t LightSenor_Count;
+
+/*阈值，低于Low为暗，高于High为亮，两者之间保持原状态*/
+static uint16_t LightSenor_Low = 0x3000;
+static uint16_t LightSenor_High = 0x4000;
+static uint8_t LightSenor_State;
+
+/*事件队列，Head只由DMA中断写，Tail只由主循环写*/
+static LightSenor_Event_t LightSenor_Queue[LIGHTSENOR_QUEUE_SIZE];
+static volatile uint8_t LightSenor_Head;
+static volatile uint8_t LightSenor_Tail;
+
+/*产生事件时通知的任务*/
+static uint8_t LightSenor_TaskId = SCHED_INVALID;
+static uint32_t LightSenor_TaskEvents;
+
+/*********************全局变量*/
+
+
+/*数字方式*********************/
 
 void LightSenor_Init(void)
 {
@@ -15,3 +55,286 @@ uint8_t LightSenor_Get()
 {
 	return GPIO_ReadInputDataBit(GPIOA,GPIO_Pin_0);
 }
+
+/*********************数字方式*/
+
+
+/*模拟方式*********************/
+
+/**
+  * 函    数：模拟方式初始化
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：ADC时钟12MHz，采样时间239.5周期，每次转换21us，每个输出值约5.4ms
+  *           ADC连续转换，DMA1通道1循环传输，半满与全满时中断，初始化后需调用LightSenor_Start开始采样
+  *           本函数不改变引脚配置，可在EPD工作时调用
+  */
+void LightSenor_AnalogInit(void)
+{
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA | RCC_APB2Periph_ADC1, ENABLE);
+	RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+	RCC_ADCCLKConfig(RCC_PCLK2_Div6);
+	
+	ADC_InitTypeDef ADC_InitStructure;
+	ADC_InitStructure.ADC_Mode = ADC_Mode_Independent;
+	ADC_InitStructure.ADC_ScanConvMode = DISABLE;
+	ADC_InitStructure.ADC_ContinuousConvMode = ENABLE;
+	ADC_InitStructure.ADC_ExternalTrigConv = ADC_ExternalTrigConv_None;
+	ADC_InitStructure.ADC_DataAlign = ADC_DataAlign_Right;
+	ADC_InitStructure.ADC_NbrOfChannel = 1;
+	ADC_Init(ADC1, &ADC_InitStructure);
+	ADC_RegularChannelConfig(ADC1, LIGHTSENOR_CHANNEL, 1, ADC_SampleTime_239Cycles5);
+	
+	DMA_InitTypeDef DMA_InitStructure;
+	DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&ADC1->DR;
+	DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+	DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)LightSenor_Buf;
+	DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+	DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralSRC;
+	DMA_InitStructure.DMA_BufferSize = 2 * LIGHTSENOR_OVERSAMPLE;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+	DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+	DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+	DMA_Init(DMA1_Channel1, &DMA_InitStructure);
+	DMA_ITConfig(DMA1_Channel1, DMA_IT_HT | DMA_IT_TC, ENABLE);
+	
+	NVIC_InitTypeDef NVIC_InitStructure;
+	NVIC_InitStructure.NVIC_IRQChannel = DMA1_Channel1_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 2;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+	
+	/*上电校准，只在初始化时等待一次*/
+	ADC_DMACmd(ADC1, ENABLE);
+	ADC_Cmd(ADC1, ENABLE);
+	ADC_ResetCalibration(ADC1);
+	while (ADC_GetResetCalibrationStatus(ADC1) == SET);
+	ADC_StartCalibration(ADC1);
+	while (ADC_GetCalibrationStatus(ADC1) == SET);
+	ADC_Cmd(ADC1, DISABLE);
+}
+
+/**
+  * 函    数：开始模拟采样
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：把引脚设为模拟输入，滤波器从第一个输出值重新开始
+  *           亮暗状态在停止期间保持，重新开始后只在状态变化时产生事件，上电后第一次开始时总会产生一次事件
+  *           采样期间禁止进入STOP模式，不需要时调用LightSenor_Stop停止，以便休眠
+  */
+void LightSenor_Start(void)
+{
+	GPIO_InitTypeDef GPIO_InitStructure;
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AIN;
+	GPIO_InitStructure.GPIO_Pin = LIGHTSENOR_PIN;
+	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+	GPIO_Init(GPIOA, &GPIO_InitStructure);
+	
+	/*STOP唤醒后Power_Idle调用SystemInit，会把ADC分频复位为2（36MHz，超过14MHz的上限），每次开始前重新设置*/
+	RCC_ADCCLKConfig(RCC_PCLK2_Div6);
+	
+	LightSenor_Count = 0;
+	Power_Block(POWER_BLOCK_LIGHT);
+	
+	DMA_Cmd(DMA1_Channel1, DISABLE);
+	DMA_SetCurrDataCounter(DMA1_Channel1, 2 * LIGHTSENOR_OVERSAMPLE);
+	DMA_ClearITPendingBit(DMA1_IT_GL1);
+	DMA_Cmd(DMA1_Channel1, ENABLE);
+	
+	ADC_Cmd(ADC1, ENABLE);
+	ADC_SoftwareStartConvCmd(ADC1, ENABLE);
+}
+
+/**
+  * 函    数：停止模拟采样
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：关闭ADC与DMA，LightSenor_GetValue仍返回停止前最后的值
+  *           引脚保持模拟输入，与EPD共用时需调用EPD_Resume恢复EPD的引脚
+  */
+void LightSenor_Stop(void)
+{
+	ADC_Cmd(ADC1, DISABLE);
+	DMA_Cmd(DMA1_Channel1, DISABLE);
+	Power_Unblock(POWER_BLOCK_LIGHT);
+}
+
+/**
+  * 函    数：获取滤波后的值
+  * 参    数：无
+  * 返 回 值：16位的亮度值，越大越亮（LIGHTSENOR_INVERT为1时）
+  */
+uint16_t LightSenor_GetValue(void)
+{
+	return LightSenor_Value;
+}
+
+/**
+  * 函    数：获取开始采样以来的输出值个数
+  * 参    数：无
+  * 返 回 值：输出值个数，为0时LightSenor_GetValue的值还不是本次采样的结果
+  */
+uint32_t LightSenor_GetCount(void)
+{
+	return LightSenor_Count;
+}
+
+/**
+  * 函    数：设置亮暗阈值
+  * 参    数：Low 下限，滤波后的值低于Low时变为暗
+  * 参    数：High 上限，滤波后的值高于High时变为亮，应大于Low，两者之差即回差
+  * 返 回 值：无
+  */
+void LightSenor_SetThreshold(uint16_t Low, uint16_t High)
+{
+	LightSenor_Low = Low;
+	LightSenor_High = High;
+}
+
+/**
+  * 函    数：设置产生事件时通知的任务
+  * 参    数：Id 任务编号，Sched_Add的返回值，SCHED_INVALID表示不通知
+  * 参    数：Events 投递给该任务的事件
+  * 返 回 值：无
+  */
+void LightSenor_SetTask(uint8_t Id, uint32_t Events)
+{
+	LightSenor_TaskEvents = Events;
+	LightSenor_TaskId = Id;
+}
+
+/**
+  * 函    数：取出一个亮暗事件
+  * 参    数：Event 取出的事件
+  * 返 回 值：1：取出成功，0：队列为空
+  * 说    明：只能在主循环（单个消费者）中调用
+  */
+uint8_t LightSenor_Read(LightSenor_Event_t *Event)
+{
+	uint8_t Tail = LightSenor_Tail;
+	
+	if (Tail == LightSenor_Head) {return 0;}
+	*Event = LightSenor_Queue[Tail % LIGHTSENOR_QUEUE_SIZE];
+	LightSenor_Tail = Tail + 1;
+	return 1;
+}
+
+/*********************模拟方式*/
+
+
+/*中断函数*********************/
+
+/**
+  * 函    数：事件入队
+  * 参    数：Type 事件类型
+  * 参    数：Value 滤波后的值
+  * 返 回 值：无
+  */
+static void LightSenor_Push(uint8_t Type, uint16_t Value)
+{
+	uint8_t Head = LightSenor_Head;
+	
+	if ((uint8_t)(Head - LightSenor_Tail) >= LIGHTSENOR_QUEUE_SIZE) {return;}
+	LightSenor_Queue[Head % LIGHTSENOR_QUEUE_SIZE].Type = Type;
+	LightSenor_Queue[Head % LIGHTSENOR_QUEUE_SIZE].Value = Value;
+	LightSenor_Head = Head + 1;
+	
+	Sched_Post(LightSenor_TaskId, LightSenor_TaskEvents);
+}
+
+/**
+  * 函    数：处理半个缓冲区
+  * 参    数：Buf 半个缓冲区，LIGHTSENOR_OVERSAMPLE个12位采样
+  * 返 回 值：无
+  * 说    明：过采样累加、中值滤波、IIR低通、阈值判断
+  */
+static void LightSenor_Process(const uint16_t *Buf)
+{
+	uint32_t Sum = 0;
+	uint16_t i, Value, A, B, C;
+	
+	for (i = 0; i < LIGHTSENOR_OVERSAMPLE; i ++)
+	{
+		Sum += Buf[i];
+	}
+	Value = (uint16_t)(Sum >> LIGHTSENOR_SHIFT);
+#if LIGHTSENOR_INVERT
+	Value = 0xFFFF - Value;
+#endif
+	
+	/*第一个值同时作为中值与IIR的初值*/
+	if (LightSenor_Count == 0)
+	{
+		LightSenor_History[0] = LightSenor_History[1] = Value;
+		LightSenor_Acc = (uint32_t)Value << LIGHTSENOR_IIR_SHIFT;
+	}
+	
+	/*3点中值*/
+	A = LightSenor_History[0];
+	B = LightSenor_History[1];
+	C = Value;
+	LightSenor_History[0] = B;
+	LightSenor_History[1] = C;
+	if ((A <= B && B <= C) || (C <= B && B <= A)) {Value = B;}
+	else if ((B <= A && A <= C) || (C <= A && A <= B)) {Value = A;}
+	else {Value = C;}
+	
+	/*一阶IIR：Acc = Acc - Acc / 2^SHIFT + Value，稳定时Acc为Value的2^SHIFT倍*/
+	LightSenor_Acc -= LightSenor_Acc >> LIGHTSENOR_IIR_SHIFT;
+	LightSenor_Acc += Value;
+	Value = (uint16_t)(LightSenor_Acc >> LIGHTSENOR_IIR_SHIFT);
+	LightSenor_Value = Value;
+	LightSenor_Count ++;
+	
+	/*带回差的阈值*/
+	if (LightSenor_State != LIGHTSENOR_STATE_DARK && Value < LightSenor_Low)
+	{
+		LightSenor_State = LIGHTSENOR_STATE_DARK;
+		LightSenor_Push(LIGHTSENOR_EVENT_DARK, Value);
+	}
+	else if (LightSenor_State != LIGHTSENOR_STATE_BRIGHT && Value > LightSenor_High)
+	{
+		LightSenor_State = LIGHTSENOR_STATE_BRIGHT;
+		LightSenor_Push(LIGHTSENOR_EVENT_BRIGHT, Value);
+	}
+	else if (LightSenor_State == LIGHTSENOR_STATE_UNKNOWN)
+	{
+		/*首个值落在回差区间内时，按靠近哪一侧决定初始状态*/
+		if (Value - LightSenor_Low < LightSenor_High - Value)
+		{
+			LightSenor_State = LIGHTSENOR_STATE_DARK;
+			LightSenor_Push(LIGHTSENOR_EVENT_DARK, Value);
+		}
+		else
+		{
+			LightSenor_State = LIGHTSENOR_STATE_BRIGHT;
+			LightSenor_Push(LIGHTSENOR_EVENT_BRIGHT, Value);
+		}
+	}
+}
+
+/**
+  * 函    数：DMA中断处理
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：在DMA1_Channel1_IRQHandler中调用，半满时处理前一半，全满时处理后一半
+  *           处理一半约需1000个周期（14us），远小于DMA写满另一半的时间（约5.4ms），不会被DMA覆盖
+  */
+void LightSenor_DmaHandler(void)
+{
+	if (DMA_GetITStatus(DMA1_IT_HT1))
+	{
+		DMA_ClearITPendingBit(DMA1_IT_HT1);
+		LightSenor_Process(LightSenor_Buf[0]);
+	}
+	if (DMA_GetITStatus(DMA1_IT_TC1))
+	{
+		DMA_ClearITPendingBit(DMA1_IT_TC1);
+		LightSenor_Process(LightSenor_Buf[1]);
+	}
+}
+
+/*********************中断函数*/
@@ -1,8 +1,73 @@
 #ifndef __LIGHT_SENOR_H__
 #define __LIGHT_SENOR_H__
 
+#include <stdint.h>
+
+/**
+  * 光敏传感器
+  * 数字方式：LightSenor_Init/LightSenor_Get读取模块比较器的输出，只有亮暗1位
+  * 模拟方式：ADC1连续转换，DMA循环写入双缓冲区，每半个缓冲区（LIGHTSENOR_OVERSAMPLE个采样）产生一次DMA中断，
+  *           中断中累加过采样得到16位的值，再经3点中值滤波去除尖峰、一阶IIR低通平滑，
+  *           按带回差的阈值判断亮暗，亮暗变化时产生事件，写入单生产者单消费者队列，主循环用LightSenor_Read取出
+  *           采样、滤波与阈值判断全部由DMA与中断完成，主循环不需要轮询ADC
+  * 注意：默认的PA0同时是EPD的SCL引脚，LightSenor_Start把PA0设为模拟输入，采样期间不能刷新EPD，
+  *       LightSenor_Stop之后调用EPD_Resume恢复EPD的引脚，Ambient模块按此方式分时使用PA0
+  *       硬件上把传感器接到其他ADC引脚时，修改LIGHTSENOR_PIN与LIGHTSENOR_CHANNEL即可
+  */
+
+/*参数宏定义*********************/
+
+/*模拟输入引脚与ADC通道，PA0为ADC1通道0*/
+#define LIGHTSENOR_PIN				GPIO_Pin_0
+#define LIGHTSENOR_CHANNEL			ADC_Channel_0
+
+/*每个输出值的过采样次数，4的n次方个采样可多得到n位，256次由12位得到16位*/
+#define LIGHTSENOR_OVERSAMPLE		256
+#define LIGHTSENOR_SHIFT			4		//累加和右移的位数，使结果为16位
+
+/*IIR低通的系数，每次输出向新值靠近1/2^LIGHTSENOR_IIR_SHIFT*/
+#define LIGHTSENOR_IIR_SHIFT		3
+
+/*常见光敏电阻模块光线越暗电压越高，为1时反转，使输出值越大表示越亮*/
+#define LIGHTSENOR_INVERT			1
+
+/*事件队列长度，必须为2的整数次方，队列满时丢弃新事件*/
+#define LIGHTSENOR_QUEUE_SIZE		8
+
+/*事件类型，LightSenor_Event_t的Type取值*/
+#define LIGHTSENOR_EVENT_DARK		1		//滤波后的值低于下限
+#define LIGHTSENOR_EVENT_BRIGHT		2		//滤波后的值高于上限
+
+/*********************参数宏定义*/
+
+
+/*事件描述*********************/
+
+typedef struct
+{
+	uint8_t Type;		//事件类型，LIGHTSENOR_EVENT_*
+	uint16_t Value;		//产生事件时滤波后的值
+} LightSenor_Event_t;
+
+/*********************事件描述*/
+
+
+/*函数声明*********************/
+
 void LightSenor_Init(void);
 uint8_t LightSenor_Get(void);
 
+void LightSenor_AnalogInit(void);
+void LightSenor_Start(void);
+void LightSenor_Stop(void);
+uint16_t LightSenor_GetValue(void);
+uint32_t LightSenor_GetCount(void);
+void LightSenor_SetThreshold(uint16_t Low, uint16_t High);
+void LightSenor_SetTask(uint8_t Id, uint32_t Events);
+uint8_t LightSenor_Read(LightSenor_Event_t *Event);
+
+void LightSenor_DmaHandler(void);
+
+/*********************函数声明*/
 
 #endif
@@ -22,8 +22,10 @@
 #include "OLED.h"
 #include <string.h>
 #include <math.h>
-#include <stdio.h>
 #include <stdarg.h>
+#include "Format.h"
+#include "Canvas.h"
+#include "Trace.h"
 
 /**
   * 数据存储格式：
@@ -299,6 +301,18 @@ void OLED_Init(void)
 	OLED_Update();				//更新显示，清屏，防止初始化后未显示内容时花屏
 }
 
+/**
+  * 函    数：OLED设置对比度
+  * 参    数：Contrast 对比度，范围：0x00~0xFF，OLED_Init设置为0xCF
+  * 返 回 值：无
+  * 说    明：对比度决定像素的驱动电流，降低对比度可减小亮度与功耗，不影响显存内容
+  */
+void OLED_SetContrast(uint8_t Contrast)
+{
+	OLED_WriteCommand(0x81);	//设置对比度
+	OLED_WriteCommand(Contrast);
+}
+
 /**
   * 函    数：OLED设置显示光标位置
   * 参    数：Page 指定光标所在的页，范围：0~7
@@ -397,6 +411,114 @@ uint8_t OLED_IsInAngle(int16_t X, int16_t Y, int16_t StartAngle, int16_t EndAngl
 	return 0;		//不满足以上条件，则判断判定指定点不在指定角度
 }
 
+/**
+  * 函    数：解码字符串中的一个字符
+  * 参    数：String 指向字符的首字节
+  * 参    数：Code 用于返回字符编码，UTF-8格式下为Unicode码点，GB2312格式下为两字节内码
+  * 返 回 值：该字符占用的字节数，遇到不完整或非法的编码时，返回已检查的字节数，Code为0xFFFD
+  * 说    明：ASCII字符占用1个字节，编码格式由OLED_CHN_CHAR_WIDTH决定
+  */
+uint8_t OLED_DecodeChar(const char *String, uint32_t *Code)
+{
+	uint8_t Byte = String[0];
+#if OLED_CHN_CHAR_WIDTH == 3
+	uint8_t Length, i;
+#endif
+	
+	if (Byte < 0x80)						//ASCII字符
+	{
+		*Code = Byte;
+		return 1;
+	}
+	
+#if OLED_CHN_CHAR_WIDTH == 3
+	/*UTF-8格式，由首字节确定长度*/
+	if ((Byte & 0xE0) == 0xC0)		{Length = 2; *Code = Byte & 0x1F;}
+	else if ((Byte & 0xF0) == 0xE0)	{Length = 3; *Code = Byte & 0x0F;}
+	else if ((Byte & 0xF8) == 0xF0)	{Length = 4; *Code = Byte & 0x07;}
+	else							//孤立的后续字节或非法首字节
+	{
+		*Code = 0xFFFD;
+		return 1;
+	}
+	
+	for (i = 1; i < Length; i ++)
+	{
+		Byte = String[i];
+		if ((Byte & 0xC0) != 0x80)	//后续字节不足，不越过字符串结尾
+		{
+			*Code = 0xFFFD;
+			return i;
+		}
+		*Code = (*Code << 6) | (Byte & 0x3F);
+	}
+	return Length;
+#else
+	/*GB2312格式，高位为1的字节与下一字节组成一个汉字*/
+	if (String[1] == '\0')			//后续字节缺失，不越过字符串结尾
+	{
+		*Code = 0xFFFD;
+		return 1;
+	}
+	*Code = ((uint32_t)Byte << 8) | (uint8_t)String[1];
+	return 2;
+#endif
+}
+
+/**
+  * 函    数：在汉字字模库中查找指定汉字
+  * 参    数：Code 汉字编码，由OLED_DecodeChar得到
+  * 返 回 值：汉字在OLED_CF16x16中的索引，未找到时返回默认图形的索引
+  * 说    明：字模库按编码从小到大排列，使用二分查找，5000个汉字最多比较13次
+  */
+uint16_t OLED_FindChinese(uint32_t Code)
+{
+	uint16_t Low = 0, High = OLED_CF16x16_Num, Mid;
+	uint32_t MidCode;
+	
+	while (Low < High)
+	{
+		Mid = (Low + High) / 2;
+		OLED_DecodeChar(OLED_CF16x16[Mid].Index, &MidCode);
+		if (MidCode < Code)
+		{
+			Low = Mid + 1;
+		}
+		else if (MidCode > Code)
+		{
+			High = Mid;
+		}
+		else
+		{
+			return Mid;
+		}
+	}
+	return OLED_CF16x16_Num;		//未找到，返回末尾的默认图形
+}
+
+/*格式化打印的光标，供OLED_PrintfPut逐字符显示使用*/
+typedef struct
+{
+	int16_t X;
+	int16_t Y;
+	uint8_t FontSize;
+} OLED_Cursor_t;
+
+/**
+  * 函    数：格式化打印的字符输出函数
+  * 参    数：Char 要显示的字符
+  * 参    数：Arg 光标，类型为OLED_Cursor_t *
+  * 返 回 值：无
+  * 说    明：由Format_Stream逐字符调用，显示后光标右移一个字符宽度
+  */
+static void OLED_PrintfPut(char Char, void *Arg)
+{
+	OLED_Cursor_t *Cursor = Arg;
+	
+	OLED_ShowChar(Cursor->X, Cursor->Y, Char, Cursor->FontSize);
+	Cursor->X += Cursor->FontSize;
+}
+
 /*********************工具函数*/
 
 
@@ -414,6 +536,7 @@ uint8_t OLED_IsInAngle(int16_t X, int16_t Y, int16_t StartAngle, int16_t EndAngl
 void OLED_Update(void)
 {
 	uint8_t j;
+	TRACE_BEGIN(TRACE_OLED_UPDATE);
 	/*遍历每一页*/
 	for (j = 0; j < 8; j ++)
 	{
@@ -422,6 +545,7 @@ void OLED_Update(void)
 		/*连续写入128个数据，将显存数组的数据写入到OLED硬件*/
 		OLED_WriteData(OLED_DisplayBuf[j], 128);
 	}
+	TRACE_END(TRACE_OLED_UPDATE);
 }
 
 /**
@@ -590,7 +714,7 @@ void OLED_ShowChar(int16_t X, int16_t Y, char Char, uint8_t FontSize)
   */
 void OLED_ShowString(int16_t X, int16_t Y, char *String, uint8_t FontSize)
 {
-	uint8_t i;
+	uint16_t i;
 	for (i = 0; String[i] != '\0'; i++)		//遍历字符串的每个字符
 	{
 		/*调用OLED_ShowChar函数，依次显示每个字符*/
@@ -598,12 +722,59 @@ void OLED_ShowString(int16_t X, int16_t Y, char *String, uint8_t FontSize)
 	}
 }
 
+/**
+  * 函    数：OLED放大显示一个字符
+  * 参    数：X 指定字符左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：Y 指定字符左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
+  * 参    数：Char 指定要显示的字符，范围：ASCII码可见字符
+  * 参    数：FontSize 指定字体大小
+  *           范围：OLED_8X16		宽8像素，高16像素
+  *                 OLED_6X8		宽6像素，高8像素
+  * 参    数：Zoom 放大倍数，范围：1~4，显示的字符宽高均为原来的Zoom倍
+  * 返 回 值：无
+  * 说    明：直接由OLED_F8x16与OLED_F6x8的字模查表放大，不需要额外的大字体字模
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void OLED_ShowZoomChar(int16_t X, int16_t Y, char Char, uint8_t FontSize, uint8_t Zoom)
+{
+	if (FontSize == OLED_8X16)		//字体为宽8像素，高16像素
+	{
+		Canvas_DrawZoomImage(&OLED_Canvas, X, Y, 8, 16, OLED_F8x16[Char - ' '], Zoom);
+	}
+	else if (FontSize == OLED_6X8)	//字体为宽6像素，高8像素
+	{
+		Canvas_DrawZoomImage(&OLED_Canvas, X, Y, 6, 8, OLED_F6x8[Char - ' '], Zoom);
+	}
+}
+
+/**
+  * 函    数：OLED放大显示字符串
+  * 参    数：X 指定字符串左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：Y 指定字符串左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
+  * 参    数：String 指定要显示的字符串，范围：ASCII码可见字符组成的字符串
+  * 参    数：FontSize 指定字体大小
+  *           范围：OLED_8X16		宽8像素，高16像素
+  *                 OLED_6X8		宽6像素，高8像素
+  * 参    数：Zoom 放大倍数，范围：1~4
+  * 返 回 值：无
+  * 说    明：每个字符的横向间隔为FontSize * Zoom
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void OLED_ShowZoomString(int16_t X, int16_t Y, char *String, uint8_t FontSize, uint8_t Zoom)
+{
+	uint16_t i;
+	for (i = 0; String[i] != '\0'; i++)		//遍历字符串的每个字符
+	{
+		OLED_ShowZoomChar(X + i * FontSize * Zoom, Y, String[i], FontSize, Zoom);
+	}
+}
+
 /**
   * 函    数：OLED显示数字（十进制，正整数）
   * 参    数：X 指定数字左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
   * 参    数：Y 指定数字左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
   * 参    数：Number 指定要显示的数字，范围：0~4294967295
-  * 参    数：Length 指定数字的长度，范围：0~10
+  * 参    数：Length 指定数字的长度，范围：0~255，超过10位时高位显示0
   * 参    数：FontSize 指定字体大小
   *           范围：OLED_8X16		宽8像素，高16像素
   *                 OLED_6X8		宽6像素，高8像素
@@ -612,14 +783,19 @@ void OLED_ShowString(int16_t X, int16_t Y, char *String, uint8_t FontSize)
   */
 void OLED_ShowNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize)
 {
-	uint8_t i;
-	for (i = 0; i < Length; i++)		//遍历数字的每一位							
+	char String[11];
+	
+	/*超出缓冲区的高位全部为0，先逐个显示前导0*/
+	while (Length > 10)
 	{
-		/*调用OLED_ShowChar函数，依次显示每个数字*/
-		/*Number / OLED_Pow(10, Length - i - 1) % 10 可以十进制提取数字的每一位*/
-		/*+ '0' 可将数字转换为字符格式*/
-		OLED_ShowChar(X + i * FontSize, Y, Number / OLED_Pow(10, Length - i - 1) % 10 + '0', FontSize);
+		OLED_ShowChar(X, Y, '0', FontSize);
+		X += FontSize;
+		Length --;
 	}
+	
+	/*逐位提取数字并转换为字符，再作为字符串一次显示*/
+	Format_Dec(String, Number, Length);
+	OLED_ShowString(X, Y, String, FontSize);
 }
 
 /**
@@ -627,7 +803,7 @@ void OLED_ShowNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t
   * 参    数：X 指定数字左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
   * 参    数：Y 指定数字左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
   * 参    数：Number 指定要显示的数字，范围：-2147483648~2147483647
-  * 参    数：Length 指定数字的长度，范围：0~10
+  * 参    数：Length 指定数字的长度，范围：0~255，超过10位时高位显示0
   * 参    数：FontSize 指定字体大小
   *           范围：OLED_8X16		宽8像素，高16像素
   *                 OLED_6X8		宽6像素，高8像素
@@ -636,7 +812,7 @@ void OLED_ShowNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t
   */
 void OLED_ShowSignedNum(int16_t X, int16_t Y, int32_t Number, uint8_t Length, uint8_t FontSize)
 {
-	uint8_t i;
+	char String[11];
 	uint32_t Number1;
 	
 	if (Number >= 0)						//数字大于等于0
@@ -647,16 +823,21 @@ void OLED_ShowSignedNum(int16_t X, int16_t Y, int32_t Number, uint8_t Length, ui
 	else									//数字小于0
 	{
 		OLED_ShowChar(X, Y, '-', FontSize);	//显示-号
-		Number1 = -Number;					//Number1等于Number取负
+		Number1 = 0 - (uint32_t)Number;		//Number1等于Number取负
 	}
+	X += FontSize;
 	
-	for (i = 0; i < Length; i++)			//遍历数字的每一位								
+	/*超出缓冲区的高位全部为0，先逐个显示前导0*/
+	while (Length > 10)
 	{
-		/*调用OLED_ShowChar函数，依次显示每个数字*/
-		/*Number1 / OLED_Pow(10, Length - i - 1) % 10 可以十进制提取数字的每一位*/
-		/*+ '0' 可将数字转换为字符格式*/
-		OLED_ShowChar(X + (i + 1) * FontSize, Y, Number1 / OLED_Pow(10, Length - i - 1) % 10 + '0', FontSize);
+		OLED_ShowChar(X, Y, '0', FontSize);
+		X += FontSize;
+		Length --;
 	}
+	
+	/*符号之后逐位提取数字，再作为字符串一次显示*/
+	Format_Dec(String, Number1, Length);
+	OLED_ShowString(X, Y, String, FontSize);
 }
 
 /**
@@ -664,7 +845,7 @@ void OLED_ShowSignedNum(int16_t X, int16_t Y, int32_t Number, uint8_t Length, ui
   * 参    数：X 指定数字左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
   * 参    数：Y 指定数字左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
   * 参    数：Number 指定要显示的数字，范围：0x00000000~0xFFFFFFFF
-  * 参    数：Length 指定数字的长度，范围：0~8
+  * 参    数：Length 指定数字的长度，范围：0~255，超过8位时高位显示0
   * 参    数：FontSize 指定字体大小
   *           范围：OLED_8X16		宽8像素，高16像素
   *                 OLED_6X8		宽6像素，高8像素
@@ -673,25 +854,19 @@ void OLED_ShowSignedNum(int16_t X, int16_t Y, int32_t Number, uint8_t Length, ui
   */
 void OLED_ShowHexNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize)
 {
-	uint8_t i, SingleNumber;
-	for (i = 0; i < Length; i++)		//遍历数字的每一位
+	char String[9];
+	
+	/*超出缓冲区的高位全部为0，先逐个显示前导0*/
+	while (Length > 8)
 	{
-		/*以十六进制提取数字的每一位*/
-		SingleNumber = Number / OLED_Pow(16, Length - i - 1) % 16;
-		
-		if (SingleNumber < 10)			//单个数字小于10
-		{
-			/*调用OLED_ShowChar函数，显示此数字*/
-			/*+ '0' 可将数字转换为字符格式*/
-			OLED_ShowChar(X + i * FontSize, Y, SingleNumber + '0', FontSize);
-		}
-		else							//单个数字大于10
-		{
-			/*调用OLED_ShowChar函数，显示此数字*/
-			/*+ 'A' 可将数字转换为从A开始的十六进制字符*/
-			OLED_ShowChar(X + i * FontSize, Y, SingleNumber - 10 + 'A', FontSize);
-		}
+		OLED_ShowChar(X, Y, '0', FontSize);
+		X += FontSize;
+		Length --;
 	}
+	
+	/*以十六进制逐位提取数字，每位取4个Bit*/
+	Format_Hex(String, Number, Length);
+	OLED_ShowString(X, Y, String, FontSize);
 }
 
 /**
@@ -699,7 +874,7 @@ void OLED_ShowHexNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint
   * 参    数：X 指定数字左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
   * 参    数：Y 指定数字左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
   * 参    数：Number 指定要显示的数字，范围：0x00000000~0xFFFFFFFF
-  * 参    数：Length 指定数字的长度，范围：0~16
+  * 参    数：Length 指定数字的长度，范围：0~255，超过32位时高位显示0
   * 参    数：FontSize 指定字体大小
   *           范围：OLED_8X16		宽8像素，高16像素
   *                 OLED_6X8		宽6像素，高8像素
@@ -708,14 +883,19 @@ void OLED_ShowHexNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint
   */
 void OLED_ShowBinNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize)
 {
-	uint8_t i;
-	for (i = 0; i < Length; i++)		//遍历数字的每一位	
+	char String[33];
+	
+	/*超出缓冲区的高位全部为0，先逐个显示前导0*/
+	while (Length > 32)
 	{
-		/*调用OLED_ShowChar函数，依次显示每个数字*/
-		/*Number / OLED_Pow(2, Length - i - 1) % 2 可以二进制提取数字的每一位*/
-		/*+ '0' 可将数字转换为字符格式*/
-		OLED_ShowChar(X + i * FontSize, Y, Number / OLED_Pow(2, Length - i - 1) % 2 + '0', FontSize);
+		OLED_ShowChar(X, Y, '0', FontSize);
+		X += FontSize;
+		Length --;
 	}
+	
+	/*以二进制逐位提取数字，每位取1个Bit*/
+	Format_Bin(String, Number, Length);
+	OLED_ShowString(X, Y, String, FontSize);
 }
 
 /**
@@ -762,50 +942,108 @@ void OLED_ShowFloatNum(int16_t X, int16_t Y, double Number, uint8_t IntLength, u
 	OLED_ShowNum(X + (IntLength + 2) * FontSize, Y, FraNum, FraLength, FontSize);
 }
 
+/**
+  * 函    数：OLED显示定点数字（Q16.16，小数）
+  * 参    数：X 指定数字左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：Y 指定数字左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
+  * 参    数：Number 指定要显示的Q16.16定点数，即实际值乘以65536，范围：-32768.0~32767.99998
+  *           浮点数可先用Format_FloatToQ16转换，全程不使用软件浮点运算
+  * 参    数：IntLength 指定数字的整数位长度，范围：0~10
+  * 参    数：FraLength 指定数字的小数位长度，范围：0~4，小数进行四舍五入显示
+  * 参    数：FontSize 指定字体大小
+  *           范围：OLED_8X16		宽8像素，高16像素
+  *                 OLED_6X8		宽6像素，高8像素
+  * 返 回 值：无
+  * 说    明：显示格式和四舍五入方式与OLED_ShowFloatNum一致
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void OLED_ShowFixedNum(int16_t X, int16_t Y, int32_t Number, uint8_t IntLength, uint8_t FraLength, uint8_t FontSize)
+{
+	char String[22];
+	
+	if (IntLength > 10) {IntLength = 10;}
+	
+	Format_Q16(String, Number, IntLength, FraLength);
+	OLED_ShowString(X, Y, String, FontSize);
+}
+
+/**
+  * 函    数：OLED显示缩放整数（十进制，小数）
+  * 参    数：X 指定数字左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
+  * 参    数：Y 指定数字左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
+  * 参    数：Number 指定要显示的缩放整数，实际值为Number / 10^Scale，范围：-2147483648~2147483647
+  * 参    数：Scale 缩放的小数位数，范围：0~9，例如传感器以0.01为单位时给2
+  * 参    数：IntLength 指定数字的整数位长度，范围：0~10
+  * 参    数：FraLength 指定数字的小数位长度，范围：0~9，少于Scale时四舍五入显示
+  * 参    数：FontSize 指定字体大小
+  *           范围：OLED_8X16		宽8像素，高16像素
+  *                 OLED_6X8		宽6像素，高8像素
+  * 返 回 值：无
+  * 说    明：显示格式与OLED_ShowFloatNum一致
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void OLED_ShowScaledNum(int16_t X, int16_t Y, int32_t Number, uint8_t Scale, uint8_t IntLength, uint8_t FraLength, uint8_t FontSize)
+{
+	char String[22];
+	
+	if (IntLength > 10) {IntLength = 10;}
+	
+	Format_Scaled(String, Number, Scale, IntLength, FraLength);
+	OLED_ShowString(X, Y, String, FontSize);
+}
+
 /**
   * 函    数：OLED显示汉字串
   * 参    数：X 指定汉字串左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
   * 参    数：Y 指定汉字串左上角的纵坐标，范围：-32768~32767，屏幕区域：0~63
-  * 参    数：Chinese 指定要显示的汉字串，范围：必须全部为汉字或者全角字符，不要加入任何半角字符
+  * 参    数：Chinese 指定要显示的汉字串，范围：汉字、全角字符与ASCII码可见字符可以混合
   *           显示的汉字需要在OLED_Data.c里的OLED_CF16x16数组定义
   *           未找到指定汉字时，会显示默认图形（一个方框，内部一个问号）
+  *           ASCII字符以OLED_8X16字体显示，宽8像素，汉字宽16像素
   * 返 回 值：无
   * 说    明：调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
   */
 void OLED_ShowChinese(int16_t X, int16_t Y, char *Chinese)
 {
-	uint8_t pChinese = 0;
-	uint8_t pIndex;
-	uint8_t i;
-	char SingleChinese[OLED_CHN_CHAR_WIDTH + 1] = {0};
+	uint32_t Code;
 	
-	for (i = 0; Chinese[i] != '\0'; i ++)		//遍历汉字串
+	while (*Chinese != '\0')					//遍历汉字串
 	{
-		SingleChinese[pChinese] = Chinese[i];	//提取汉字串数据到单个汉字数组
-		pChinese ++;							//计次自增
+		/*解码一个字符，并移动到下一个字符*/
+		Chinese += OLED_DecodeChar(Chinese, &Code);
 		
-		/*当提取次数到达OLED_CHN_CHAR_WIDTH时，即代表提取到了一个完整的汉字*/
-		if (pChinese >= OLED_CHN_CHAR_WIDTH)
+		if (Code < 0x80)						//ASCII字符
 		{
-			pChinese = 0;		//计次归零
-			
-			/*遍历整个汉字字模库，寻找匹配的汉字*/
-			/*如果找到最后一个汉字（定义为空字符串），则表示汉字未在字模库定义，停止寻找*/
-			for (pIndex = 0; strcmp(OLED_CF16x16[pIndex].Index, "") != 0; pIndex ++)
+			if (Code >= ' ' && Code <= '~')		//只显示可见字符
 			{
-				/*找到匹配的汉字*/
-				if (strcmp(OLED_CF16x16[pIndex].Index, SingleChinese) == 0)
-				{
-					break;		//跳出循环，此时pIndex的值为指定汉字的索引
-				}
+				OLED_ShowChar(X, Y, Code, OLED_8X16);
+				X += 8;
 			}
-			
+		}
+		else									//汉字或全角字符
+		{
 			/*将汉字字模库OLED_CF16x16的指定数据以16*16的图像格式显示*/
-			OLED_ShowImage(X + ((i + 1) / OLED_CHN_CHAR_WIDTH - 1) * 16, Y, 16, 16, OLED_CF16x16[pIndex].Data);
+			OLED_ShowImage(X, Y, 16, 16, OLED_CF16x16[OLED_FindChinese(Code)].Data);
+			X += 16;
 		}
 	}
 }
 
+/**
+  * 函    数：OLED获取字符串开头汉字的字模
+  * 参    数：String 指向汉字的第一个字节
+  * 参    数：Length 返回该汉字占用的字节数
+  * 返 回 值：16*16的字模数据，格式与OLED_ShowImage一致，未找到时返回默认图形
+  * 说    明：供文字排版模块使用，见Text_Layout
+  */
+const uint8_t *OLED_GetChinese(const char *String, uint8_t *Length)
+{
+	uint32_t Code;
+	
+	*Length = OLED_DecodeChar(String, &Code);
+	return OLED_CF16x16[OLED_FindChinese(Code)].Data;
+}
+
 /**
   * 函    数：OLED显示图像
   * 参    数：X 指定图像左上角的横坐标，范围：-32768~32767，屏幕区域：0~127
@@ -866,18 +1104,20 @@ void OLED_ShowImage(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const u
   *           范围：OLED_8X16		宽8像素，高16像素
   *                 OLED_6X8		宽6像素，高8像素
   * 参    数：format 指定要显示的格式化字符串，范围：ASCII码可见字符组成的字符串
+  *           支持%d %i %u %x %X %c %s %%与定点小数%f，详见Format_Stream
   * 参    数：... 格式化字符串参数列表
   * 返 回 值：无
-  * 说    明：调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  * 说    明：格式化的结果逐字符直接显示，不经过中间字符数组，输出长度不受限制
+  *           %f的参数为Q16.16定点数，不是浮点数，可由Format_FloatToQ16转换得到
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
   */
 void OLED_Printf(int16_t X, int16_t Y, uint8_t FontSize, char *format, ...)
 {
-	char String[256];						//定义字符数组
+	OLED_Cursor_t Cursor = {X, Y, FontSize};	//定义光标，从指定位置开始显示
 	va_list arg;							//定义可变参数列表数据类型的变量arg
 	va_start(arg, format);					//从format开始，接收参数列表到arg变量
-	vsprintf(String, format, arg);			//使用vsprintf打印格式化字符串和参数列表到字符数组中
+	Format_Stream(OLED_PrintfPut, &Cursor, format, arg);	//边格式化边显示
 	va_end(arg);							//结束变量arg
-	OLED_ShowString(X, Y, String, FontSize);//OLED显示字符数组（字符串）
 }
 
 /**
@@ -22,6 +22,7 @@
 
 /*初始化函数*/
 void OLED_Init(void);
+void OLED_SetContrast(uint8_t Contrast);
 
 /*更新函数*/
 void OLED_Update(void);
@@ -36,12 +37,17 @@ void OLED_ReverseArea(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
 /*显示函数*/
 void OLED_ShowChar(int16_t X, int16_t Y, char Char, uint8_t FontSize);
 void OLED_ShowString(int16_t X, int16_t Y, char *String, uint8_t FontSize);
+void OLED_ShowZoomChar(int16_t X, int16_t Y, char Char, uint8_t FontSize, uint8_t Zoom);
+void OLED_ShowZoomString(int16_t X, int16_t Y, char *String, uint8_t FontSize, uint8_t Zoom);
 void OLED_ShowNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize);
 void OLED_ShowSignedNum(int16_t X, int16_t Y, int32_t Number, uint8_t Length, uint8_t FontSize);
 void OLED_ShowHexNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize);
 void OLED_ShowBinNum(int16_t X, int16_t Y, uint32_t Number, uint8_t Length, uint8_t FontSize);
 void OLED_ShowFloatNum(int16_t X, int16_t Y, double Number, uint8_t IntLength, uint8_t FraLength, uint8_t FontSize);
+void OLED_ShowFixedNum(int16_t X, int16_t Y, int32_t Number, uint8_t IntLength, uint8_t FraLength, uint8_t FontSize);
+void OLED_ShowScaledNum(int16_t X, int16_t Y, int32_t Number, uint8_t Scale, uint8_t IntLength, uint8_t FraLength, uint8_t FontSize);
 void OLED_ShowChinese(int16_t X, int16_t Y, char *Chinese);
+const uint8_t *OLED_GetChinese(const char *String, uint8_t *Length);
 void OLED_ShowImage(int16_t X, int16_t Y, uint8_t Width, uint8_t Height, const uint8_t *Image);
 void OLED_Printf(int16_t X, int16_t Y, uint8_t FontSize, char *format, ...);
 
@@ -328,37 +328,37 @@ const uint8_t OLED_F6x8[][6] =
 
 /*汉字字模数据*********************/
 
-/*相同的汉字只需要定义一次，汉字不分先后顺序*/
+/*相同的汉字只需要定义一次，汉字必须按编码从小到大排列（UTF-8格式即Unicode码点顺序），以便二分查找*/
 /*必须全部为汉字或者全角字符，不要加入任何半角字符*/
 
 /*宽16像素，高16像素*/
 const ChineseCell_t OLED_CF16x16[] = {
 	
-	"，",
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x58,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
 	"。",
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x18,0x24,0x24,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	
+	"世",
+	0x20,0x20,0x20,0xFE,0x20,0x20,0xFF,0x20,0x20,0x20,0xFF,0x20,0x20,0x20,0x20,0x00,
+	0x00,0x00,0x00,0x7F,0x40,0x40,0x47,0x44,0x44,0x44,0x47,0x40,0x40,0x40,0x00,0x00,
+	
 	"你",
 	0x00,0x80,0x60,0xF8,0x07,0x40,0x20,0x18,0x0F,0x08,0xC8,0x08,0x08,0x28,0x18,0x00,
 	0x01,0x00,0x00,0xFF,0x00,0x10,0x0C,0x03,0x40,0x80,0x7F,0x00,0x01,0x06,0x18,0x00,
-
+	
 	"好",
 	0x10,0x10,0xF0,0x1F,0x10,0xF0,0x00,0x80,0x82,0x82,0xE2,0x92,0x8A,0x86,0x80,0x00,
 	0x40,0x22,0x15,0x08,0x16,0x61,0x00,0x00,0x40,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,
 	
-	"世",
-	0x20,0x20,0x20,0xFE,0x20,0x20,0xFF,0x20,0x20,0x20,0xFF,0x20,0x20,0x20,0x20,0x00,
-	0x00,0x00,0x00,0x7F,0x40,0x40,0x47,0x44,0x44,0x44,0x47,0x40,0x40,0x40,0x00,0x00,
-	
 	"界",
 	0x00,0x00,0x00,0xFE,0x92,0x92,0x92,0xFE,0x92,0x92,0x92,0xFE,0x00,0x00,0x00,0x00,
 	0x08,0x08,0x04,0x84,0x62,0x1E,0x01,0x00,0x01,0xFE,0x02,0x04,0x04,0x08,0x08,0x00,
 	
-	/*按照上面的格式，在这个位置加入新的汉字数据*/
+	"，",
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x58,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	
+	/*按照上面的格式，按编码顺序在对应位置加入新的汉字数据*/
 	//...
 	
 	
@@ -369,6 +369,9 @@ const ChineseCell_t OLED_CF16x16[] = {
 
 };
 
+/*汉字数量，不含末尾的默认图形*/
+const uint16_t OLED_CF16x16_Num = sizeof(OLED_CF16x16) / sizeof(OLED_CF16x16[0]) - 1;
+
 /*********************汉字字模数据*/
 
 
@@ -0,0 +1,619 @@
+#include "QRCode.h"
+#include <string.h>
+
+/*全局变量*********************/
+
+/*各版本的码字总数*/
+static const uint16_t QRCode_TotalCodewords[QRCODE_MAX_VERSION] = {
+	26, 44, 70, 100, 134, 172, 196, 242, 292, 346};
+
+/*各版本每块的纠错码字数，第0行为L级，第1行为M级*/
+static const uint8_t QRCode_EccPerBlock[2][QRCODE_MAX_VERSION] = {
+	{7, 10, 15, 20, 26, 18, 20, 24, 30, 18},
+	{10, 16, 26, 18, 24, 16, 18, 22, 22, 26}};
+
+/*各版本的纠错块数，第0行为L级，第1行为M级*/
+static const uint8_t QRCode_Blocks[2][QRCODE_MAX_VERSION] = {
+	{1, 1, 1, 1, 1, 2, 2, 2, 2, 4},
+	{1, 1, 1, 2, 2, 4, 4, 4, 5, 5}};
+
+/*字母数字模式的字符集，字符的序号即编码值*/
+static const char QRCode_AlnumChars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+
+/**
+  * 静态工作区，共约1.3KB，不使用堆
+  * 模块矩阵按页存储，每页QRCode_Size个字节，每个字节纵向8个模块，B0在上，1为深色
+  * 存储格式与EPD_ShowImage的图像一致，可直接放大写入显存
+  */
+static uint8_t QRCode_Matrix[8 * QRCODE_MAX_SIZE];		//模块矩阵
+static uint8_t QRCode_Function[8 * QRCODE_MAX_SIZE];	//功能图形标记，1表示该模块不放数据
+static uint8_t QRCode_Data[QRCODE_MAX_CODEWORDS];		//数据码字，各块的纠错码字接在后面
+static uint8_t QRCode_Divisor[30];						//RS生成多项式的系数
+static uint8_t QRCode_Size;								//当前符号的边长（模块数）
+static uint16_t QRCode_BitCount;						//已写入数据区的位数
+
+/*********************全局变量*/
+
+
+/*工具函数*********************/
+
+/*工具函数仅供内部部分函数使用*/
+
+/**
+  * 函    数：读取模块矩阵中一个模块
+  * 参    数：Map 模块矩阵或功能图形标记
+  * 参    数：X 模块的列号
+  * 参    数：Y 模块的行号
+  * 返 回 值：模块的值，0或1
+  */
+static uint8_t QRCode_Get(const uint8_t *Map, uint8_t X, uint8_t Y)
+{
+	return (Map[Y / 8 * QRCode_Size + X] >> (Y % 8)) & 0x01;
+}
+
+/**
+  * 函    数：写入模块矩阵中一个模块
+  * 参    数：Map 模块矩阵或功能图形标记
+  * 参    数：X 模块的列号
+  * 参    数：Y 模块的行号
+  * 参    数：Value 模块的值，0或1
+  * 返 回 值：无
+  */
+static void QRCode_Set(uint8_t *Map, uint8_t X, uint8_t Y, uint8_t Value)
+{
+	if (Value)
+	{
+		Map[Y / 8 * QRCode_Size + X] |= 0x01 << (Y % 8);
+	}
+	else
+	{
+		Map[Y / 8 * QRCode_Size + X] &= ~(0x01 << (Y % 8));
+	}
+}
+
+/**
+  * 函    数：写入一个功能图形模块
+  * 参    数：X 模块的列号，超出符号范围时忽略
+  * 参    数：Y 模块的行号，超出符号范围时忽略
+  * 参    数：Value 模块的值，0或1
+  * 返 回 值：无
+  */
+static void QRCode_SetFunction(int16_t X, int16_t Y, uint8_t Value)
+{
+	if (X >= 0 && X < QRCode_Size && Y >= 0 && Y < QRCode_Size)
+	{
+		QRCode_Set(QRCode_Matrix, X, Y, Value);
+		QRCode_Set(QRCode_Function, X, Y, 1);
+	}
+}
+
+/**
+  * 函    数：向数据区追加若干位
+  * 参    数：Value 要追加的数据，高位先写
+  * 参    数：Count 位数，范围：0~16
+  * 返 回 值：无
+  */
+static void QRCode_PutBits(uint16_t Value, uint8_t Count)
+{
+	while (Count --)
+	{
+		if ((Value >> Count) & 0x01)
+		{
+			QRCode_Data[QRCode_BitCount / 8] |= 0x80 >> (QRCode_BitCount % 8);
+		}
+		QRCode_BitCount ++;
+	}
+}
+
+/**
+  * 函    数：获取字符在字母数字模式下的编码值
+  * 参    数：Char 指定字符
+  * 返 回 值：编码值，范围：0~44，不在字符集中时返回0xFF
+  */
+static uint8_t QRCode_AlnumValue(char Char)
+{
+	const char *Found;
+	
+	if (Char == '\0') {return 0xFF;}
+	Found = strchr(QRCode_AlnumChars, Char);
+	return Found ? Found - QRCode_AlnumChars : 0xFF;
+}
+
+/**
+  * 函    数：GF(256)乘法，本原多项式为0x11D
+  * 参    数：A 乘数
+  * 参    数：B 乘数
+  * 返 回 值：乘积
+  * 说    明：逐位移位异或，不使用对数表，节省512字节的Flash
+  */
+static uint8_t QRCode_Multiply(uint8_t A, uint8_t B)
+{
+	uint16_t Result = 0;
+	int8_t i;
+	
+	for (i = 7; i >= 0; i --)
+	{
+		Result = (Result << 1) ^ ((Result >> 7) * 0x11D);
+		Result ^= ((B >> i) & 0x01) * A;
+	}
+	return Result;
+}
+
+/**
+  * 函    数：计算RS生成多项式
+  * 参    数：Degree 纠错码字数，范围：1~30
+  * 返 回 值：无，系数保存在QRCode_Divisor中，最高次项的系数1省略
+  */
+static void QRCode_MakeDivisor(uint8_t Degree)
+{
+	uint8_t Root = 1, i, j;
+	
+	memset(QRCode_Divisor, 0, Degree);
+	QRCode_Divisor[Degree - 1] = 1;
+	
+	/*依次乘以(x - 2^i)*/
+	for (i = 0; i < Degree; i ++)
+	{
+		for (j = 0; j < Degree; j ++)
+		{
+			QRCode_Divisor[j] = QRCode_Multiply(QRCode_Divisor[j], Root);
+			if (j + 1 < Degree) {QRCode_Divisor[j] ^= QRCode_Divisor[j + 1];}
+		}
+		Root = QRCode_Multiply(Root, 0x02);
+	}
+}
+
+/**
+  * 函    数：计算一块数据的RS纠错码字
+  * 参    数：Data 块数据
+  * 参    数：Length 块数据长度
+  * 参    数：Ecc 纠错码字输出位置
+  * 参    数：Degree 纠错码字数
+  * 返 回 值：无
+  */
+static void QRCode_ComputeEcc(const uint8_t *Data, uint8_t Length, uint8_t *Ecc, uint8_t Degree)
+{
+	uint8_t Factor, i, j;
+	
+	memset(Ecc, 0, Degree);
+	for (i = 0; i < Length; i ++)
+	{
+		/*多项式除法，余数即纠错码字*/
+		Factor = Data[i] ^ Ecc[0];
+		memmove(Ecc, Ecc + 1, Degree - 1);
+		Ecc[Degree - 1] = 0;
+		for (j = 0; j < Degree; j ++)
+		{
+			Ecc[j] ^= QRCode_Multiply(QRCode_Divisor[j], Factor);
+		}
+	}
+}
+
+/**
+  * 函    数：按交织顺序获取第Index个码字
+  * 参    数：Index 码字在最终序列中的序号
+  * 参    数：DataLength 数据码字总数
+  * 参    数：Blocks 块数
+  * 参    数：Degree 每块纠错码字数
+  * 返 回 值：码字
+  * 说    明：先依次取各块的第i个数据码字，再依次取各块的第i个纠错码字
+  *           前面的短块比后面的长块少一个数据码字，不需要额外的交织缓冲区
+  */
+static uint8_t QRCode_GetCodeword(uint16_t Index, uint16_t DataLength, uint8_t Blocks, uint8_t Degree)
+{
+	uint8_t ShortLength = DataLength / Blocks;
+	uint8_t ShortBlocks = Blocks - DataLength % Blocks;
+	uint8_t Block, i;
+	
+	if (Index >= DataLength)			//纠错码字
+	{
+		Index -= DataLength;
+		return QRCode_Data[DataLength + Index % Blocks * Degree + Index / Blocks];
+	}
+	
+	if (Index < ShortLength * Blocks)	//所有块都有的部分
+	{
+		i = Index / Blocks;
+		Block = Index % Blocks;
+	}
+	else								//只有长块才有的最后一个码字
+	{
+		i = ShortLength;
+		Block = ShortBlocks + Index - ShortLength * Blocks;
+	}
+	return QRCode_Data[Block * ShortLength + (Block > ShortBlocks ? Block - ShortBlocks : 0) + i];
+}
+
+/**
+  * 函    数：画格式信息
+  * 参    数：Ecc 纠错等级
+  * 参    数：Mask 掩模编号
+  * 返 回 值：无
+  */
+static void QRCode_DrawFormat(uint8_t Ecc, uint8_t Mask)
+{
+	uint16_t Data, Remainder, Bits;
+	uint8_t i;
+	
+	/*格式信息中L级为01，M级为00，加BCH(15,5)校验后异或固定掩模*/
+	Data = ((Ecc == QRCODE_ECC_L ? 1 : 0) << 3) | Mask;
+	Remainder = Data;
+	for (i = 0; i < 10; i ++)
+	{
+		Remainder = (Remainder << 1) ^ ((Remainder >> 9) * 0x537);
+	}
+	Bits = ((Data << 10) | Remainder) ^ 0x5412;
+	
+	/*左上角一份*/
+	for (i = 0; i <= 5; i ++) {QRCode_SetFunction(8, i, (Bits >> i) & 0x01);}
+	QRCode_SetFunction(8, 7, (Bits >> 6) & 0x01);
+	QRCode_SetFunction(8, 8, (Bits >> 7) & 0x01);
+	QRCode_SetFunction(7, 8, (Bits >> 8) & 0x01);
+	for (i = 9; i < 15; i ++) {QRCode_SetFunction(14 - i, 8, (Bits >> i) & 0x01);}
+	
+	/*右上角与左下角另一份*/
+	for (i = 0; i < 8; i ++) {QRCode_SetFunction(QRCode_Size - 1 - i, 8, (Bits >> i) & 0x01);}
+	for (i = 8; i < 15; i ++) {QRCode_SetFunction(8, QRCode_Size - 15 + i, (Bits >> i) & 0x01);}
+	QRCode_SetFunction(8, QRCode_Size - 8, 1);		//固定的深色模块
+}
+
+/**
+  * 函    数：画所有功能图形
+  * 参    数：Version 版本
+  * 返 回 值：无
+  * 说    明：包括定位图形、分隔符、定时图形、校正图形、格式信息和版本信息的位置
+  */
+static void QRCode_DrawFunctions(uint8_t Version)
+{
+	uint8_t Align[3], AlignNum, i, j;
+	int8_t dx, dy, Dist;
+	uint32_t Remainder, Bits;
+	
+	/*定时图形*/
+	for (i = 0; i < QRCode_Size; i ++)
+	{
+		QRCode_SetFunction(6, i, i % 2 == 0);
+		QRCode_SetFunction(i, 6, i % 2 == 0);
+	}
+	
+	/*三个定位图形及分隔符*/
+	for (dy = -4; dy <= 4; dy ++)
+	{
+		for (dx = -4; dx <= 4; dx ++)
+		{
+			Dist = dx < 0 ? -dx : dx;
+			if (dy > Dist) {Dist = dy;}
+			if (-dy > Dist) {Dist = -dy;}
+			QRCode_SetFunction(3 + dx, 3 + dy, Dist != 2 && Dist != 4);
+			QRCode_SetFunction(QRCode_Size - 4 + dx, 3 + dy, Dist != 2 && Dist != 4);
+			QRCode_SetFunction(3 + dx, QRCode_Size - 4 + dy, Dist != 2 && Dist != 4);
+		}
+	}
+	
+	/*校正图形，中心在6、末行-7及两者中点，与定位图形重叠的三个不画*/
+	AlignNum = 0;
+	if (Version >= 2)
+	{
+		Align[AlignNum ++] = 6;
+		if (Version >= 7) {Align[AlignNum ++] = (6 + QRCode_Size - 7) / 2;}
+		Align[AlignNum ++] = QRCode_Size - 7;
+	}
+	for (i = 0; i < AlignNum; i ++)
+	{
+		for (j = 0; j < AlignNum; j ++)
+		{
+			if ((i == 0 && j == 0) || (i == 0 && j == AlignNum - 1) || (i == AlignNum - 1 && j == 0)) {continue;}
+			for (dy = -2; dy <= 2; dy ++)
+			{
+				for (dx = -2; dx <= 2; dx ++)
+				{
+					Dist = dx < 0 ? -dx : dx;
+					if (dy > Dist) {Dist = dy;}
+					if (-dy > Dist) {Dist = -dy;}
+					QRCode_SetFunction(Align[i] + dx, Align[j] + dy, Dist != 1);
+				}
+			}
+		}
+	}
+	
+	/*先占住格式信息的位置，选定掩模后再重画*/
+	QRCode_DrawFormat(QRCODE_ECC_L, 0);
+	
+	/*版本7以上的版本信息，BCH(18,6)*/
+	if (Version >= 7)
+	{
+		Remainder = Version;
+		for (i = 0; i < 12; i ++)
+		{
+			Remainder = (Remainder << 1) ^ ((Remainder >> 11) * 0x1F25);
+		}
+		Bits = ((uint32_t)Version << 12) | Remainder;
+		for (i = 0; i < 18; i ++)
+		{
+			QRCode_SetFunction(QRCode_Size - 11 + i % 3, i / 3, (Bits >> i) & 0x01);
+			QRCode_SetFunction(i / 3, QRCode_Size - 11 + i % 3, (Bits >> i) & 0x01);
+		}
+	}
+}
+
+/**
+  * 函    数：按之字形顺序放置全部码字
+  * 参    数：Total 码字总数
+  * 参    数：DataLength 数据码字总数
+  * 参    数：Blocks 块数
+  * 参    数：Degree 每块纠错码字数
+  * 返 回 值：无
+  * 说    明：从右下角开始，每两列为一组上下往返，跳过功能图形和第6列的定时图形
+  */
+static void QRCode_PlaceCodewords(uint16_t Total, uint16_t DataLength, uint8_t Blocks, uint8_t Degree)
+{
+	uint16_t i = 0;
+	int16_t Right, Vert, X, Y;
+	uint8_t Codeword = 0, j;
+	
+	for (Right = QRCode_Size - 1; Right >= 1; Right -= 2)
+	{
+		if (Right == 6) {Right = 5;}
+		for (Vert = 0; Vert < QRCode_Size; Vert ++)
+		{
+			for (j = 0; j < 2; j ++)
+			{
+				X = Right - j;
+				Y = ((Right + 1) & 2) == 0 ? QRCode_Size - 1 - Vert : Vert;		//向上或向下
+				if (!QRCode_Get(QRCode_Function, X, Y) && i < Total * 8)
+				{
+					if (i % 8 == 0) {Codeword = QRCode_GetCodeword(i / 8, DataLength, Blocks, Degree);}
+					QRCode_Set(QRCode_Matrix, X, Y, (Codeword >> (7 - i % 8)) & 0x01);
+					i ++;
+				}
+				/*剩余位保持为0*/
+			}
+		}
+	}
+}
+
+/**
+  * 函    数：对数据区域应用掩模
+  * 参    数：Mask 掩模编号，范围：0~7
+  * 返 回 值：无
+  * 说    明：掩模为异或操作，对同一掩模调用两次即可撤销
+  */
+static void QRCode_ApplyMask(uint8_t Mask)
+{
+	uint8_t X, Y, Invert;
+	
+	for (Y = 0; Y < QRCode_Size; Y ++)
+	{
+		for (X = 0; X < QRCode_Size; X ++)
+		{
+			switch (Mask)
+			{
+				case 0: Invert = (X + Y) % 2 == 0; break;
+				case 1: Invert = Y % 2 == 0; break;
+				case 2: Invert = X % 3 == 0; break;
+				case 3: Invert = (X + Y) % 3 == 0; break;
+				case 4: Invert = (X / 3 + Y / 2) % 2 == 0; break;
+				case 5: Invert = X * Y % 2 + X * Y % 3 == 0; break;
+				case 6: Invert = (X * Y % 2 + X * Y % 3) % 2 == 0; break;
+				default: Invert = ((X + Y) % 2 + X * Y % 3) % 2 == 0; break;
+			}
+			if (Invert && !QRCode_Get(QRCode_Function, X, Y))
+			{
+				QRCode_Matrix[Y / 8 * QRCode_Size + X] ^= 0x01 << (Y % 8);
+			}
+		}
+	}
+}
+
+/**
+  * 函    数：计算当前矩阵的罚分
+  * 参    数：无
+  * 返 回 值：罚分，越小越好
+  * 说    明：规则1：行列中连续5个以上同色模块；规则2：2*2同色块
+  *           规则3：行列中类似定位图形的1:1:3:1:1序列；规则4：深色模块比例偏离50%
+  */
+static uint32_t QRCode_Penalty(void)
+{
+	uint32_t Penalty = 0;
+	uint16_t Dark = 0, Total, Window;
+	uint8_t Line, i, Vertical, Color, Last, Run;
+	
+	/*规则1与规则3，逐行再逐列扫描*/
+	for (Vertical = 0; Vertical < 2; Vertical ++)
+	{
+		for (Line = 0; Line < QRCode_Size; Line ++)
+		{
+			Run = 0;
+			Last = 0xFF;
+			Window = 0;
+			for (i = 0; i < QRCode_Size; i ++)
+			{
+				Color = Vertical ? QRCode_Get(QRCode_Matrix, Line, i) : QRCode_Get(QRCode_Matrix, i, Line);
+				if (Color == Last)
+				{
+					Run ++;
+					if (Run == 5) {Penalty += 3;}
+					else if (Run > 5) {Penalty ++;}
+				}
+				else
+				{
+					Run = 1;
+					Last = Color;
+				}
+				
+				/*最近11个模块为10111010000或00001011101*/
+				Window = ((Window << 1) | Color) & 0x7FF;
+				if (i >= 10 && (Window == 0x5D0 || Window == 0x05D)) {Penalty += 40;}
+				
+				if (!Vertical) {Dark += Color;}
+			}
+		}
+	}
+	
+	/*规则2*/
+	for (Line = 0; Line < QRCode_Size - 1; Line ++)
+	{
+		for (i = 0; i < QRCode_Size - 1; i ++)
+		{
+			Color = QRCode_Get(QRCode_Matrix, i, Line);
+			if (Color == QRCode_Get(QRCode_Matrix, i + 1, Line) && Color == QRCode_Get(QRCode_Matrix, i, Line + 1)
+				&& Color == QRCode_Get(QRCode_Matrix, i + 1, Line + 1))
+			{
+				Penalty += 3;
+			}
+		}
+	}
+	
+	/*规则4，每偏离5%罚10分*/
+	Total = QRCode_Size * QRCode_Size;
+	Penalty += ((Dark * 20 > Total * 10 ? Dark * 20 - Total * 10 : Total * 10 - Dark * 20) + Total - 1) / Total * 10 - 10;
+	
+	return Penalty;
+}
+
+/*********************工具函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：生成QR码
+  * 参    数：Text 指定要编码的字符串，全部为数字、大写字母和" $%*+-./:"时使用字母数字模式，否则使用字节模式
+  * 参    数：Ecc 指定纠错等级，范围：QRCODE_ECC_L或QRCODE_ECC_M
+  * 返 回 值：版本，范围：1~10，字符串太长时返回0
+  * 说    明：自动选择能容纳字符串的最小版本，8种掩模中选择罚分最小的一种
+  *           结果保存在静态工作区中，由QRCode_Draw显示，下次生成时被覆盖
+  *           版本10、M级最多可编码213字节或311个字母数字字符
+  */
+uint8_t QRCode_Encode(const char *Text, uint8_t Ecc)
+{
+	uint16_t Length = strlen(Text), Bits = 0, Capacity = 0, DataLength = 0, i;
+	uint8_t Alnum = 1, Version, CountBits = 0, Blocks = 0, Degree = 0, ShortLength, ShortBlocks, Offset;
+	uint8_t Mask, BestMask = 0;
+	uint32_t Penalty, BestPenalty = 0xFFFFFFFF;
+	
+	if (Ecc > QRCODE_ECC_M) {Ecc = QRCODE_ECC_M;}
+	for (i = 0; i < Length; i ++)
+	{
+		if (QRCode_AlnumValue(Text[i]) == 0xFF) {Alnum = 0;}
+	}
+	
+	/*选择能容纳字符串的最小版本*/
+	for (Version = 1; Version <= QRCODE_MAX_VERSION; Version ++)
+	{
+		Blocks = QRCode_Blocks[Ecc][Version - 1];
+		Degree = QRCode_EccPerBlock[Ecc][Version - 1];
+		DataLength = QRCode_TotalCodewords[Version - 1] - Blocks * Degree;
+		Capacity = DataLength * 8;
+		CountBits = Alnum ? (Version < 10 ? 9 : 11) : (Version < 10 ? 8 : 16);
+		Bits = 4 + CountBits + (Alnum ? Length / 2 * 11 + Length % 2 * 6 : Length * 8);
+		if (Bits <= Capacity && Length < (1UL << CountBits)) {break;}
+	}
+	if (Version > QRCODE_MAX_VERSION) {return 0;}
+	
+	/*数据码字：模式指示、字符计数、数据、终止符与填充*/
+	memset(QRCode_Data, 0, sizeof(QRCode_Data));
+	QRCode_BitCount = 0;
+	QRCode_PutBits(Alnum ? 0x2 : 0x4, 4);
+	QRCode_PutBits(Length, CountBits);
+	for (i = 0; i < Length; i ++)
+	{
+		if (!Alnum)
+		{
+			QRCode_PutBits((uint8_t)Text[i], 8);
+		}
+		else if (i + 1 < Length)
+		{
+			QRCode_PutBits(QRCode_AlnumValue(Text[i]) * 45 + QRCode_AlnumValue(Text[i + 1]), 11);
+			i ++;
+		}
+		else
+		{
+			QRCode_PutBits(QRCode_AlnumValue(Text[i]), 6);
+		}
+	}
+	QRCode_BitCount += (Capacity - QRCode_BitCount < 4) ? Capacity - QRCode_BitCount : 4;	//终止符
+	QRCode_BitCount = (QRCode_BitCount + 7) / 8 * 8;										//补齐到字节
+	for (i = QRCode_BitCount / 8; i < DataLength; i ++)
+	{
+		QRCode_Data[i] = ((i - QRCode_BitCount / 8) % 2) ? 0x11 : 0xEC;						//填充码字
+	}
+	
+	/*各块的纠错码字依次放在数据码字之后*/
+	QRCode_MakeDivisor(Degree);
+	ShortLength = DataLength / Blocks;
+	ShortBlocks = Blocks - DataLength % Blocks;
+	Offset = 0;
+	for (i = 0; i < Blocks; i ++)
+	{
+		QRCode_ComputeEcc(QRCode_Data + i * ShortLength + Offset, ShortLength + (i >= ShortBlocks),
+						  QRCode_Data + DataLength + i * Degree, Degree);
+		if (i >= ShortBlocks) {Offset ++;}
+	}
+	
+	/*功能图形与数据*/
+	QRCode_Size = Version * 4 + 17;
+	memset(QRCode_Matrix, 0, sizeof(QRCode_Matrix));
+	memset(QRCode_Function, 0, sizeof(QRCode_Function));
+	QRCode_DrawFunctions(Version);
+	QRCode_PlaceCodewords(QRCode_TotalCodewords[Version - 1], DataLength, Blocks, Degree);
+	
+	/*逐个尝试掩模，试完后撤销，最后应用罚分最小的*/
+	for (Mask = 0; Mask < 8; Mask ++)
+	{
+		QRCode_ApplyMask(Mask);
+		QRCode_DrawFormat(Ecc, Mask);
+		Penalty = QRCode_Penalty();
+		if (Penalty < BestPenalty)
+		{
+			BestPenalty = Penalty;
+			BestMask = Mask;
+		}
+		QRCode_ApplyMask(Mask);
+	}
+	QRCode_ApplyMask(BestMask);
+	QRCode_DrawFormat(Ecc, BestMask);
+	
+	return Version;
+}
+
+/**
+  * 函    数：获取当前QR码的边长
+  * 参    数：无
+  * 返 回 值：边长（模块数），范围：21~57，还未生成时为0
+  */
+uint8_t QRCode_GetSize(void)
+{
+	return QRCode_Size;
+}
+
+/**
+  * 函    数：获取当前QR码的一个模块
+  * 参    数：X 模块的列号，范围：0~边长-1
+  * 参    数：Y 模块的行号，范围：0~边长-1
+  * 返 回 值：1：深色，0：浅色，超出范围时返回0
+  */
+uint8_t QRCode_GetModule(uint8_t X, uint8_t Y)
+{
+	if (X >= QRCode_Size || Y >= QRCode_Size) {return 0;}
+	return QRCode_Get(QRCode_Matrix, X, Y);
+}
+
+/**
+  * 函    数：在画布上显示当前QR码
+  * 参    数：Canvas 指定画布，范围：&EPD_Canvas或&OLED_Canvas
+  * 参    数：X 指定QR码左上角的横坐标，范围：-32768~32767
+  * 参    数：Y 指定QR码左上角的纵坐标，范围：-32768~32767
+  * 参    数：Scale 每个模块的边长（像素），范围：1~4
+  * 返 回 值：无
+  * 说    明：深色模块对应的像素置1，符号区域被整体覆盖
+  *           识读需要四周至少4个模块宽的空白区，由调用者保证
+  *           模块矩阵与显存同为按页存储，借助Canvas_DrawZoomImage整列查表放大写入
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+void QRCode_Draw(const Canvas_t *Canvas, int16_t X, int16_t Y, uint8_t Scale)
+{
+	Canvas_DrawZoomImage(Canvas, X, Y, QRCode_Size, QRCode_Size, QRCode_Matrix, Scale);
+}
+
+/*********************功能函数*/
@@ -0,0 +1,30 @@
+#ifndef __QRCODE_H
+#define __QRCODE_H
+
+#include <stdint.h>
+#include "Canvas.h"
+
+/*参数宏定义*********************/
+
+/*Ecc参数取值*/
+#define QRCODE_ECC_L			0		//约可纠正7%的错误
+#define QRCODE_ECC_M			1		//约可纠正15%的错误
+
+/*支持的最大版本，版本10为57*57模块，决定静态工作区的大小*/
+#define QRCODE_MAX_VERSION		10
+#define QRCODE_MAX_SIZE			(QRCODE_MAX_VERSION * 4 + 17)
+#define QRCODE_MAX_CODEWORDS	346
+
+/*********************参数宏定义*/
+
+
+/*函数声明*********************/
+
+uint8_t QRCode_Encode(const char *Text, uint8_t Ecc);
+uint8_t QRCode_GetSize(void);
+uint8_t QRCode_GetModule(uint8_t X, uint8_t Y);
+void QRCode_Draw(const Canvas_t *Canvas, int16_t X, int16_t Y, uint8_t Scale);
+
+/*********************函数声明*/
+
+#endif
@@ -0,0 +1,283 @@
+#include "Text.h"
+
+/*汉字字模查找，分别定义于EPD.c与OLED.c*/
+extern const uint8_t *EPD_GetChinese(const char *String, uint8_t *Length);
+extern const uint8_t *OLED_GetChinese(const char *String, uint8_t *Length);
+
+/*全局变量*********************/
+
+const TextFace_t EPD_TextFace = {&Font_Prop16, EPD_GetChinese};
+const TextFace_t OLED_TextFace = {&Font_Prop16, OLED_GetChinese};
+
+/*省略号*/
+static const char Text_Dots[] = "...";
+
+/*********************全局变量*/
+
+
+/*工具函数*********************/
+
+/*工具函数仅供内部部分函数使用*/
+
+/**
+  * 函    数：获取字符串开头一个字符的信息
+  * 参    数：Face 指定字形组合
+  * 参    数：String 指向字符的第一个字节
+  * 参    数：Width 返回字符的步进宽度
+  * 参    数：Chinese 返回汉字字模，西文字符返回NULL，不需要时给NULL
+  * 返 回 值：字符占用的字节数
+  */
+static uint8_t Text_GetChar(const TextFace_t *Face, const char *String, uint8_t *Width, const uint8_t **Chinese)
+{
+	const uint8_t *Data = 0;
+	uint8_t Length = 1;
+	
+	if ((uint8_t)*String >= 0x80 && Face->Chinese)		//汉字
+	{
+		Data = Face->Chinese(String, &Length);
+		*Width = TEXT_CHINESE_SIZE;
+	}
+	else												//西文字符
+	{
+		*Width = Font_GetAdvance(Face->Font, *String);
+	}
+	if (Chinese) {*Chinese = Data;}
+	return Length;
+}
+
+/**
+  * 函    数：从指定位置开始截取一行
+  * 参    数：Face 指定字形组合
+  * 参    数：String 行的起始位置
+  * 参    数：MaxWidth 行的最大宽度
+  * 参    数：Width 返回行的显示宽度
+  * 参    数：Next 返回下一行的起始位置
+  * 返 回 值：行的结束位置（不含）
+  * 说    明：优先在空格处和汉字前后断行，一个单词比整行还宽时按字符断行
+  *           每行至少包含一个字符，断行处的空格和换行符不显示
+  */
+static const char *Text_BreakLine(const TextFace_t *Face, const char *String, int16_t MaxWidth,
+								  int16_t *Width, const char **Next)
+{
+	const char *p = String, *Break = 0;
+	const uint8_t *Chinese;
+	int16_t LineWidth = 0, BreakWidth = 0;
+	uint8_t CharWidth, Length;
+	
+	while (*p != '\0' && *p != '\n')
+	{
+		Length = Text_GetChar(Face, p, &CharWidth, &Chinese);
+		
+		/*连续空格的第一个之前，以及汉字之前，都可以断行*/
+		if ((*p == ' ' && p > String && p[-1] != ' ') || (Chinese && p > String))
+		{
+			Break = p;
+			BreakWidth = LineWidth;
+		}
+		
+		if (LineWidth + CharWidth > MaxWidth && p > String)		//本行放不下此字符
+		{
+			if (Break == 0)				//没有断行点，按字符断行
+			{
+				Break = p;
+				BreakWidth = LineWidth;
+			}
+			*Width = BreakWidth;
+			
+			/*下一行跳过断行处的空格*/
+			p = Break;
+			while (*p == ' ') {p ++;}
+			*Next = p;
+			return Break;
+		}
+		
+		LineWidth += CharWidth;
+		p += Length;
+		
+		if (Chinese)					//汉字之后可以断行
+		{
+			Break = p;
+			BreakWidth = LineWidth;
+		}
+	}
+	
+	*Width = LineWidth;
+	*Next = (*p == '\n') ? p + 1 : p;
+	return p;
+}
+
+/**
+  * 函    数：按字符截取不超过指定宽度的一段
+  * 参    数：Face 指定字形组合
+  * 参    数：String 起始位置
+  * 参    数：End 结束位置（不含）
+  * 参    数：MaxWidth 最大宽度
+  * 参    数：Width 返回截取部分的显示宽度
+  * 返 回 值：截取部分的结束位置（不含）
+  */
+static const char *Text_FitChars(const TextFace_t *Face, const char *String, const char *End,
+								 int16_t MaxWidth, int16_t *Width)
+{
+	uint8_t CharWidth, Length;
+	
+	*Width = 0;
+	while (String < End)
+	{
+		Length = Text_GetChar(Face, String, &CharWidth, 0);
+		if (*Width + CharWidth > MaxWidth) {break;}
+		*Width += CharWidth;
+		String += Length;
+	}
+	return String;
+}
+
+/**
+  * 函    数：显示一行文字
+  * 参    数：Canvas 指定画布
+  * 参    数：X 行左上角的横坐标
+  * 参    数：Y 行左上角的纵坐标
+  * 参    数：String 起始位置
+  * 参    数：End 结束位置（不含）
+  * 参    数：Face 指定字形组合
+  * 参    数：LineHeight 行高，西文字符在行内垂直居中
+  * 返 回 值：无
+  */
+static void Text_DrawLine(const Canvas_t *Canvas, int16_t X, int16_t Y, const char *String, const char *End,
+							 const TextFace_t *Face, uint8_t LineHeight)
+{
+	const uint8_t *Chinese;
+	uint8_t CharWidth, Length, i;
+	
+	while (String < End)
+	{
+		Length = Text_GetChar(Face, String, &CharWidth, &Chinese);
+		if (Chinese)
+		{
+			/*字模上下两页拼成一列写入*/
+			for (i = 0; i < TEXT_CHINESE_SIZE; i ++)
+			{
+				Canvas_WriteColumn(Canvas, X + i, Y + (LineHeight - TEXT_CHINESE_SIZE) / 2,
+								   Chinese[i] | ((uint32_t)Chinese[TEXT_CHINESE_SIZE + i] << 8), TEXT_CHINESE_SIZE);
+			}
+		}
+		else
+		{
+			Font_ShowChar(Canvas, X, Y + (LineHeight - Face->Font->Height) / 2, *String, Face->Font);
+		}
+		X += CharWidth;
+		String += Length;
+	}
+}
+
+/*********************工具函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：在矩形区域内排版显示字符串
+  * 参    数：Canvas 指定画布，范围：&EPD_Canvas或&OLED_Canvas，只测量时可给NULL
+  * 参    数：Rect 指定排版的矩形区域
+  * 参    数：String 指定要显示的字符串，可包含汉字与换行符'\n'
+  * 参    数：Face 指定字形组合，范围：&EPD_TextFace或&OLED_TextFace或自定义
+  * 参    数：Align 对齐方式与选项，范围：TEXT_LEFT/TEXT_CENTER/TEXT_RIGHT
+  *                 或上TEXT_TOP/TEXT_MIDDLE/TEXT_BOTTOM，以及TEXT_ELLIPSIS、TEXT_MEASURE
+  * 参    数：Bounds 返回实际显示的范围，可直接作为局部刷新的区域，不需要时给NULL
+  * 返 回 值：显示的行数
+  * 说    明：行高为西文字体与汉字高度中较大者，区域内放不下的行不显示
+  *           给出TEXT_ELLIPSIS时，文字没有显示完则在最后一行末尾显示"..."
+  *           给出TEXT_MEASURE时只计算行数和显示范围，不写显存
+  *           每个字符的步进宽度*行高区域会被整体覆盖，行与行之外的区域保持不变
+  *           调用此函数后，要想真正地呈现在屏幕上，还需调用更新函数
+  */
+uint16_t Text_Layout(const Canvas_t *Canvas, const TextRect_t *Rect, const char *String,
+					 const TextFace_t *Face, uint8_t Align, TextRect_t *Bounds)
+{
+	const char *p, *End, *Next;
+	int16_t X, Y, Width, Left, Right, DotWidth = 0;
+	uint16_t Lines, MaxLines, i;
+	uint8_t LineHeight, Ellipsis;
+	
+	LineHeight = Face->Font->Height;
+	if (Face->Chinese && LineHeight < TEXT_CHINESE_SIZE) {LineHeight = TEXT_CHINESE_SIZE;}
+	MaxLines = Rect->Height > 0 ? Rect->Height / LineHeight : 0;
+	
+	/*第一遍只断行，统计行数，用于垂直对齐*/
+	Lines = 0;
+	p = String;
+	while (*p != '\0' && Lines < MaxLines)
+	{
+		Text_BreakLine(Face, p, Rect->Width, &Width, &p);
+		Lines ++;
+	}
+	
+	/*文字没有显示完时，最后一行需要省略号*/
+	Ellipsis = (Align & TEXT_ELLIPSIS) && *p != '\0' && Lines > 0;
+	if (Ellipsis) {DotWidth = 3 * Font_GetAdvance(Face->Font, '.');}
+	
+	Y = Rect->Y;
+	if (Align & TEXT_MIDDLE)
+	{
+		Y += (Rect->Height - Lines * LineHeight) / 2;
+	}
+	else if (Align & TEXT_BOTTOM)
+	{
+		Y += Rect->Height - Lines * LineHeight;
+	}
+	
+	/*第二遍逐行对齐并显示，同时记录左右边界*/
+	Left = Rect->X + Rect->Width;
+	Right = Rect->X;
+	p = String;
+	for (i = 0; i < Lines; i ++)
+	{
+		End = Text_BreakLine(Face, p, Rect->Width, &Width, &Next);
+		
+		if (Ellipsis && i == Lines - 1)
+		{
+			/*最后一行按字符截短，留出"..."的宽度*/
+			End = Text_FitChars(Face, p, End, Rect->Width - DotWidth, &Width);
+			Width += DotWidth;
+		}
+		
+		X = Rect->X;
+		if (Align & TEXT_CENTER)
+		{
+			X += (Rect->Width - Width) / 2;
+		}
+		else if (Align & TEXT_RIGHT)
+		{
+			X += Rect->Width - Width;
+		}
+		
+		if (!(Align & TEXT_MEASURE))
+		{
+			Text_DrawLine(Canvas, X, Y, p, End, Face, LineHeight);
+			if (Ellipsis && i == Lines - 1)
+			{
+				Text_DrawLine(Canvas, X + Width - DotWidth, Y, Text_Dots, Text_Dots + 3, Face, LineHeight);
+			}
+		}
+		
+		if (Width > 0)
+		{
+			if (X < Left) {Left = X;}
+			if (X + Width > Right) {Right = X + Width;}
+		}
+		
+		Y += LineHeight;
+		p = Next;
+	}
+	
+	if (Bounds)
+	{
+		if (Right < Left) {Left = Right = Rect->X;}		//没有显示任何字符
+		Bounds->X = Left;
+		Bounds->Width = Right - Left;
+		Bounds->Height = Lines * LineHeight;
+		Bounds->Y = Y - Bounds->Height;
+	}
+	return Lines;
+}
+
+/*********************功能函数*/
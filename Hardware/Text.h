@@ -0,0 +1,62 @@
+#ifndef __TEXT_H
+#define __TEXT_H
+
+#include <stdint.h>
+#include "Canvas.h"
+#include "Font.h"
+
+/*排版描述*********************/
+
+/*矩形区域，用于指定排版范围和返回显示范围*/
+typedef struct
+{
+	int16_t X;			//左上角横坐标
+	int16_t Y;			//左上角纵坐标
+	int16_t Width;		//宽度
+	int16_t Height;		//高度
+} TextRect_t;
+
+/**
+  * 字形组合：西文使用比例字体，汉字使用显示屏的16*16字模库
+  * Chinese根据字符串开头的汉字返回字模，并通过Length返回该汉字占用的字节数
+  * 字模格式与EPD_ShowImage一致，Chinese为NULL时高位为1的字节按字体的缺省字符显示
+  */
+typedef struct
+{
+	const Font_t *Font;											//西文字体
+	const uint8_t *(*Chinese)(const char *String, uint8_t *Length);	//汉字字模查找
+} TextFace_t;
+
+/*EPD与OLED的默认字形组合，西文均为Font_Prop16*/
+extern const TextFace_t EPD_TextFace;
+extern const TextFace_t OLED_TextFace;
+
+/*********************排版描述*/
+
+
+/*参数宏定义*********************/
+
+/*Align参数取值，水平、垂直与选项之间可用或运算组合*/
+#define TEXT_LEFT				0x00	//水平左对齐
+#define TEXT_CENTER				0x01	//水平居中
+#define TEXT_RIGHT				0x02	//水平右对齐
+#define TEXT_TOP				0x00	//垂直顶端对齐
+#define TEXT_MIDDLE				0x04	//垂直居中
+#define TEXT_BOTTOM				0x08	//垂直底端对齐
+#define TEXT_ELLIPSIS			0x10	//放不下时最后一行以"..."结尾
+#define TEXT_MEASURE			0x20	//只测量，不写显存
+
+/*汉字字模的宽度和高度*/
+#define TEXT_CHINESE_SIZE		16
+
+/*********************参数宏定义*/
+
+
+/*函数声明*********************/
+
+uint16_t Text_Layout(const Canvas_t *Canvas, const TextRect_t *Rect, const char *String,
+					 const TextFace_t *Face, uint8_t Align, TextRect_t *Bounds);
+
+/*********************函数声明*/
+
+#endif
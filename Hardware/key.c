@@ -1,85 +1,290 @@
 #include "stm32f10x.h"                  // Device header
-#include "Delay.h"
+#include "key.h"
+#include "Sched.h"
+#include "Power.h"
 
+/*按键使用的EXTI线*/
+#define KEY_EXTI_LINES			(EXTI_Line2 | EXTI_Line8 | EXTI_Line9)
 
+/*按键状态*/
+#define KEY_STATE_IDLE			0		//松开
+#define KEY_STATE_HELD			1		//按下，未到长按时间
+#define KEY_STATE_REPEAT		2		//长按后继续按住
+#define KEY_STATE_WAIT			3		//松开后等待双击
 
-/**
-  * @brief 
-  * @param  
-  * @retval 
-  */
-void Key_Init(void)
+/*全局变量*********************/
+
+/*每个按键的消抖与状态机*/
+typedef struct
 {
-	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOC,ENABLE);
-	GPIO_InitTypeDef GPIO_InitStructure_C;
-	GPIO_InitStructure_C.GPIO_Mode = GPIO_Mode_IPU;
-	GPIO_InitStructure_C.GPIO_Pin = GPIO_Pin_8|GPIO_Pin_9;
-	GPIO_InitStructure_C.GPIO_Speed = GPIO_Speed_50MHz;
-	GPIO_Init(GPIOC,&GPIO_InitStructure_C);
+	uint8_t History;		//最近的采样，B0为最新一次，1为按下
+	uint8_t Level;			//消抖后的电平，1为按下
+	uint8_t State;			//KEY_STATE_*
+	uint8_t Second;			//本次按下是双击的第二次，松开后不再等待双击
+	uint16_t Time;			//进入当前状态后经过的时间，单位ms
+} Key_Machine_t;
 
-	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOD,ENABLE);
-	GPIO_InitTypeDef GPIO_InitStructure_D;
-	GPIO_InitStructure_D.GPIO_Mode = GPIO_Mode_IPU;
-	GPIO_InitStructure_D.GPIO_Pin = GPIO_Pin_2;
-	GPIO_InitStructure_D.GPIO_Speed = GPIO_Speed_50MHz;
-	GPIO_Init(GPIOC,&GPIO_InitStructure_D);
+static Key_Machine_t Key_Machines[KEY_NUM];
 
+/*是否正在采样，由EXTI中断置1，SysTick中断在全部按键空闲后清0*/
+static volatile uint8_t Key_Active;
+static uint8_t Key_Divider;
 
+/*事件队列，Head只由中断（生产者）写，Tail只由主循环（消费者）写，不需要关中断*/
+static Key_Event_t Key_Queue[KEY_QUEUE_SIZE];
+static volatile uint8_t Key_Head;
+static volatile uint8_t Key_Tail;
+static volatile uint32_t Key_Dropped;
 
+/*产生事件时通知的任务*/
+static uint8_t Key_TaskId = SCHED_INVALID;
+static uint32_t Key_TaskEvents;
 
+/*********************全局变量*/
 
 
+/*引脚配置*********************/
+
+/**
+  * 函    数：读取按键引脚
+  * 参    数：Key 按键编号，KEY_0~KEY_2
+  * 返 回 值：1：按下（低电平），0：松开
+  */
+static uint8_t Key_ReadPin(uint8_t Key)
+{
+	switch (Key)
+	{
+		case KEY_0: return GPIO_ReadInputDataBit(GPIOC, GPIO_Pin_8) == 0;
+		case KEY_1: return GPIO_ReadInputDataBit(GPIOC, GPIO_Pin_9) == 0;
+		default: return GPIO_ReadInputDataBit(GPIOD, GPIO_Pin_2) == 0;
+	}
 }
+
 /**
-  * @brief 
-  * @param  
-  * @retval 
+  * 函    数：按键初始化
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：PC8、PC9、PD2上拉输入，下降沿经EXTI第8、9、2线产生中断
   */
-uint8_t Key0_GetNum(void)
+void Key_Init(void)
 {
-	uint8_t Key_Num=0;
-	if(GPIO_ReadInputDataBit(GPIOC,GPIO_Pin_8)==0)
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOC | RCC_APB2Periph_GPIOD | RCC_APB2Periph_AFIO, ENABLE);
+	
+	GPIO_InitTypeDef GPIO_InitStructure;
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;
+	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_8 | GPIO_Pin_9;
+	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+	GPIO_Init(GPIOC, &GPIO_InitStructure);
+	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_2;
+	GPIO_Init(GPIOD, &GPIO_InitStructure);
+	
+	GPIO_EXTILineConfig(GPIO_PortSourceGPIOC, GPIO_PinSource8);
+	GPIO_EXTILineConfig(GPIO_PortSourceGPIOC, GPIO_PinSource9);
+	GPIO_EXTILineConfig(GPIO_PortSourceGPIOD, GPIO_PinSource2);
+	
+	EXTI_InitTypeDef EXTI_InitStructure;
+	EXTI_InitStructure.EXTI_Line = KEY_EXTI_LINES;
+	EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+	EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Falling;
+	EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+	EXTI_Init(&EXTI_InitStructure);
+	EXTI_ClearITPendingBit(KEY_EXTI_LINES);
+	
+	NVIC_InitTypeDef NVIC_InitStructure;
+	NVIC_InitStructure.NVIC_IRQChannel = EXTI2_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+	NVIC_InitStructure.NVIC_IRQChannel = EXTI9_5_IRQn;
+	NVIC_Init(&NVIC_InitStructure);
+}
+
+/*********************引脚配置*/
+
+
+/*工具函数*********************/
+
+/**
+  * 函    数：事件入队
+  * 参    数：Key 按键编号
+  * 参    数：Type 事件类型
+  * 返 回 值：无
+  * 说    明：只在SysTick中断中调用，先写数据再移动Head，主循环读到新的Head时数据已经写好
+  */
+static void Key_Push(uint8_t Key, uint8_t Type)
+{
+	uint8_t Head = Key_Head;
+	
+	if ((uint8_t)(Head - Key_Tail) >= KEY_QUEUE_SIZE)
 	{
-		Delay_ms(20);
-		while(GPIO_ReadInputDataBit(GPIOC,GPIO_Pin_8)==0);
-		Delay_ms(20);
-		Key_Num=1;
-			
+		Key_Dropped ++;
+		return;
 	}
-	return Key_Num;
+	Key_Queue[Head % KEY_QUEUE_SIZE].Key = Key;
+	Key_Queue[Head % KEY_QUEUE_SIZE].Type = Type;
+	Key_Head = Head + 1;
+	
+	Sched_Post(Key_TaskId, Key_TaskEvents);
 }
+
 /**
-  * @brief 
-  * @param  
-  * @retval 
+  * 函    数：单个按键的消抖与状态机
+  * 参    数：Key 按键编号
+  * 返 回 值：1：该按键还需要继续采样，0：已空闲
   */
-uint8_t Key1_GetNum(void)
+static uint8_t Key_Scan(uint8_t Key)
 {
-	uint8_t Key_Num=0;
-	if(GPIO_ReadInputDataBit(GPIOC,GPIO_Pin_9)==0)
+	Key_Machine_t *M = &Key_Machines[Key];
+	const uint8_t Mask = (uint8_t)((1U << KEY_DEBOUNCE) - 1);
+	uint8_t Level = M->Level;
+	
+	M->History = (uint8_t)((M->History << 1) | Key_ReadPin(Key));
+	if ((M->History & Mask) == Mask) {Level = 1;}
+	else if ((M->History & Mask) == 0) {Level = 0;}
+	
+	if (M->Time < 0xFFFF - KEY_SCAN_MS) {M->Time += KEY_SCAN_MS;}
+	
+	if (Level && !M->Level)					//按下
+	{
+		Key_Push(Key, KEY_EVENT_PRESS);
+		M->Second = (M->State == KEY_STATE_WAIT);
+		if (M->Second) {Key_Push(Key, KEY_EVENT_DOUBLE);}
+		M->State = KEY_STATE_HELD;
+		M->Time = 0;
+	}
+	else if (!Level && M->Level)			//松开
 	{
-		Delay_ms(20);
-		while(GPIO_ReadInputDataBit(GPIOC,GPIO_Pin_9)==0);
-		Delay_ms(20);
-		Key_Num=1;
-			
+		Key_Push(Key, KEY_EVENT_RELEASE);
+		M->State = (M->State == KEY_STATE_HELD && !M->Second) ? KEY_STATE_WAIT : KEY_STATE_IDLE;
+		M->Time = 0;
 	}
-	return Key_Num;
+	else if (M->State == KEY_STATE_HELD && M->Time >= KEY_LONG_MS)
+	{
+		Key_Push(Key, KEY_EVENT_LONG);
+		M->State = KEY_STATE_REPEAT;
+		M->Time = 0;
+	}
+	else if (M->State == KEY_STATE_REPEAT && M->Time >= KEY_REPEAT_MS)
+	{
+		Key_Push(Key, KEY_EVENT_REPEAT);
+		M->Time = 0;
+	}
+	else if (M->State == KEY_STATE_WAIT && M->Time >= KEY_DOUBLE_MS)
+	{
+		M->State = KEY_STATE_IDLE;
+	}
+	M->Level = Level;
+	
+	return M->State != KEY_STATE_IDLE || (M->History & Mask) != 0;
 }
 
-uint8_t Key2_GetNum(void)
+/*********************工具函数*/
+
+
+/*中断函数*********************/
+
+/**
+  * 函    数：按键EXTI中断处理
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：在EXTI2_IRQHandler与EXTI9_5_IRQHandler中调用
+  *           屏蔽按键的EXTI线，开始采样，按键抖动不会反复进入中断
+  */
+void Key_ExtiHandler(void)
 {
-	uint8_t Key_Num=0;
-	if(GPIO_ReadInputDataBit(GPIOD,GPIO_Pin_2)==0)
+	EXTI->IMR &= ~KEY_EXTI_LINES;
+	EXTI_ClearITPendingBit(KEY_EXTI_LINES);
+	
+	if (!Key_Active)
 	{
-		Delay_ms(20);
-		while(GPIO_ReadInputDataBit(GPIOD,GPIO_Pin_2)==0);
-		Delay_ms(20);
-		Key_Num=1;
-			
+		Key_Divider = 0;
+		Key_Active = 1;
+		Power_Block(POWER_BLOCK_KEY);
 	}
-	return Key_Num;
 }
 
+/**
+  * 函    数：按键采样
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：在SysTick_Handler中每1ms调用一次，不在采样时立即返回
+  *           全部按键空闲后重新打开EXTI线，打开后再检查一次引脚，防止漏掉打开前按下的按键
+  */
+void Key_Tick(void)
+{
+	uint32_t Primask;
+	uint8_t i, Busy = 0;
+	
+	if (!Key_Active) {return;}
+	if (++ Key_Divider < KEY_SCAN_MS) {return;}
+	Key_Divider = 0;
+	
+	for (i = 0; i < KEY_NUM; i ++)
+	{
+		Busy |= Key_Scan(i);
+	}
+	if (Busy) {return;}
+	
+	/*关中断，防止与EXTI中断交错*/
+	Primask = __get_PRIMASK();
+	__disable_irq();
+	EXTI_ClearITPendingBit(KEY_EXTI_LINES);
+	EXTI->IMR |= KEY_EXTI_LINES;
+	if (!Key_ReadPin(KEY_0) && !Key_ReadPin(KEY_1) && !Key_ReadPin(KEY_2))
+	{
+		Key_Active = 0;
+		Power_Unblock(POWER_BLOCK_KEY);
+	}
+	else
+	{
+		EXTI->IMR &= ~KEY_EXTI_LINES;
+	}
+	__set_PRIMASK(Primask);
+}
+
+/*********************中断函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：设置产生事件时通知的任务
+  * 参    数：Id 任务编号，Sched_Add的返回值，SCHED_INVALID表示不通知
+  * 参    数：Events 投递给该任务的事件
+  * 返 回 值：无
+  * 说    明：每个按键事件入队时向该任务投递Events，任务中循环调用Key_Read取完队列
+  */
+void Key_SetTask(uint8_t Id, uint32_t Events)
+{
+	Key_TaskEvents = Events;
+	Key_TaskId = Id;
+}
+
+/**
+  * 函    数：取出一个按键事件
+  * 参    数：Event 取出的事件
+  * 返 回 值：1：取出成功，0：队列为空
+  * 说    明：只能在主循环（单个消费者）中调用
+  */
+uint8_t Key_Read(Key_Event_t *Event)
+{
+	uint8_t Tail = Key_Tail;
+	
+	if (Tail == Key_Head) {return 0;}
+	*Event = Key_Queue[Tail % KEY_QUEUE_SIZE];
+	Key_Tail = Tail + 1;
+	return 1;
+}
 
+/**
+  * 函    数：获取因队列满而丢弃的事件数
+  * 参    数：无
+  * 返 回 值：丢弃的事件数，从上电开始累计
+  */
+uint32_t Key_GetDropped(void)
+{
+	return Key_Dropped;
+}
 
+/*********************功能函数*/
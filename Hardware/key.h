@@ -1,9 +1,65 @@
 #ifndef __KEY_H__
 #define __KEY_H__
 
+#include <stdint.h>
+
+/**
+  * 按键输入
+  * 按下沿触发EXTI中断后开始在SysTick中断里每KEY_SCAN_MS采样一次，连续KEY_DEBOUNCE次相同才认为电平稳定
+  * 由状态机产生按下、松开、长按、连发、双击事件，写入无锁的单生产者单消费者队列，主循环用Key_Read取出
+  * 所有按键松开且双击等待结束后停止采样，重新等待EXTI中断，空闲时不占用CPU
+  * 任何函数都不会阻塞
+  */
+
+/*参数宏定义*********************/
+
+/*按键编号，Key_Event_t的Key取值*/
+#define KEY_0					0		//PC8
+#define KEY_1					1		//PC9
+#define KEY_2					2		//PD2
+#define KEY_NUM					3
+
+/*事件类型，Key_Event_t的Type取值*/
+#define KEY_EVENT_PRESS			1		//按下，每次按下都产生
+#define KEY_EVENT_RELEASE		2		//松开，每次松开都产生
+#define KEY_EVENT_LONG			3		//按住超过KEY_LONG_MS
+#define KEY_EVENT_REPEAT		4		//长按后继续按住，每KEY_REPEAT_MS产生一次
+#define KEY_EVENT_DOUBLE		5		//松开后KEY_DOUBLE_MS内再次按下，紧跟在第二次的PRESS之后产生
+
+/*时间参数，单位ms*/
+#define KEY_SCAN_MS				5		//采样间隔
+#define KEY_DEBOUNCE			4		//连续相同的采样次数，范围：1~8，消抖时间为KEY_SCAN_MS*KEY_DEBOUNCE
+#define KEY_LONG_MS				800
+#define KEY_REPEAT_MS			150
+#define KEY_DOUBLE_MS			300
+
+/*事件队列长度，必须为2的整数次方，队列满时丢弃新事件*/
+#define KEY_QUEUE_SIZE			16
+
+/*********************参数宏定义*/
+
+
+/*事件描述*********************/
+
+typedef struct
+{
+	uint8_t Key;		//按键编号，KEY_0~KEY_2
+	uint8_t Type;		//事件类型，KEY_EVENT_*
+} Key_Event_t;
+
+/*********************事件描述*/
+
+
+/*函数声明*********************/
+
 void Key_Init(void);
-uint8_t Key0_GetNum(void);
-uint8_t Key1_GetNum(void);
-uint8_t Key2_GetNum(void);
+void Key_SetTask(uint8_t Id, uint32_t Events);
+uint8_t Key_Read(Key_Event_t *Event);
+uint32_t Key_GetDropped(void);
+
+void Key_ExtiHandler(void);
+void Key_Tick(void);
+
+/*********************函数声明*/
 
 #endif
@@ -0,0 +1,40 @@
+#include "stm32f10x.h"
+#include "Cycle.h"
+
+/*功能函数*********************/
+
+/**
+  * 函    数：周期计数器初始化
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：打开调试跟踪，使能DWT的CYCCNT，每个内核时钟加1，72MHz下约59.6秒溢出一次
+  *           计算时间差时直接相减，溢出一次以内结果正确
+  */
+void Cycle_Init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;		//使能DWT与ITM
+	CYCLE_DWT_CYCCNT = 0;
+	CYCLE_DWT_CTRL |= 0x00000001;						//CYCCNTENA
+}
+
+/**
+  * 函    数：读取周期计数
+  * 参    数：无
+  * 返 回 值：当前周期计数
+  */
+uint32_t Cycle_Get(void)
+{
+	return CYCLE_DWT_CYCCNT;
+}
+
+/**
+  * 函    数：周期数换算为微秒
+  * 参    数：Cycles 周期数
+  * 返 回 值：对应的微秒数，按SystemCoreClock换算
+  */
+uint32_t Cycle_ToUs(uint32_t Cycles)
+{
+	return Cycles / (SystemCoreClock / 1000000);
+}
+
+/*********************功能函数*/
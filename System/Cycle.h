@@ -0,0 +1,26 @@
+#ifndef __CYCLE_H
+#define __CYCLE_H
+
+#include <stdint.h>
+
+/*寄存器定义*********************/
+
+/*Start中的core_cm3.h版本较早，没有DWT的定义，此处直接给出地址*/
+#define CYCLE_DWT_CTRL			(*(volatile uint32_t *)0xE0001000)
+#define CYCLE_DWT_CYCCNT		(*(volatile uint32_t *)0xE0001004)
+
+/*读取周期计数，宏的形式不产生函数调用，测量开销最小*/
+#define CYCLE_GET()				(CYCLE_DWT_CYCCNT)
+
+/*********************寄存器定义*/
+
+
+/*函数声明*********************/
+
+void Cycle_Init(void);
+uint32_t Cycle_Get(void);
+uint32_t Cycle_ToUs(uint32_t Cycles);
+
+/*********************函数声明*/
+
+#endif
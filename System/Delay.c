@@ -1,17 +1,24 @@
 #include "stm32f10x.h"
+#include "Tick.h"
 
 /**
   * @brief  微秒级延时
-  * @param  xus 延时时长，范围：0~233015
+  * @param  xus 延时时长，范围：0~4294967295
   * @retval 无
+  * @note   基于Tick时基计时，不再改写SysTick，延时期间毫秒计数照常累加
+  *         时基未启动时先启动时基
+  *         在优先级高于SysTick的中断中调用时，超过1ms的延时可能提前结束
   */
 void Delay_us(uint32_t xus)
 {
-	SysTick->LOAD = 72 * xus;				//设置定时器重装值
-	SysTick->VAL = 0x00;					//清空当前计数值
-	SysTick->CTRL = 0x00000005;				//设置时钟源为HCLK，启动定时器
-	while(!(SysTick->CTRL & 0x00010000));	//等待计数到0
-	SysTick->CTRL = 0x00000004;				//关闭定时器
+	uint32_t Start;
+	
+	if (!(SysTick->CTRL & SysTick_CTRL_ENABLE_Msk))	//时基未启动
+	{
+		Tick_Init();
+	}
+	Start = Tick_Micros();
+	while (Tick_Micros() - Start < xus);	//等待经过xus微秒
 }
 
 /**
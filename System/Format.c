@@ -0,0 +1,420 @@
+#include "Format.h"
+#include <string.h>
+
+/**
+  * 数字格式化
+  * 所有函数都从最低位开始，向前逐位写入指定长度的字符，不足的高位补0，超出的高位舍去
+  * 输出结果与Number / Pow(Base, Length - i - 1) % Base逐位提取的结果一致
+  * Length超过十进制10位、十六进制8位、二进制32位时，超出的高位均为0，
+  * 而逐位提取的写法在这些位上次方溢出，十进制可能显示错误的数字，十六进制与二进制除以0
+  * 但每位只需一次运算，不再每位重新计算次方和做32位除法
+  *
+  * 定点数格式化
+  * 输出格式与ShowFloatNum一致：符号、IntLength位整数、小数点、FraLength位小数
+  * 小数部分四舍五入，进位加到整数部分，全程只用整数运算，不引入软件浮点库
+  */
+
+/*10的0~9次方*/
+static const uint32_t Format_Pow10[10] = {
+	1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+/**
+  * 函    数：除以10
+  * 参    数：Number 被除数
+  * 返 回 值：Number / 10
+  * 说    明：乘以2^35/10的倒数近似值后右移35位，对全部32位无符号数精确成立
+  *           Cortex-M3上编译为一条UMULL和一次移位，避免UDIV的2~12周期
+  */
+static uint32_t Format_Div10(uint32_t Number)
+{
+	return (uint32_t)(((uint64_t)Number * 0xCCCCCCCDUL) >> 35);
+}
+
+/**
+  * 函    数：计算十进制位数
+  * 参    数：Number 指定的数字
+  * 返 回 值：Number的十进制位数，0的位数为1
+  */
+static uint8_t Format_DecLength(uint32_t Number)
+{
+	uint8_t Length = 1;
+	
+	while (Number >= 10)
+	{
+		Number = Format_Div10(Number);
+		Length ++;
+	}
+	return Length;
+}
+
+/**
+  * 函    数：十进制格式化
+  * 参    数：String 输出缓冲区，至少Length + 1字节
+  * 参    数：Number 指定的数字，范围：0~4294967295
+  * 参    数：Length 输出的位数
+  * 返 回 值：输出的字符数，即Length
+  */
+uint8_t Format_Dec(char *String, uint32_t Number, uint8_t Length)
+{
+	uint32_t Quotient;
+	uint8_t i = Length;
+
+	String[Length] = '\0';
+	while (i --)
+	{
+		Quotient = Format_Div10(Number);
+		String[i] = Number - Quotient * 10 + '0';	//余数即当前位
+		Number = Quotient;
+	}
+	return Length;
+}
+
+/**
+  * 函    数：十六进制格式化
+  * 参    数：String 输出缓冲区，至少Length + 1字节
+  * 参    数：Number 指定的数字，范围：0x00000000~0xFFFFFFFF
+  * 参    数：Length 输出的位数
+  * 返 回 值：输出的字符数，即Length
+  */
+uint8_t Format_Hex(char *String, uint32_t Number, uint8_t Length)
+{
+	static const char Digit[] = "0123456789ABCDEF";
+	uint8_t i = Length;
+
+	String[Length] = '\0';
+	while (i --)
+	{
+		String[i] = Digit[Number & 0x0F];		//取低4位
+		Number >>= 4;
+	}
+	return Length;
+}
+
+/**
+  * 函    数：二进制格式化
+  * 参    数：String 输出缓冲区，至少Length + 1字节
+  * 参    数：Number 指定的数字，范围：0x00000000~0xFFFFFFFF
+  * 参    数：Length 输出的位数
+  * 返 回 值：输出的字符数，即Length
+  */
+uint8_t Format_Bin(char *String, uint32_t Number, uint8_t Length)
+{
+	uint8_t i = Length;
+
+	String[Length] = '\0';
+	while (i --)
+	{
+		String[i] = (Number & 0x01) + '0';		//取最低位
+		Number >>= 1;
+	}
+	return Length;
+}
+
+/**
+  * 函    数：按整数与小数两部分输出定点数
+  * 参    数：String 输出缓冲区，至少IntLength + FraLength + 3字节
+  * 参    数：Negative 是否为负数
+  * 参    数：IntNum 整数部分
+  * 参    数：FraNum 已四舍五入的小数部分，等于10^FraLength时表示向整数进位
+  * 参    数：IntLength 整数部分的位数，范围：0~10
+  * 参    数：FraLength 小数部分的位数，范围：0~9
+  * 返 回 值：输出的字符数
+  */
+static uint8_t Format_Fixed(char *String, uint8_t Negative, uint32_t IntNum, uint32_t FraNum,
+							uint8_t IntLength, uint8_t FraLength)
+{
+	if (FraNum >= Format_Pow10[FraLength])	//四舍五入造成了进位，加给整数
+	{
+		FraNum -= Format_Pow10[FraLength];
+		IntNum ++;
+	}
+	
+	String[0] = Negative ? '-' : '+';
+	Format_Dec(String + 1, IntNum, IntLength);
+	String[IntLength + 1] = '.';
+	Format_Dec(String + IntLength + 2, FraNum, FraLength);
+	return IntLength + FraLength + 2;
+}
+
+/**
+  * 函    数：Q16.16定点数格式化
+  * 参    数：String 输出缓冲区，至少IntLength + FraLength + 3字节
+  * 参    数：Number Q16.16定点数，即实际值乘以65536，范围：-32768.0~32767.99998
+  * 参    数：IntLength 整数部分的位数，范围：0~10
+  * 参    数：FraLength 小数部分的位数，范围：0~9，Q16.16的分辨率约为0.000015，超过4位无意义
+  * 返 回 值：输出的字符数
+  * 说    明：小数部分为(小数 * 10^FraLength + 0.5)取整，与round的结果一致
+  */
+uint8_t Format_Q16(char *String, int32_t Number, uint8_t IntLength, uint8_t FraLength)
+{
+	uint32_t Magnitude;
+	uint32_t FraNum;
+	
+	if (FraLength > 9) {FraLength = 9;}
+	
+	Magnitude = Number >= 0 ? (uint32_t)Number : 0 - (uint32_t)Number;
+	
+	/*低16位为小数，乘以10^FraLength后加0.5（0x8000）再右移16位，即四舍五入*/
+	FraNum = ((uint64_t)(Magnitude & 0xFFFF) * Format_Pow10[FraLength] + 0x8000) >> 16;
+	
+	return Format_Fixed(String, Number < 0, Magnitude >> 16, FraNum, IntLength, FraLength);
+}
+
+/**
+  * 函    数：缩放整数格式化
+  * 参    数：String 输出缓冲区，至少IntLength + FraLength + 3字节
+  * 参    数：Number 缩放后的整数，实际值为Number / 10^Scale，如Scale为2时，1234表示12.34
+  * 参    数：Scale 缩放的小数位数，范围：0~9
+  * 参    数：IntLength 整数部分的位数，范围：0~10
+  * 参    数：FraLength 小数部分的位数，范围：0~9，少于Scale时四舍五入
+  * 返 回 值：输出的字符数
+  */
+uint8_t Format_Scaled(char *String, int32_t Number, uint8_t Scale, uint8_t IntLength, uint8_t FraLength)
+{
+	uint32_t Magnitude, Divisor;
+	uint32_t IntNum, FraNum;
+	
+	if (Scale > 9) {Scale = 9;}
+	if (FraLength > 9) {FraLength = 9;}
+	
+	Magnitude = Number >= 0 ? (uint32_t)Number : 0 - (uint32_t)Number;
+	IntNum = Magnitude / Format_Pow10[Scale];
+	FraNum = Magnitude - IntNum * Format_Pow10[Scale];
+	
+	if (FraLength >= Scale)			//小数位数足够，补0即可
+	{
+		FraNum *= Format_Pow10[FraLength - Scale];
+	}
+	else							//小数位数不足，四舍五入
+	{
+		Divisor = Format_Pow10[Scale - FraLength];
+		FraNum = (FraNum + Divisor / 2) / Divisor;
+	}
+	
+	return Format_Fixed(String, Number < 0, IntNum, FraNum, IntLength, FraLength);
+}
+
+/**
+  * 函    数：单精度浮点数转换为Q16.16定点数
+  * 参    数：Number 单精度浮点数，范围：-32768.0~32767.99998，超出时取边界值
+  * 返 回 值：Q16.16定点数，四舍五入到1/65536
+  * 说    明：直接拆分IEEE754的指数和尾数做移位，不调用任何浮点运算函数
+  */
+int32_t Format_FloatToQ16(float Number)
+{
+	union
+	{
+		float Float;
+		uint32_t Bits;
+	} Value;
+	int16_t Exponent;
+	uint32_t Mantissa, Result;
+	
+	Value.Float = Number;
+	Exponent = (int16_t)((Value.Bits >> 23) & 0xFF) - 127;
+	Mantissa = (Value.Bits & 0x007FFFFF) | 0x00800000;
+	
+	if (Exponent >= 15)				//超出Q16.16的范围，或为无穷大和NaN
+	{
+		Result = 0x7FFFFFFF;
+	}
+	else if (Exponent < -17)		//小于1/131072，舍入后为0
+	{
+		Result = 0;
+	}
+	else if (Exponent >= 7)			//尾数为24位，乘以2^(Exponent - 7)即为Q16.16
+	{
+		Result = Mantissa << (Exponent - 7);
+	}
+	else							//右移并四舍五入
+	{
+		Result = (Mantissa + (1UL << (6 - Exponent))) >> (7 - Exponent);
+	}
+	
+	return (Value.Bits & 0x80000000) ? -(int32_t)Result : (int32_t)Result;
+}
+
+/**
+  * 函    数：按宽度补齐后输出一段字符
+  * 参    数：Put 字符接收函数
+  * 参    数：Arg 字符接收函数的参数
+  * 参    数：String 要输出的字符
+  * 参    数：Length 要输出的字符数
+  * 参    数：Width 最小宽度，不足时补齐
+  * 参    数：Pad 补齐字符，为'0'时补在符号之后，为'-'时左对齐并在右侧补空格
+  * 返 回 值：无
+  */
+static void Format_PutPadded(Format_PutFunc Put, void *Arg, const char *String, uint16_t Length,
+							 uint16_t Width, char Pad)
+{
+	if (Pad == '0' && Length > 0 && (String[0] == '-' || String[0] == '+'))
+	{
+		Put(*String, Arg);				//符号在补0之前输出
+		String ++;
+		Length --;
+		if (Width > 0) {Width --;}
+	}
+	while (Pad != '-' && Width > Length)
+	{
+		Put(Pad, Arg);
+		Width --;
+	}
+	while (Length > 0)
+	{
+		Put(*String, Arg);
+		String ++;
+		Length --;
+		if (Width > 0) {Width --;}
+	}
+	while (Width > 0)				//左对齐时剩余宽度补空格
+	{
+		Put(' ', Arg);
+		Width --;
+	}
+}
+
+/**
+  * 函    数：流式格式化输出
+  * 参    数：Put 字符接收函数，每产生一个字符立即调用，不经过字符串缓冲区
+  * 参    数：Arg 字符接收函数的参数
+  * 参    数：Format 格式化字符串，支持以下转换，均可带最小宽度以及'0'补齐或'-'左对齐标志，如%05d
+  *           %d %i 有符号十进制    %u 无符号十进制    %x %X 十六进制（大写）
+  *           %c 字符    %s 字符串    %% 百分号
+  *           %f Q16.16定点数（int32_t，实际值乘以65536），可带精度，如%.2f，默认2位小数
+  *           长度修饰符l会被忽略，因为int与long均为32位
+  * 参    数：ArgList 参数列表
+  * 返 回 值：无
+  * 说    明：每个数字转换只使用一个不超过24字节的临时数组，不调用vsprintf
+  */
+void Format_Stream(Format_PutFunc Put, void *Arg, const char *Format, va_list ArgList)
+{
+	char Number[24];
+	uint8_t Length, Width, Precision;
+	char Pad;
+	int32_t Signed;
+	uint32_t Unsigned;
+	const char *String;
+	char *Digits;
+	
+	while (*Format != '\0')
+	{
+		if (*Format != '%')				//普通字符直接输出
+		{
+			Put(*Format, Arg);
+			Format ++;
+			continue;
+		}
+		Format ++;
+		
+		/*解析标志、宽度和精度*/
+		Pad = ' ';
+		Width = 0;
+		Precision = 2;
+		if (*Format == '-' || *Format == '0')
+		{
+			Pad = *Format;
+			Format ++;
+		}
+		while (*Format >= '0' && *Format <= '9')
+		{
+			Width = Width * 10 + (*Format - '0');
+			Format ++;
+		}
+		if (*Format == '.')
+		{
+			Format ++;
+			Precision = 0;
+			while (*Format >= '0' && *Format <= '9')
+			{
+				Precision = Precision * 10 + (*Format - '0');
+				Format ++;
+			}
+			if (Precision > 9) {Precision = 9;}
+		}
+		while (*Format == 'l')
+		{
+			Format ++;
+		}
+		
+		/*按转换字符输出*/
+		switch (*Format)
+		{
+			case 'd':
+			case 'i':
+				Signed = va_arg(ArgList, int32_t);
+				Unsigned = Signed >= 0 ? (uint32_t)Signed : 0 - (uint32_t)Signed;
+				Length = 0;
+				if (Signed < 0) {Number[Length ++] = '-';}
+				Length += Format_Dec(Number + Length, Unsigned, Format_DecLength(Unsigned));
+				Format_PutPadded(Put, Arg, Number, Length, Width, Pad);
+				break;
+			
+			case 'u':
+				Unsigned = va_arg(ArgList, uint32_t);
+				Length = Format_Dec(Number, Unsigned, Format_DecLength(Unsigned));
+				Format_PutPadded(Put, Arg, Number, Length, Width, Pad);
+				break;
+			
+			case 'x':
+			case 'X':
+				Unsigned = va_arg(ArgList, uint32_t);
+				Length = 1;
+				while (Length < 8 && (Unsigned >> (Length * 4)) != 0) {Length ++;}
+				Format_Hex(Number, Unsigned, Length);
+				Format_PutPadded(Put, Arg, Number, Length, Width, Pad);
+				break;
+			
+			case 'f':
+				Signed = va_arg(ArgList, int32_t);
+				/*先按最大整数位数格式化，再去掉符号后多余的前导0*/
+				Length = Format_Q16(Number, Signed, 5, Precision);
+				Digits = Number + 1;
+				while (Digits < Number + 5 && *Digits == '0')
+				{
+					Digits ++;
+				}
+				if (Signed < 0) {*(-- Digits) = '-';}
+				if (Precision == 0) {Length --;}		//没有小数时不输出小数点
+				Format_PutPadded(Put, Arg, Digits, Length - (Digits - Number), Width, Pad);
+				break;
+			
+			case 'c':
+				Number[0] = (char)va_arg(ArgList, int);
+				Format_PutPadded(Put, Arg, Number, 1, Width, Pad == '-' ? '-' : ' ');
+				break;
+			
+			case 's':
+				String = va_arg(ArgList, const char *);
+				Format_PutPadded(Put, Arg, String, strlen(String), Width, Pad == '-' ? '-' : ' ');
+				break;
+			
+			case '%':
+				Put('%', Arg);
+				break;
+			
+			default:					//不支持的转换，原样输出
+				Put('%', Arg);
+				if (*Format == '\0') {return;}
+				Put(*Format, Arg);
+				break;
+		}
+		Format ++;
+	}
+}
+
+/**
+  * 函    数：流式格式化输出（可变参数）
+  * 参    数：Put 字符接收函数
+  * 参    数：Arg 字符接收函数的参数
+  * 参    数：Format 格式化字符串，支持的转换同Format_Stream
+  * 参    数：... 格式化字符串参数列表
+  * 返 回 值：无
+  */
+void Format_Print(Format_PutFunc Put, void *Arg, const char *Format, ...)
+{
+	va_list ArgList;
+	va_start(ArgList, Format);
+	Format_Stream(Put, Arg, Format, ArgList);
+	va_end(ArgList);
+}
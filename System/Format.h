@@ -0,0 +1,19 @@
+#ifndef __FORMAT_H
+#define __FORMAT_H
+
+#include <stdint.h>
+#include <stdarg.h>
+
+/*格式化输出的字符接收函数，每输出一个字符调用一次，Arg为调用者的参数*/
+typedef void (*Format_PutFunc)(char Char, void *Arg);
+
+uint8_t Format_Dec(char *String, uint32_t Number, uint8_t Length);
+uint8_t Format_Hex(char *String, uint32_t Number, uint8_t Length);
+uint8_t Format_Bin(char *String, uint32_t Number, uint8_t Length);
+uint8_t Format_Q16(char *String, int32_t Number, uint8_t IntLength, uint8_t FraLength);
+uint8_t Format_Scaled(char *String, int32_t Number, uint8_t Scale, uint8_t IntLength, uint8_t FraLength);
+int32_t Format_FloatToQ16(float Number);
+void Format_Stream(Format_PutFunc Put, void *Arg, const char *Format, va_list ArgList);
+void Format_Print(Format_PutFunc Put, void *Arg, const char *Format, ...);
+
+#endif
@@ -0,0 +1,254 @@
+#include "stm32f10x.h"
+#include "Power.h"
+#include "Tick.h"
+#include "Cycle.h"
+
+/*备份寄存器，DR1保存标记与状态长度，DR2~DR10保存状态*/
+#define POWER_BKP_DR(n)			((uint16_t)((n) * 4))		//DR1~DR10的偏移地址
+#define POWER_BKP_MAGIC			0xA500						//DR1高字节的标记
+
+/*全局变量*********************/
+
+static Power_Stats_t Power_Stats;
+
+/*禁止进入STOP模式的模块，每位对应一个POWER_BLOCK_*/
+static volatile uint32_t Power_Blockers;
+
+/*********************全局变量*/
+
+
+/*硬件配置*********************/
+
+/**
+  * 函    数：低功耗管理初始化
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：打开备份域访问，以LSI为RTC时钟，RTC计数约每1ms加1
+  *           RTC闹钟经EXTI第17线产生中断，用于从STOP模式唤醒
+  */
+void Power_Init(void)
+{
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR | RCC_APB1Periph_BKP, ENABLE);
+	PWR_BackupAccessCmd(ENABLE);
+	
+	/*LSI不在备份域中，每次复位后都需要重新开启*/
+	RCC_LSICmd(ENABLE);
+	while (RCC_GetFlagStatus(RCC_FLAG_LSIRDY) == RESET);
+	RCC_RTCCLKConfig(RCC_RTCCLKSource_LSI);
+	RCC_RTCCLKCmd(ENABLE);
+	
+	RTC_WaitForSynchro();
+	RTC_WaitForLastTask();
+	RTC_SetPrescaler(POWER_RTC_PRESCALER);
+	RTC_WaitForLastTask();
+	
+	/*RTC闹钟连接在EXTI第17线，上升沿触发中断*/
+	EXTI_InitTypeDef EXTI_InitStructure;
+	EXTI_InitStructure.EXTI_Line = EXTI_Line17;
+	EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+	EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising;
+	EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+	EXTI_Init(&EXTI_InitStructure);
+	
+	NVIC_InitTypeDef NVIC_InitStructure;
+	NVIC_InitStructure.NVIC_IRQChannel = RTCAlarm_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+}
+
+/*********************硬件配置*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：空闲休眠
+  * 参    数：Time 预计的空闲时间，单位ms，即距离下一个定时器到期的时间，TICK_NEVER表示没有定时器
+  * 返 回 值：无
+  * 说    明：适合作为调度器的空闲函数，在关中断的状态下调用，被任意中断唤醒后返回
+  *           空闲时间较短时只执行WFI，内核停止，外设与SysTick照常运行
+  *           空闲时间较长时进入STOP模式，除RTC外的时钟全部停止，由RTC闹钟或其他EXTI中断唤醒
+  *           唤醒后时钟为8MHz的HSI，调用SystemInit按SetSysClockTo72重新配置为72MHz
+  *           STOP期间SysTick停止，唤醒后按RTC计数补上毫秒数，软件定时器不会因休眠而推迟
+  *           EPD不需要供电保持图像，休眠前后不需要对屏幕做任何操作
+  *           EPD刷新期间也可以进入STOP，刷新结束时BUSY的下降沿经EXTI第5线唤醒（见Display.c）
+  *           有模块调用Power_Block禁止STOP时，不论空闲时间多长都只执行WFI
+  */
+void Power_Idle(uint32_t Time)
+{
+	uint32_t Start, Slept, Cycles;
+	
+	if (Time < POWER_STOP_MIN_MS || Power_Blockers)
+	{
+		Power_Stats.Sleeps ++;
+		__WFI();
+		return;
+	}
+	
+	/*有定时器时设置闹钟，提前1ms唤醒，抵消RTC计数的相位误差*/
+	RTC_WaitForSynchro();
+	Start = RTC_GetCounter();
+	RTC_ClearFlag(RTC_FLAG_ALR);
+	EXTI_ClearITPendingBit(EXTI_Line17);
+	if (Time != TICK_NEVER)
+	{
+		RTC_WaitForLastTask();
+		RTC_SetAlarm(Start + Time - 1);
+		RTC_WaitForLastTask();
+		RTC_ITConfig(RTC_IT_ALR, ENABLE);
+		RTC_WaitForLastTask();
+	}
+	
+	PWR_EnterSTOPMode(PWR_Regulator_LowPower, PWR_STOPEntry_WFI);
+	
+	/*唤醒后恢复72MHz时钟，并测量恢复所用的周期数*/
+	Cycles = CYCLE_GET();
+	SystemInit();
+	Cycles = CYCLE_GET() - Cycles;
+	
+	/*按RTC计数补上STOP期间的毫秒数*/
+	RTC_WaitForSynchro();
+	Slept = RTC_GetCounter() - Start;
+	Tick_Advance(Slept);
+	
+	RTC_ITConfig(RTC_IT_ALR, DISABLE);
+	RTC_WaitForLastTask();
+	
+	Power_Stats.Stops ++;
+	Power_Stats.StopMs += Slept;
+	Power_Stats.WakeCycles = Cycles;
+	if (Cycles > Power_Stats.MaxWakeCycles) {Power_Stats.MaxWakeCycles = Cycles;}
+}
+
+/**
+  * 函    数：禁止进入STOP模式
+  * 参    数：Mask 调用模块对应的位，取值为POWER_BLOCK_*
+  * 返 回 值：无
+  * 说    明：STOP模式下SysTick与定时器、ADC等外设都停止，依赖它们在后台工作的模块工作期间调用本函数
+  *           各模块占用不同的位，重复调用不累计，可在中断中调用
+  */
+void Power_Block(uint32_t Mask)
+{
+	uint32_t Primask = __get_PRIMASK();
+	
+	__disable_irq();
+	Power_Blockers |= Mask;
+	__set_PRIMASK(Primask);
+}
+
+/**
+  * 函    数：解除禁止进入STOP模式
+  * 参    数：Mask 调用模块对应的位，取值为POWER_BLOCK_*
+  * 返 回 值：无
+  * 说    明：所有模块都解除后，Power_Idle恢复按空闲时间选择STOP模式，可在中断中调用
+  */
+void Power_Unblock(uint32_t Mask)
+{
+	uint32_t Primask = __get_PRIMASK();
+	
+	__disable_irq();
+	Power_Blockers &= ~Mask;
+	__set_PRIMASK(Primask);
+}
+
+/**
+  * 函    数：RTC闹钟中断处理
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：在RTCAlarm_IRQHandler中调用，只清除标志位，唤醒后的处理在Power_Idle中完成
+  */
+void Power_AlarmHandler(void)
+{
+	if (RTC_GetITStatus(RTC_IT_ALR) != RESET)
+	{
+		RTC_ClearITPendingBit(RTC_IT_ALR);
+	}
+	EXTI_ClearITPendingBit(EXTI_Line17);
+}
+
+/**
+  * 函    数：获取休眠统计
+  * 参    数：无
+  * 返 回 值：休眠统计，只读
+  * 说    明：运行时间为Tick_Millis() - StopMs，两者之比即为占空比
+  */
+const Power_Stats_t *Power_GetStats(void)
+{
+	return &Power_Stats;
+}
+
+/**
+  * 函    数：保存应用状态并进入待机模式
+  * 参    数：State 要保存的应用状态
+  * 参    数：Length 状态的字节数，范围：0~POWER_STATE_SIZE
+  * 参    数：Time 待机时间，单位ms，到时由RTC闹钟唤醒，TICK_NEVER表示只由复位唤醒
+  * 返 回 值：无，此函数不会返回
+  * 说    明：待机模式下除备份域外全部断电，唤醒即复位，从main重新开始运行
+  *           状态保存在备份寄存器中，复位后用Power_Resume取回
+  *           需先调用Power_Init启动RTC
+  *           WKUP引脚（PA0）与EPD的SCL复用，不能作为唤醒引脚，因此不开启
+  *           待机期间MCU引脚为高阻态，EPD保持供电，图像与控制器配置不受影响
+  */
+void Power_Hibernate(const void *State, uint8_t Length, uint32_t Time)
+{
+	const uint8_t *Byte = State;
+	uint8_t i;
+	
+	if (Length > POWER_STATE_SIZE) {Length = POWER_STATE_SIZE;}
+	
+	/*状态按小端存入16位的备份寄存器*/
+	for (i = 0; i < Length; i += 2)
+	{
+		BKP_WriteBackupRegister(POWER_BKP_DR(2 + i / 2),
+								Byte[i] | ((i + 1 < Length) ? Byte[i + 1] << 8 : 0));
+	}
+	BKP_WriteBackupRegister(POWER_BKP_DR(1), POWER_BKP_MAGIC | Length);
+	
+	if (Time != TICK_NEVER)
+	{
+		RTC_WaitForSynchro();
+		RTC_WaitForLastTask();
+		RTC_SetAlarm(RTC_GetCounter() + Time);
+		RTC_WaitForLastTask();
+	}
+	
+	PWR_ClearFlag(PWR_FLAG_WU);
+	PWR_EnterSTANDBYMode();
+}
+
+/**
+  * 函    数：从待机唤醒后取回应用状态
+  * 参    数：State 用于存放状态
+  * 参    数：Length 状态的字节数，需与保存时一致
+  * 返 回 值：1：从待机唤醒且状态有效，已取回，0：上电或其他复位，State不变
+  * 说    明：应在main开头调用，据此决定是完整初始化还是只恢复必要的部分
+  *           取回后清除标记，之后的非待机复位不会误用旧状态
+  */
+uint8_t Power_Resume(void *State, uint8_t Length)
+{
+	uint8_t *Byte = State;
+	uint16_t Data;
+	uint8_t i, Valid;
+	
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR | RCC_APB1Periph_BKP, ENABLE);
+	PWR_BackupAccessCmd(ENABLE);
+	
+	Data = BKP_ReadBackupRegister(POWER_BKP_DR(1));
+	Valid = PWR_GetFlagStatus(PWR_FLAG_SB) == SET
+			&& (Data & 0xFF00) == POWER_BKP_MAGIC && (Data & 0x00FF) == Length;
+	PWR_ClearFlag(PWR_FLAG_SB);
+	BKP_WriteBackupRegister(POWER_BKP_DR(1), 0);
+	if (!Valid) {return 0;}
+	
+	for (i = 0; i < Length; i += 2)
+	{
+		Data = BKP_ReadBackupRegister(POWER_BKP_DR(2 + i / 2));
+		Byte[i] = Data & 0xFF;
+		if (i + 1 < Length) {Byte[i + 1] = Data >> 8;}
+	}
+	return 1;
+}
+
+/*********************功能函数*/
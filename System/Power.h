@@ -0,0 +1,64 @@
+#ifndef __POWER_H
+#define __POWER_H
+
+#include <stdint.h>
+
+/*参数宏定义*********************/
+
+/*RTC时钟使用LSI（约40kHz），分频后计数频率约1kHz，即1个计数约1ms*/
+/*LSI误差较大，需要更准确的休眠时间时，可按实测的LSI频率修改分频值*/
+#define POWER_RTC_PRESCALER		39
+
+/*预计空闲时间小于此值（单位ms）时只执行WFI，不进入STOP模式，唤醒恢复时钟的开销不划算*/
+#define POWER_STOP_MIN_MS		5
+
+/*待机时可保存的应用状态字节数，使用备份寄存器DR2~DR10*/
+#define POWER_STATE_SIZE		18
+
+/*能耗估算使用的电流，单位uA，取自STM32F103数据手册的典型值，可按实测修改*/
+#define POWER_RUN_UA			27000	//72MHz运行，外设时钟关闭
+#define POWER_STOP_UA			14		//STOP模式，调压器低功耗模式
+#define POWER_STANDBY_UA		3		//STANDBY模式，RTC运行
+
+/*Power_Block的Mask参数取值，每个需要SysTick或外设时钟持续运行的模块占一位*/
+#define POWER_BLOCK_KEY			0x01	//按键消抖采样中
+#define POWER_BLOCK_LIGHT		0x02	//光敏传感器ADC采样中
+#define POWER_BLOCK_BEEP		0x04	//蜂鸣器播放中
+
+/*********************参数宏定义*/
+
+
+/*统计描述*********************/
+
+/**
+  * 休眠统计，从上电开始累计
+  */
+typedef struct
+{
+	uint32_t Stops;			//进入STOP模式的次数
+	uint32_t Sleeps;		//只执行WFI的次数
+	uint32_t StopMs;		//STOP模式累计时间，单位ms，由RTC计数得到
+	uint32_t WakeCycles;	//上次唤醒后SystemInit恢复72MHz时钟所用的内核周期数，期间以8MHz的HSI运行
+							//不包括唤醒事件到WFI返回之间调压器与HSI的启动时间（数据手册典型值约5.4us），
+							//该段时间内核不运行，DWT不计数，只能用示波器在引脚上测量
+	uint32_t MaxWakeCycles;	//SystemInit恢复时钟的最长内核周期数
+} Power_Stats_t;
+
+/*********************统计描述*/
+
+
+/*函数声明*********************/
+
+void Power_Init(void);
+void Power_Idle(uint32_t Time);
+void Power_Block(uint32_t Mask);
+void Power_Unblock(uint32_t Mask);
+void Power_AlarmHandler(void);
+const Power_Stats_t *Power_GetStats(void);
+uint32_t Power_Estimate(uint32_t Period, uint32_t Active);
+void Power_Hibernate(const void *State, uint8_t Length, uint32_t Time);
+uint8_t Power_Resume(void *State, uint8_t Length);
+
+/*********************函数声明*/
+
+#endif
@@ -0,0 +1,25 @@
+#include "Power.h"
+
+/**
+  * 能耗估算
+  * 只做整数运算，不访问RTC、PWR等外设，与Power.c分开编译，可在电脑上链接测试
+  */
+
+/*功能函数*********************/
+
+/**
+  * 函    数：估算平均电流
+  * 参    数：Period 刷新周期，单位ms
+  * 参    数：Active 每个周期内的运行时间，单位ms，其余时间处于STOP模式
+  * 返 回 值：平均电流，单位uA，不包括EPD与其他外部器件
+  * 说    明：按POWER_RUN_UA与POWER_STOP_UA加权平均，只做整数运算
+  *           Active可取Power_GetStats的统计值计算，或由EPD模拟器估算的更新时间代入
+  */
+uint32_t Power_Estimate(uint32_t Period, uint32_t Active)
+{
+	if (Period == 0) {return 0;}
+	if (Active > Period) {Active = Period;}
+	return (uint32_t)(((uint64_t)POWER_RUN_UA * Active + (uint64_t)POWER_STOP_UA * (Period - Active)) / Period);
+}
+
+/*********************功能函数*/
@@ -0,0 +1,185 @@
+#include "stm32f10x.h"
+#include "Profile.h"
+
+#ifdef PROFILE
+
+/*全局变量*********************/
+
+/*直方图，计满后不再增加*/
+static uint16_t Profile_Hist[PROFILE_BUCKETS];
+
+/*采样总数与落在采样范围外（如RAM中）的采样数*/
+static uint32_t Profile_Samples;
+static uint32_t Profile_Outside;
+
+/*********************全局变量*/
+
+
+/*中断函数*********************/
+
+/**
+  * 函    数：TIM3中断函数
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：中断入口时内核已把R0~R3、R12、LR、PC、xPSR压入当前栈，按EXC_RETURN的位2选择MSP或PSP，
+  *           把栈帧地址作为参数转到Profile_Sample，本函数自身不使用栈，栈帧位置不受编译器影响
+  */
+#if defined(__CC_ARM)
+__asm void TIM3_IRQHandler(void)
+{
+	IMPORT Profile_Sample
+	TST LR, #4
+	ITE EQ
+	MRSEQ R0, MSP
+	MRSNE R0, PSP
+	B Profile_Sample
+}
+#else
+__attribute__((naked)) void TIM3_IRQHandler(void)
+{
+	__asm volatile (
+		"tst lr, #4\n"
+		"ite eq\n"
+		"mrseq r0, msp\n"
+		"mrsne r0, psp\n"
+		"b Profile_Sample\n"
+	);
+}
+#endif
+
+/*********************中断函数*/
+
+#endif
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：记录一次采样
+  * 参    数：Frame 异常栈帧，Frame[6]为被打断处的PC
+  * 返 回 值：无
+  * 说    明：由TIM3_IRQHandler转入，不要在其他地方调用
+  */
+void Profile_Sample(const uint32_t *Frame)
+{
+#ifdef PROFILE
+	uint32_t Index = (Frame[6] - PROFILE_BASE) >> PROFILE_SHIFT;
+	
+	TIM_ClearITPendingBit(TIM3, TIM_IT_Update);
+	
+	Profile_Samples ++;
+	if (Index < PROFILE_BUCKETS)
+	{
+		if (Profile_Hist[Index] != 0xFFFF) {Profile_Hist[Index] ++;}
+	}
+	else
+	{
+		Profile_Outside ++;
+	}
+#endif
+}
+
+/**
+  * 函    数：采样初始化
+  * 参    数：Rate 采样频率，单位Hz，范围：16~100000，如10000
+  * 返 回 值：无
+  * 说    明：TIM3计数时钟分频为1MHz，每1000000/Rate个计数中断一次，初始化后需调用Profile_Start开始采样
+  *           采样频率越高结果越准，但中断本身的开销也越大，10kHz时约占CPU时间的0.5%
+  */
+void Profile_Init(uint32_t Rate)
+{
+#ifdef PROFILE
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM3, ENABLE);
+	
+	TIM_TimeBaseInitTypeDef TIM_TimeBaseInitStructure;
+	TIM_TimeBaseInitStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+	TIM_TimeBaseInitStructure.TIM_CounterMode = TIM_CounterMode_Up;
+	TIM_TimeBaseInitStructure.TIM_Period = 1000000 / Rate - 1;			//ARR
+	TIM_TimeBaseInitStructure.TIM_Prescaler = SystemCoreClock / 1000000 - 1;	//PSC
+	TIM_TimeBaseInitStructure.TIM_RepetitionCounter = 0;
+	TIM_TimeBaseInit(TIM3, &TIM_TimeBaseInitStructure);
+	
+	TIM_ClearFlag(TIM3, TIM_FLAG_Update);
+	TIM_ITConfig(TIM3, TIM_IT_Update, ENABLE);
+	
+	NVIC_InitTypeDef NVIC_InitStructure;
+	NVIC_InitStructure.NVIC_IRQChannel = TIM3_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = PROFILE_PRIORITY;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+	
+	Profile_Clear();
+#endif
+}
+
+/**
+  * 函    数：开始采样
+  * 参    数：无
+  * 返 回 值：无
+  */
+void Profile_Start(void)
+{
+#ifdef PROFILE
+	TIM_Cmd(TIM3, ENABLE);
+#endif
+}
+
+/**
+  * 函    数：停止采样
+  * 参    数：无
+  * 返 回 值：无
+  */
+void Profile_Stop(void)
+{
+#ifdef PROFILE
+	TIM_Cmd(TIM3, DISABLE);
+#endif
+}
+
+/**
+  * 函    数：清空直方图
+  * 参    数：无
+  * 返 回 值：无
+  */
+void Profile_Clear(void)
+{
+#ifdef PROFILE
+	uint16_t i;
+	
+	for (i = 0; i < PROFILE_BUCKETS; i ++)
+	{
+		Profile_Hist[i] = 0;
+	}
+	Profile_Samples = 0;
+	Profile_Outside = 0;
+#endif
+}
+
+/**
+  * 函    数：输出直方图
+  * 参    数：Put 字符接收函数，如Serial_Put
+  * 参    数：Arg 字符接收函数的参数
+  * 返 回 值：无
+  * 说    明：第一行为"profile <起始地址> <区间位数> <采样总数> <范围外采样数>"，地址为十六进制
+  *           之后每行一个非零区间："<区间起始地址> <采样数>"，最后一行为"end"
+  *           将输出保存为文本文件，用Tools/profile_map.py与.axf文件一起处理
+  */
+void Profile_Dump(Format_PutFunc Put, void *Arg)
+{
+#ifdef PROFILE
+	uint16_t i;
+	
+	Format_Print(Put, Arg, "profile %08X %d %u %u\r\n", PROFILE_BASE, PROFILE_SHIFT, Profile_Samples, Profile_Outside);
+	for (i = 0; i < PROFILE_BUCKETS; i ++)
+	{
+		if (Profile_Hist[i])
+		{
+			Format_Print(Put, Arg, "%08X %u\r\n", PROFILE_BASE + ((uint32_t)i << PROFILE_SHIFT), Profile_Hist[i]);
+		}
+	}
+	Format_Print(Put, Arg, "end\r\n");
+#endif
+}
+
+/*********************功能函数*/
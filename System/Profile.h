@@ -0,0 +1,47 @@
+#ifndef __PROFILE_H
+#define __PROFILE_H
+
+#include <stdint.h>
+#include "Format.h"
+
+/**
+  * PC采样性能分析
+  * 定义PROFILE宏编译时，TIM3以固定频率中断，读取被打断处的PC（异常栈帧中保存的返回地址），
+  * 按地址区间累加到直方图中，运行一段时间后输出直方图，在电脑上用Tools/profile_map.py
+  * 按.axf的符号表映射到函数，得到各函数占用CPU时间的比例，不需要修改被分析的函数
+  * 未定义PROFILE时本模块的函数为空，不占用TIM3与RAM
+  */
+
+/*参数宏定义*********************/
+
+/*被采样的地址范围，只需覆盖代码段（Listings/Project.map中的Code大小），常量数据（字库等）不会被执行*/
+/*Profile_Dump输出的范围外采样数不为0时，说明代码超出了此范围，需增大PROFILE_SIZE*/
+#define PROFILE_BASE			0x08000000
+#define PROFILE_SIZE			0x00008000
+
+/*每个直方图区间的字节数为2的PROFILE_SHIFT次方，越小越精确，RAM占用为PROFILE_SIZE/2^PROFILE_SHIFT*2字节*/
+/*32字节的区间约为10~16条指令，与EPD_W_SCL等引脚函数的大小相当，一个区间跨越多个函数时由profile_map.py按重叠的字节数分摊*/
+#define PROFILE_SHIFT			5
+#define PROFILE_BUCKETS			(PROFILE_SIZE >> PROFILE_SHIFT)
+
+/*采样中断的抢占优先级，其他中断为1~3（按main中设置的优先级分组2），为0时可以打断并采样到其他中断中的代码*/
+/*抢占优先级相同的中断不能互相打断，与采样中断同为0的中断中的代码采样不到*/
+#define PROFILE_PRIORITY		0
+
+/*********************参数宏定义*/
+
+
+/*函数声明*********************/
+
+void Profile_Init(uint32_t Rate);
+void Profile_Start(void);
+void Profile_Stop(void);
+void Profile_Clear(void);
+void Profile_Dump(Format_PutFunc Put, void *Arg);
+
+/*仅供TIM3_IRQHandler调用*/
+void Profile_Sample(const uint32_t *Frame);
+
+/*********************函数声明*/
+
+#endif
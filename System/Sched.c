@@ -0,0 +1,287 @@
+#include "stm32f10x.h"
+#include "Sched.h"
+#include "Cycle.h"
+
+/*任务描述*********************/
+
+typedef struct
+{
+	const char *Name;					//名称，用于输出统计
+	Sched_TaskFunc Func;				//任务函数
+	uint8_t Priority;					//优先级，0为最高
+	volatile uint32_t Events;			//待处理的事件，可在中断中置位
+	uint32_t TimerEvents;				//定时器到期时投递的事件
+	Tick_Timer_t Timer;					//任务的定时器
+	Sched_Profile_t Profile;			//运行统计
+} Sched_Task_t;
+
+/*********************任务描述*/
+
+
+/*全局变量*********************/
+
+static Sched_Task_t Sched_Tasks[SCHED_MAX_TASKS];
+static uint8_t Sched_Num;
+
+/*上次运行的任务，同优先级的任务从它的下一个开始轮流运行*/
+static uint8_t Sched_Last;
+
+/*距离下一个定时器到期的毫秒数，由Tick_Process得到*/
+static uint32_t Sched_Next;
+
+/*空闲函数，为NULL时执行WFI*/
+static void (*Sched_Idle)(uint32_t Time);
+
+/*********************全局变量*/
+
+
+/*工具函数*********************/
+
+/*工具函数仅供内部部分函数使用*/
+
+/**
+  * 函    数：任务定时器到期的回调
+  * 参    数：Arg 任务
+  * 返 回 值：无
+  */
+static void Sched_OnTimer(void *Arg)
+{
+	Sched_Task_t *Task = Arg;
+	
+	Sched_Post(Task - Sched_Tasks, Task->TimerEvents);
+}
+
+/**
+  * 函    数：选出下一个要运行的任务
+  * 参    数：无
+  * 返 回 值：任务编号，没有待处理事件的任务时返回SCHED_INVALID
+  * 说    明：选优先级最高的就绪任务，同优先级时从上次运行的任务之后开始轮流选择
+  */
+static uint8_t Sched_Select(void)
+{
+	uint8_t i, k, Id = SCHED_INVALID;
+	
+	for (k = 1; k <= Sched_Num; k ++)
+	{
+		i = (Sched_Last + k) % Sched_Num;
+		if (Sched_Tasks[i].Events != 0
+			&& (Id == SCHED_INVALID || Sched_Tasks[i].Priority < Sched_Tasks[Id].Priority))
+		{
+			Id = i;
+		}
+	}
+	return Id;
+}
+
+/*********************工具函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：调度器初始化
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：启动时基与周期计数器，清空任务表
+  */
+void Sched_Init(void)
+{
+	Tick_Init();
+	Cycle_Init();
+	Sched_Num = 0;
+	Sched_Last = 0;
+	Sched_Next = TICK_NEVER;
+	Sched_Idle = 0;
+}
+
+/**
+  * 函    数：添加一个任务
+  * 参    数：Name 任务名称
+  * 参    数：Func 任务函数
+  * 参    数：Priority 优先级，范围：0~SCHED_PRIORITIES-1，0为最高
+  * 返 回 值：任务编号，任务已满时返回SCHED_INVALID
+  * 说    明：任务表为静态数组，不使用动态内存，任务添加后不能删除
+  */
+uint8_t Sched_Add(const char *Name, Sched_TaskFunc Func, uint8_t Priority)
+{
+	Sched_Task_t *Task;
+	
+	if (Sched_Num >= SCHED_MAX_TASKS) {return SCHED_INVALID;}
+	if (Priority >= SCHED_PRIORITIES) {Priority = SCHED_PRIORITIES - 1;}
+	
+	Task = &Sched_Tasks[Sched_Num];
+	Task->Name = Name;
+	Task->Func = Func;
+	Task->Priority = Priority;
+	Task->Events = 0;
+	Task->TimerEvents = 0;
+	Task->Timer.Active = 0;
+	Task->Profile.Count = 0;
+	Task->Profile.Max = 0;
+	Task->Profile.Total = 0;
+	return Sched_Num ++;
+}
+
+/**
+  * 函    数：向任务投递事件
+  * 参    数：Id 任务编号
+  * 参    数：Events 事件，按位或到任务的待处理事件中，同一事件在任务运行前多次投递只处理一次
+  * 返 回 值：无
+  * 说    明：可以在中断中调用，投递后任务在主循环中运行
+  */
+void Sched_Post(uint8_t Id, uint32_t Events)
+{
+	uint32_t Primask;
+	
+	if (Id >= Sched_Num) {return;}
+	
+	/*读改写期间关中断，防止与其他中断的投递冲突*/
+	Primask = __get_PRIMASK();
+	__disable_irq();
+	Sched_Tasks[Id].Events |= Events;
+	__set_PRIMASK(Primask);
+}
+
+/**
+  * 函    数：设置任务的定时器
+  * 参    数：Id 任务编号
+  * 参    数：Time 定时时间，单位ms
+  * 参    数：Mode 定时方式，范围：TICK_ONESHOT 单次定时
+  *                                 TICK_PERIODIC 周期定时
+  * 参    数：Events 定时到期时向任务投递的事件
+  * 返 回 值：无
+  * 说    明：每个任务有一个定时器，重新设置时覆盖上一次的设置，只能在主循环中调用
+  */
+void Sched_SetTimer(uint8_t Id, uint32_t Time, uint8_t Mode, uint32_t Events)
+{
+	if (Id >= Sched_Num) {return;}
+	Sched_Tasks[Id].TimerEvents = Events;
+	Tick_TimerStart(&Sched_Tasks[Id].Timer, Time, Mode, Sched_OnTimer, &Sched_Tasks[Id]);
+}
+
+/**
+  * 函    数：停止任务的定时器
+  * 参    数：Id 任务编号
+  * 返 回 值：无
+  */
+void Sched_StopTimer(uint8_t Id)
+{
+	if (Id >= Sched_Num) {return;}
+	Tick_TimerStop(&Sched_Tasks[Id].Timer);
+}
+
+/**
+  * 函    数：运行一个任务
+  * 参    数：无
+  * 返 回 值：1：运行了一个任务，0：没有待处理的事件
+  * 说    明：先处理到期的定时器，再运行优先级最高的就绪任务，并记录运行周期数
+  *           可以在自己的主循环中调用，代替Sched_Run
+  */
+uint8_t Sched_RunOnce(void)
+{
+	Sched_Task_t *Task;
+	uint32_t Events, Start, Cycles;
+	uint8_t Id;
+	
+	Sched_Next = Tick_Process();
+	
+	Id = Sched_Select();
+	if (Id == SCHED_INVALID) {return 0;}
+	Task = &Sched_Tasks[Id];
+	
+	/*取出并清除待处理的事件，运行期间新投递的事件留到下一次*/
+	__disable_irq();
+	Events = Task->Events;
+	Task->Events = 0;
+	__enable_irq();
+	
+	Start = CYCLE_GET();
+	Task->Func(Events);
+	Cycles = CYCLE_GET() - Start;
+	
+	Task->Profile.Count ++;
+	Task->Profile.Total += Cycles;
+	if (Cycles > Task->Profile.Max) {Task->Profile.Max = Cycles;}
+	
+	Sched_Last = Id;
+	return 1;
+}
+
+/**
+  * 函    数：设置空闲函数
+  * 参    数：Idle 空闲函数，参数为距离下一个定时器到期的毫秒数（没有定时器时为TICK_NEVER），
+  *                在关中断的状态下调用，被中断唤醒后返回，传入NULL时恢复为执行WFI
+  * 返 回 值：无
+  * 说    明：如传入Power_Idle，空闲时间较长时进入STOP模式
+  */
+void Sched_SetIdle(void (*Idle)(uint32_t Time))
+{
+	Sched_Idle = Idle;
+}
+
+/**
+  * 函    数：运行调度器
+  * 参    数：无
+  * 返 回 值：无，此函数不会返回
+  * 说    明：反复运行就绪的任务，没有就绪任务时调用空闲函数，默认执行WFI休眠，由任意中断（至少每1ms的SysTick）唤醒
+  *           休眠前关中断再检查一次，避免检查之后、休眠之前投递的事件要等到下一次中断才被处理
+  */
+void Sched_Run(void)
+{
+	while (1)
+	{
+		if (!Sched_RunOnce())
+		{
+			__disable_irq();
+			if (Sched_Select() == SCHED_INVALID)
+			{
+				/*关中断时WFI仍可被挂起的中断唤醒，开中断后立即进入中断*/
+				if (Sched_Idle) {Sched_Idle(Sched_Next);}
+				else {__WFI();}
+			}
+			__enable_irq();
+		}
+	}
+}
+
+/**
+  * 函    数：获取任务名称
+  * 参    数：Id 任务编号
+  * 返 回 值：任务名称，编号无效时返回NULL
+  */
+const char *Sched_GetName(uint8_t Id)
+{
+	if (Id >= Sched_Num) {return 0;}
+	return Sched_Tasks[Id].Name;
+}
+
+/**
+  * 函    数：获取任务运行统计
+  * 参    数：Id 任务编号
+  * 返 回 值：运行统计，编号无效时返回NULL
+  * 说    明：可在运行中随时查询，如周期性地通过串口输出全部任务的统计
+  */
+const Sched_Profile_t *Sched_GetProfile(uint8_t Id)
+{
+	if (Id >= Sched_Num) {return 0;}
+	return &Sched_Tasks[Id].Profile;
+}
+
+/**
+  * 函    数：清零全部任务的运行统计
+  * 参    数：无
+  * 返 回 值：无
+  */
+void Sched_ClearProfile(void)
+{
+	uint8_t i;
+	
+	for (i = 0; i < Sched_Num; i ++)
+	{
+		Sched_Tasks[i].Profile.Count = 0;
+		Sched_Tasks[i].Profile.Max = 0;
+		Sched_Tasks[i].Profile.Total = 0;
+	}
+}
+
+/*********************功能函数*/
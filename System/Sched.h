@@ -0,0 +1,59 @@
+#ifndef __SCHED_H
+#define __SCHED_H
+
+#include <stdint.h>
+#include "Tick.h"
+
+/*参数宏定义*********************/
+
+/*最多任务数*/
+#define SCHED_MAX_TASKS			8
+
+/*优先级数量，0为最高*/
+#define SCHED_PRIORITIES		4
+
+/*Sched_Add返回值，任务已满*/
+#define SCHED_INVALID			0xFF
+
+/*********************参数宏定义*/
+
+
+/*任务描述*********************/
+
+/**
+  * 任务函数，参数为本次运行前收到的全部事件，每个位表示一种事件，含义由任务自行定义
+  * 任务函数必须很快返回（运行到完成），不能在其中等待，需要等待时改用定时器或事件
+  * 一个任务等待期间其他任务都不能运行，优先级也不起作用，如EPD刷新应交给显示任务，不在任务中等待BUSY
+  */
+typedef void (*Sched_TaskFunc)(uint32_t Events);
+
+/**
+  * 任务运行统计，单位为内核周期，由DWT周期计数器测量
+  */
+typedef struct
+{
+	uint32_t Count;			//运行次数
+	uint32_t Max;			//单次运行的最长周期数
+	uint64_t Total;			//累计周期数，64位，72MHz下约8100年回绕
+} Sched_Profile_t;
+
+/*********************任务描述*/
+
+
+/*函数声明*********************/
+
+void Sched_Init(void);
+uint8_t Sched_Add(const char *Name, Sched_TaskFunc Func, uint8_t Priority);
+void Sched_Post(uint8_t Id, uint32_t Events);
+void Sched_SetTimer(uint8_t Id, uint32_t Time, uint8_t Mode, uint32_t Events);
+void Sched_StopTimer(uint8_t Id);
+uint8_t Sched_RunOnce(void);
+void Sched_SetIdle(void (*Idle)(uint32_t Time));
+void Sched_Run(void);
+const char *Sched_GetName(uint8_t Id);
+const Sched_Profile_t *Sched_GetProfile(uint8_t Id);
+void Sched_ClearProfile(void);
+
+/*********************函数声明*/
+
+#endif
@@ -0,0 +1,114 @@
+#include "stm32f10x.h"
+#include "Serial.h"
+#include "Format.h"
+
+/*硬件配置*********************/
+
+/**
+  * 函    数：串口初始化
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：使用USART1，TX为PA9，RX为PA10，8位数据，1位停止位，无校验
+  *           只使用发送功能，RX引脚配置为上拉输入备用
+  */
+void Serial_Init(void)
+{
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_USART1, ENABLE);
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA, ENABLE);
+	
+	GPIO_InitTypeDef GPIO_InitStructure;
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF_PP;
+	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_9;
+	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+	GPIO_Init(GPIOA, &GPIO_InitStructure);
+	
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;
+	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_10;
+	GPIO_Init(GPIOA, &GPIO_InitStructure);
+	
+	USART_InitTypeDef USART_InitStructure;
+	USART_InitStructure.USART_BaudRate = SERIAL_BAUDRATE;
+	USART_InitStructure.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
+	USART_InitStructure.USART_Mode = USART_Mode_Tx | USART_Mode_Rx;
+	USART_InitStructure.USART_Parity = USART_Parity_No;
+	USART_InitStructure.USART_StopBits = USART_StopBits_1;
+	USART_InitStructure.USART_WordLength = USART_WordLength_8b;
+	USART_Init(USART1, &USART_InitStructure);
+	
+	USART_Cmd(USART1, ENABLE);
+}
+
+/*********************硬件配置*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：串口发送一个字节
+  * 参    数：Byte 要发送的一个字节
+  * 返 回 值：无
+  * 说    明：等待发送数据寄存器空后写入，不等待发送完成
+  */
+void Serial_SendByte(uint8_t Byte)
+{
+	while (USART_GetFlagStatus(USART1, USART_FLAG_TXE) == RESET);
+	USART_SendData(USART1, Byte);
+}
+
+/**
+  * 函    数：串口发送一个数组
+  * 参    数：Array 要发送数组的首地址
+  * 参    数：Length 要发送数组的长度
+  * 返 回 值：无
+  */
+void Serial_SendArray(const uint8_t *Array, uint16_t Length)
+{
+	uint16_t i;
+	for (i = 0; i < Length; i ++)
+	{
+		Serial_SendByte(Array[i]);
+	}
+}
+
+/**
+  * 函    数：串口发送一个字符串
+  * 参    数：String 要发送字符串的首地址
+  * 返 回 值：无
+  */
+void Serial_SendString(const char *String)
+{
+	while (*String != '\0')
+	{
+		Serial_SendByte(*String);
+		String ++;
+	}
+}
+
+/**
+  * 函    数：串口字符接收函数
+  * 参    数：Char 要发送的字符
+  * 参    数：Arg 未使用
+  * 返 回 值：无
+  * 说    明：符合Format_PutFunc，可传给Format_Stream、Canvas_WritePBM等流式输出函数
+  */
+void Serial_Put(char Char, void *Arg)
+{
+	Serial_SendByte(Char);
+}
+
+/**
+  * 函    数：串口格式化发送
+  * 参    数：format 格式化字符串，支持的转换同Format_Stream
+  * 参    数：... 格式化字符串参数列表
+  * 返 回 值：无
+  * 说    明：边格式化边发送，不需要字符串缓冲区
+  */
+void Serial_Printf(const char *format, ...)
+{
+	va_list arg;
+	va_start(arg, format);
+	Format_Stream(Serial_Put, 0, format, arg);
+	va_end(arg);
+}
+
+/*********************功能函数*/
@@ -0,0 +1,25 @@
+#ifndef __SERIAL_H
+#define __SERIAL_H
+
+#include <stdint.h>
+
+/*参数宏定义*********************/
+
+/*波特率*/
+#define SERIAL_BAUDRATE			115200
+
+/*********************参数宏定义*/
+
+
+/*函数声明*********************/
+
+void Serial_Init(void);
+void Serial_SendByte(uint8_t Byte);
+void Serial_SendArray(const uint8_t *Array, uint16_t Length);
+void Serial_SendString(const char *String);
+void Serial_Put(char Char, void *Arg);
+void Serial_Printf(const char *format, ...);
+
+/*********************函数声明*/
+
+#endif
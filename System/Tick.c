@@ -0,0 +1,191 @@
+#include "stm32f10x.h"
+#include "Tick.h"
+
+/*全局变量*********************/
+
+/*上电后的毫秒数，由SysTick中断每1ms加1，约49.7天回绕一次*/
+static volatile uint32_t Tick_Ms;
+
+/*运行中的定时器链表，按到期时刻从早到晚排列*/
+static Tick_Timer_t *Tick_Head;
+
+/*********************全局变量*/
+
+
+/*工具函数*********************/
+
+/*工具函数仅供内部部分函数使用*/
+
+/**
+  * 函    数：将定时器按到期时刻插入链表
+  * 参    数：Timer 指定定时器，需已设置好Expire
+  * 返 回 值：无
+  * 说    明：到期时刻相同的定时器，后插入的排在后面
+  *           比较时刻时用差值的符号判断先后，毫秒计数回绕时仍然正确
+  */
+static void Tick_Insert(Tick_Timer_t *Timer)
+{
+	Tick_Timer_t **Link = &Tick_Head;
+	
+	while (*Link != 0 && (int32_t)((*Link)->Expire - Timer->Expire) <= 0)
+	{
+		Link = &(*Link)->Next;
+	}
+	Timer->Next = *Link;
+	*Link = Timer;
+	Timer->Active = 1;
+}
+
+/*********************工具函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：时基初始化
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：SysTick以HCLK为时钟，每1ms中断一次，中断优先级为最低
+  *           Delay函数在时基未启动时会自动调用此函数，一般不需要手动调用
+  */
+void Tick_Init(void)
+{
+	SysTick_Config(SystemCoreClock / 1000);
+}
+
+/**
+  * 函    数：时基中断处理
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：在SysTick_Handler中调用，只累加毫秒数，定时器回调在Tick_Process中执行
+  */
+void Tick_Handler(void)
+{
+	Tick_Ms ++;
+}
+
+/**
+  * 函    数：获取上电后的毫秒数
+  * 参    数：无
+  * 返 回 值：毫秒数，约49.7天回绕一次，计算时间差时直接相减即可
+  */
+uint32_t Tick_Millis(void)
+{
+	return Tick_Ms;
+}
+
+/**
+  * 函    数：获取上电后的微秒数
+  * 参    数：无
+  * 返 回 值：微秒数，约71.6分钟回绕一次，计算时间差时直接相减即可
+  * 说    明：由毫秒数与SysTick当前计数值组合得到，读取期间发生中断时重新读取
+  *           在关中断的代码中调用时，毫秒数不会增加，结果可能偏小1ms
+  */
+uint32_t Tick_Micros(void)
+{
+	uint32_t Ms, Value;
+	
+	do
+	{
+		Ms = Tick_Ms;
+		Value = SysTick->VAL;
+	} while (Ms != Tick_Ms);
+	
+	/*SysTick向下计数，已经过的计数值为LOAD - VAL*/
+	return Ms * 1000 + (SysTick->LOAD - Value) / (SystemCoreClock / 1000000);
+}
+
+/**
+  * 函    数：补加毫秒数
+  * 参    数：Ms 要补加的毫秒数
+  * 返 回 值：无
+  * 说    明：SysTick停止期间（如STOP模式）毫秒数不增加，唤醒后由低功耗管理调用此函数补上
+  */
+void Tick_Advance(uint32_t Ms)
+{
+	uint32_t Primask = __get_PRIMASK();
+	
+	__disable_irq();
+	Tick_Ms += Ms;
+	__set_PRIMASK(Primask);
+}
+
+/**
+  * 函    数：启动软件定时器
+  * 参    数：Timer 指定定时器，运行中的定时器会先停止再重新启动
+  * 参    数：Time 定时时间，单位ms，周期定时时同时为周期
+  * 参    数：Mode 定时方式，范围：TICK_ONESHOT 单次定时
+  *                                 TICK_PERIODIC 周期定时
+  * 参    数：Callback 到期时调用的函数
+  * 参    数：Arg 回调函数的参数
+  * 返 回 值：无
+  */
+void Tick_TimerStart(Tick_Timer_t *Timer, uint32_t Time, uint8_t Mode, void (*Callback)(void *Arg), void *Arg)
+{
+	Tick_TimerStop(Timer);
+	Timer->Expire = Tick_Ms + Time;
+	Timer->Period = (Mode == TICK_PERIODIC) ? Time : 0;
+	Timer->Callback = Callback;
+	Timer->Arg = Arg;
+	Tick_Insert(Timer);
+}
+
+/**
+  * 函    数：停止软件定时器
+  * 参    数：Timer 指定定时器，未运行时不做任何操作
+  * 返 回 值：无
+  */
+void Tick_TimerStop(Tick_Timer_t *Timer)
+{
+	Tick_Timer_t **Link = &Tick_Head;
+	
+	if (!Timer->Active) {return;}
+	while (*Link != 0)
+	{
+		if (*Link == Timer)
+		{
+			*Link = Timer->Next;
+			break;
+		}
+		Link = &(*Link)->Next;
+	}
+	Timer->Active = 0;
+}
+
+/**
+  * 函    数：处理到期的软件定时器
+  * 参    数：无
+  * 返 回 值：距离下一个定时器到期的毫秒数，没有运行中的定时器时返回TICK_NEVER
+  * 说    明：在主循环中反复调用，依次调用已到期定时器的回调函数
+  *           只需检查链表头部，没有到期的定时器时开销很小
+  *           周期定时器按上次的到期时刻累加周期，不随处理的延迟漂移
+  *           落后超过一个周期时（如主循环被长时间阻塞）从当前时刻重新计时，不连续补调
+  *           回调函数中可以启动或停止任何定时器，包括自身
+  */
+uint32_t Tick_Process(void)
+{
+	Tick_Timer_t *Timer;
+	uint32_t Now = Tick_Ms;
+	
+	while (Tick_Head != 0 && (int32_t)(Now - Tick_Head->Expire) >= 0)
+	{
+		/*从链表头部取下到期的定时器*/
+		Timer = Tick_Head;
+		Tick_Head = Timer->Next;
+		Timer->Active = 0;
+		
+		/*周期定时器先重新插入，回调函数中可以再停止它*/
+		if (Timer->Period)
+		{
+			Timer->Expire += Timer->Period;
+			if ((int32_t)(Now - Timer->Expire) >= 0) {Timer->Expire = Now + Timer->Period;}
+			Tick_Insert(Timer);
+		}
+		Timer->Callback(Timer->Arg);
+	}
+	
+	if (Tick_Head == 0) {return TICK_NEVER;}
+	return Tick_Head->Expire - Now;
+}
+
+/*********************功能函数*/
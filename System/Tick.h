@@ -0,0 +1,52 @@
+#ifndef __TICK_H
+#define __TICK_H
+
+#include <stdint.h>
+
+/*参数宏定义*********************/
+
+/*Mode参数取值*/
+#define TICK_ONESHOT			0		//单次定时
+#define TICK_PERIODIC			1		//周期定时
+
+/*Tick_Process返回值，没有运行中的定时器*/
+#define TICK_NEVER				0xFFFFFFFF
+
+/*********************参数宏定义*/
+
+
+/*软件定时器描述*********************/
+
+/**
+  * 软件定时器，由调用者定义（通常为静态变量），不使用动态内存
+  * 运行中的定时器按到期时间排成单链表，到期后在Tick_Process中调用回调函数，而不是在中断中调用
+  * 定时器的启动、停止与Tick_Process只能在主循环中调用，不能在中断中调用
+  */
+typedef struct Tick_Timer
+{
+	struct Tick_Timer *Next;			//链表中的下一个定时器
+	uint32_t Expire;					//到期时刻，单位ms
+	uint32_t Period;					//周期，单位ms，单次定时为0
+	void (*Callback)(void *Arg);		//到期时调用的函数
+	void *Arg;							//回调函数的参数
+	uint8_t Active;						//是否在运行中
+} Tick_Timer_t;
+
+/*********************软件定时器描述*/
+
+
+/*函数声明*********************/
+
+void Tick_Init(void);
+void Tick_Handler(void);
+uint32_t Tick_Millis(void);
+uint32_t Tick_Micros(void);
+void Tick_Advance(uint32_t Ms);
+
+void Tick_TimerStart(Tick_Timer_t *Timer, uint32_t Time, uint8_t Mode, void (*Callback)(void *Arg), void *Arg);
+void Tick_TimerStop(Tick_Timer_t *Timer);
+uint32_t Tick_Process(void);
+
+/*********************函数声明*/
+
+#endif
@@ -0,0 +1,84 @@
+#include "stm32f10x.h"
+#include "Trace.h"
+
+/*全局变量*********************/
+
+#ifdef TRACE
+
+Trace_Event_t Trace_Buf[TRACE_SIZE];
+
+/*已记录的事件总数，取低位作为写入位置，超过TRACE_SIZE后覆盖最早的事件*/
+volatile uint32_t Trace_Head;
+
+/*区间名称，下标为区间编号*/
+static const char *const Trace_Names[TRACE_ID_NUM] = {
+	"EPD_Update", "EPD_UpdateArea", "EPD_Setup", "EPD_Send",
+	"EPD_Busy", "EPD_ShowString", "EPD_ShowImage", "OLED_Update",
+};
+
+#endif
+
+/*********************全局变量*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：跟踪初始化
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：启动DWT周期计数器并清空缓冲区，未定义TRACE时不做任何操作
+  */
+void Trace_Init(void)
+{
+#ifdef TRACE
+	Cycle_Init();
+	Trace_Clear();
+#endif
+}
+
+/**
+  * 函    数：清空跟踪缓冲区
+  * 参    数：无
+  * 返 回 值：无
+  */
+void Trace_Clear(void)
+{
+#ifdef TRACE
+	Trace_Head = 0;
+#endif
+}
+
+/**
+  * 函    数：输出跟踪缓冲区
+  * 参    数：Put 字符接收函数，如Serial_Put
+  * 参    数：Arg 字符接收函数的参数
+  * 返 回 值：无
+  * 说    明：输出文本，第一行为"trace <时钟频率> <事件数> <丢失数>"，丢失数为被覆盖的最早事件数
+  *           之后每行一个事件，从早到晚排列："<周期计数> B|E <区间编号> <区间名称>"
+  *           周期计数约59.6秒回绕，电脑端按相邻事件差值展开即可
+  *           输出期间暂停记录不是必需的，但输出本身产生的事件会覆盖最早的事件
+  */
+void Trace_Dump(Format_PutFunc Put, void *Arg)
+{
+#ifdef TRACE
+	uint32_t Head = Trace_Head, Start, i;
+	const Trace_Event_t *Event;
+	uint16_t Id;
+	const char *Name;
+	
+	Start = (Head > TRACE_SIZE) ? Head - TRACE_SIZE : 0;
+	Format_Print(Put, Arg, "trace %u %u %u\r\n", SystemCoreClock, Head - Start, Start);
+	for (i = Start; i < Head; i ++)
+	{
+		Event = &Trace_Buf[i & (TRACE_SIZE - 1)];
+		Id = Event->Id & ~TRACE_END_FLAG;
+		Name = (Id < TRACE_ID_NUM && Trace_Names[Id]) ? Trace_Names[Id] : "user";
+		Format_Print(Put, Arg, "%u %c %u %s\r\n", Event->Time,
+					 (Event->Id & TRACE_END_FLAG) ? 'E' : 'B', Id, Name);
+	}
+	Format_Print(Put, Arg, "end\r\n");
+#endif
+}
+
+/*********************功能函数*/
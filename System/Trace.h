@@ -0,0 +1,81 @@
+#ifndef __TRACE_H
+#define __TRACE_H
+
+#include <stdint.h>
+#include "Format.h"
+#include "Cycle.h"
+
+/**
+  * 运行跟踪
+  * 定义TRACE宏编译时（Keil的Define栏或gcc的-DTRACE），TRACE_BEGIN/TRACE_END在代码区间的开始和结束处
+  * 记录DWT周期计数与事件编号，写入RAM环形缓冲区，每个事件只有几条指令
+  * 之后调用Trace_Dump通过串口等输出，在电脑上整理成时间线或火焰图
+  * 未定义TRACE时，宏展开为空，不产生任何代码与RAM占用
+  */
+
+/*参数宏定义*********************/
+
+/*环形缓冲区的事件数，必须为2的幂，每个事件占用8字节*/
+#define TRACE_SIZE				256
+
+/*结束事件的标志位，与区间编号按位或*/
+#define TRACE_END_FLAG			0x8000
+
+/*区间编号，增加时同时在Trace.c的Trace_Names中加入名称*/
+#define TRACE_EPD_UPDATE		0		//EPD_Update整体
+#define TRACE_EPD_AREA			1		//EPD_UpdateArea整体
+#define TRACE_EPD_SETUP			2		//设置RAM窗口
+#define TRACE_EPD_SEND			3		//发送显存数据
+#define TRACE_EPD_BUSY			4		//等待BUSY
+#define TRACE_EPD_STRING		5		//EPD_ShowString
+#define TRACE_EPD_IMAGE			6		//EPD_ShowImage
+#define TRACE_OLED_UPDATE		7		//OLED_Update
+#define TRACE_USER				8		//用户自定义区间的起始编号
+#define TRACE_ID_NUM			16		//区间编号数量
+
+/*********************参数宏定义*/
+
+
+/*记录宏*********************/
+
+#ifdef TRACE
+
+/*跟踪事件，Time为周期计数，Id为区间编号，结束事件带TRACE_END_FLAG*/
+typedef struct
+{
+	uint32_t Time;
+	uint32_t Id;
+} Trace_Event_t;
+
+extern Trace_Event_t Trace_Buf[TRACE_SIZE];
+extern volatile uint32_t Trace_Head;
+
+/*记录一个事件，中断与主循环同时记录时可能覆盖其中一条，不影响其他事件*/
+#define TRACE_EVENT(Event)		do { \
+									Trace_Event_t *Trace_p = &Trace_Buf[Trace_Head ++ & (TRACE_SIZE - 1)]; \
+									Trace_p->Time = CYCLE_GET(); \
+									Trace_p->Id = (Event); \
+								} while (0)
+
+#define TRACE_BEGIN(Id)			TRACE_EVENT(Id)
+#define TRACE_END(Id)			TRACE_EVENT((Id) | TRACE_END_FLAG)
+
+#else
+
+#define TRACE_BEGIN(Id)			((void)0)
+#define TRACE_END(Id)			((void)0)
+
+#endif
+
+/*********************记录宏*/
+
+
+/*函数声明*********************/
+
+void Trace_Init(void);
+void Trace_Clear(void);
+void Trace_Dump(Format_PutFunc Put, void *Arg);
+
+/*********************函数声明*/
+
+#endif
@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <string.h>
+#include "Test.h"
+#include "EPD.h"
+
+/**
+  * 汉字字模查找的主机性能测量
+  * 这个程序链接单独编译的一份EPD.c，其中的EPD_CF16x16、EPD_CF16x16_Num被替换为下面的Bench_CF16x16、
+  * Bench_CF16x16_Num（见Makefile），从而可以在50、500、5000个字模的表上测量EPD_GetChinese
+  * 与原EPD_ShowChinese中用strcmp从头遍历的写法对比，原写法的索引为uint8_t，超过255个字模时无法使用，这里改为uint16_t
+  * 耗时在电脑上测得，只能比较两种写法的相对快慢，不代表单片机上的速度
+  */
+
+/*与EPD_Data.h中的定义相同，这里的字模表在运行时生成，所以不使用其中的const声明*/
+typedef struct
+{
+	char Index[4];
+	uint8_t Data[32];
+} BenchCell_t;
+
+#define BENCH_MAX_GLYPHS		5000
+#define BENCH_QUERIES			4096
+
+BenchCell_t Bench_CF16x16[BENCH_MAX_GLYPHS + 1];
+uint16_t Bench_CF16x16_Num;
+
+/*查询的汉字，约1/8不在表中*/
+static char Bench_Query[BENCH_QUERIES][4];
+static uint16_t Bench_Expect[BENCH_QUERIES];
+
+/*码位转换为3字节UTF-8*/
+static void Bench_Utf8(char *String, uint32_t Code)
+{
+	String[0] = 0xE0 | (Code >> 12);
+	String[1] = 0x80 | ((Code >> 6) & 0x3F);
+	String[2] = 0x80 | (Code & 0x3F);
+	String[3] = '\0';
+}
+
+/*生成按码位升序排列的Num个字模，码位为0x4E00开始每隔3个取一个，每个字模的前两字节记录序号*/
+static void Bench_MakeTable(uint16_t Num)
+{
+	uint32_t Seed = 1;
+	uint16_t i, Index;
+
+	memset(Bench_CF16x16, 0, sizeof(Bench_CF16x16));
+	for (i = 0; i < Num; i ++)
+	{
+		Bench_Utf8(Bench_CF16x16[i].Index, 0x4E00 + i * 3);
+		Bench_CF16x16[i].Data[0] = i & 0xFF;
+		Bench_CF16x16[i].Data[1] = i >> 8;
+	}
+	Bench_CF16x16[Num].Data[0] = 0xFF;		//末尾的默认图形，索引为空字符串
+	Bench_CF16x16[Num].Data[1] = 0xFF;
+	Bench_CF16x16_Num = Num;
+
+	for (i = 0; i < BENCH_QUERIES; i ++)
+	{
+		Seed = Seed * 1103515245 + 12345;
+		Index = (Seed >> 16) % Num;
+		if ((Seed >> 8) % 8 == 0)
+		{
+			Bench_Utf8(Bench_Query[i], 0x4E00 + Index * 3 + 1);		//不在表中
+			Bench_Expect[i] = Num;
+		}
+		else
+		{
+			Bench_Utf8(Bench_Query[i], 0x4E00 + Index * 3);
+			Bench_Expect[i] = Index;
+		}
+	}
+}
+
+/*原EPD_ShowChinese中的查找：从头strcmp，直到末尾的空字符串*/
+static const uint8_t *Bench_Linear(const char *Chinese)
+{
+	uint16_t pIndex;
+
+	for (pIndex = 0; strcmp(Bench_CF16x16[pIndex].Index, "") != 0; pIndex ++)
+	{
+		if (strcmp(Bench_CF16x16[pIndex].Index, Chinese) == 0)
+		{
+			break;
+		}
+	}
+	return Bench_CF16x16[pIndex].Data;
+}
+
+/*每秒查找次数*/
+static double Bench_Rate(uint8_t Linear)
+{
+	const uint8_t *Data;
+	uint32_t Count = 0, i, Bad = 0;
+	uint8_t Length;
+	double Start = Test_Seconds(), Seconds;
+
+	do
+	{
+		for (i = 0; i < BENCH_QUERIES; i ++)
+		{
+			Data = Linear ? Bench_Linear(Bench_Query[i]) : EPD_GetChinese(Bench_Query[i], &Length);
+			if (Data != Bench_CF16x16[Bench_Expect[i]].Data) {Bad ++;}
+		}
+		Count += BENCH_QUERIES;
+		Seconds = Test_Seconds() - Start;
+	} while (Seconds < 0.2);
+
+	TEST_EQUAL(Bad, 0);
+	return Count / Seconds;
+}
+
+int main(void)
+{
+	static const uint16_t Sizes[] = {50, 500, 5000};
+	double Binary, Linear;
+	uint8_t i;
+
+	printf("  glyphs   EPD_GetChinese      strcmp scan   (host, lookups/s, 1/8 misses)\n");
+	for (i = 0; i < sizeof(Sizes) / sizeof(Sizes[0]); i ++)
+	{
+		Bench_MakeTable(Sizes[i]);
+		Binary = Bench_Rate(0);
+		Linear = Bench_Rate(1);
+		printf("  %6u %14.0f %16.0f   %.0fx\n", Sizes[i], Binary, Linear, Binary / Linear);
+	}
+	return Test_Result("Bench_Chinese");
+}
@@ -0,0 +1,83 @@
+#include <stdio.h>
+#include <string.h>
+#include "Test.h"
+#include "Dither.h"
+
+/**
+  * 抖动引擎的主机性能测量
+  * 一帧248*128的灰度图（横向渐变叠加伪随机噪声）逐行送入EPD显存，四种方式分别计时
+  * 同时检查整块均匀灰度抖动后的深色点比例与灰度接近，保证测量的是正确的输出
+  * Atkinson只扩散3/4的误差，中间灰度偏深是该算法本身的特点
+  * 耗时在电脑上测得，只能比较几种方式的相对快慢，不代表单片机上的速度
+  */
+
+extern uint8_t EPD_DisplayBuf[16][248];
+
+#define BENCH_WIDTH				248
+#define BENCH_HEIGHT			128
+
+static uint8_t Bench_Gray[BENCH_HEIGHT][BENCH_WIDTH];
+
+/*统计显存中置1的点数*/
+static uint32_t Bench_Ink(void)
+{
+	const uint8_t *Buf = EPD_DisplayBuf[0];
+	uint32_t Count = 0, i;
+	uint8_t Byte;
+
+	for (i = 0; i < sizeof(EPD_DisplayBuf); i ++)
+	{
+		for (Byte = Buf[i]; Byte; Byte &= Byte - 1) {Count ++;}
+	}
+	return Count;
+}
+
+int main(void)
+{
+	static const char *const Names[4] = {"Bayer4x4", "Bayer8x8", "Floyd", "Atkinson"};
+	uint32_t Seed = 1, Frames, Ink;
+	uint16_t X, Y;
+	uint8_t Mode;
+	double Start, Seconds;
+
+	/*均匀灰度64（约75%为深色）抖动后的深色点比例*/
+	printf("  flat gray 64 (75%% dark):");
+	memset(Bench_Gray, 64, sizeof(Bench_Gray));
+	for (Mode = DITHER_BAYER4; Mode <= DITHER_ATKINSON; Mode ++)
+	{
+		memset(EPD_DisplayBuf, 0, sizeof(EPD_DisplayBuf));
+		Dither_Image(&EPD_Canvas, 0, 0, BENCH_WIDTH, BENCH_HEIGHT, Bench_Gray[0], Mode);
+		Ink = Bench_Ink();
+		printf(" %s %.1f%%", Names[Mode], Ink * 100.0 / (BENCH_WIDTH * BENCH_HEIGHT));
+		TEST_ASSERT(Ink > BENCH_WIDTH * BENCH_HEIGHT * 70 / 100 && Ink < BENCH_WIDTH * BENCH_HEIGHT * 90 / 100);
+	}
+	printf("\n");
+
+	for (Y = 0; Y < BENCH_HEIGHT; Y ++)
+	{
+		for (X = 0; X < BENCH_WIDTH; X ++)
+		{
+			Seed = Seed * 1103515245 + 12345;
+			Bench_Gray[Y][X] = X * 255 / (BENCH_WIDTH - 1) / 2 + (Seed >> 25);
+		}
+	}
+
+	printf("  248x128 frame, rows fed one at a time with Dither_Row (host):\n");
+	for (Mode = DITHER_BAYER4; Mode <= DITHER_ATKINSON; Mode ++)
+	{
+		Frames = 0;
+		Start = Test_Seconds();
+		do
+		{
+			Dither_Begin(&EPD_Canvas, 0, 0, BENCH_WIDTH, Mode);
+			for (Y = 0; Y < BENCH_HEIGHT; Y ++) {Dither_Row(Bench_Gray[Y]);}
+			Frames ++;
+			Seconds = Test_Seconds() - Start;
+		} while (Seconds < 0.3);
+
+		printf("  %-9s %8.0f rows/ms %7.1f us/frame %6.2f ns/pixel\n", Names[Mode],
+			   Frames * BENCH_HEIGHT / Seconds / 1000, Seconds * 1e6 / Frames,
+			   Seconds * 1e9 / Frames / (BENCH_WIDTH * BENCH_HEIGHT));
+	}
+	return Test_Result("Bench_Dither");
+}
@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <math.h>
+#include "Test.h"
+#include "Format.h"
+#include "EPD.h"
+
+/**
+  * 定点数显示的主机性能测量
+  * 同一组数值分别用EPD_ShowFloatNum（double）、EPD_ShowFixedNum（Q16.16）、EPD_ShowScaledNum（缩放整数）显示，
+  * 并单独测量数值转换部分：原ShowFloatNum中的double运算与Format_Q16、Format_Scaled
+  * 电脑有硬件浮点单元，double运算在这里很快；STM32F103没有浮点单元，每次double运算都要调用软件浮点库，
+  * 所以这里的结果只说明整数写法本身的耗时，不能说明单片机上的差距
+  * 三个显示函数结果相同（包括四舍五入）的检查在Test_Format中
+  */
+
+#define BENCH_VALUES			4096
+
+static double Bench_Double[BENCH_VALUES];
+static int32_t Bench_Q16[BENCH_VALUES];
+static int32_t Bench_Scaled[BENCH_VALUES];
+
+static volatile uint32_t Bench_Sink;
+
+/*原ShowFloatNum中的数值转换部分，不含显示*/
+static void Bench_FloatParts(double Number, uint8_t FraLength, uint32_t *IntNum, uint32_t *FraNum)
+{
+	uint32_t PowNum;
+
+	if (Number < 0) {Number = -Number;}
+	*IntNum = Number;
+	Number -= *IntNum;
+	PowNum = 1;
+	while (FraLength --) {PowNum *= 10;}
+	*FraNum = round(Number * PowNum);
+	*IntNum += *FraNum / PowNum;
+}
+
+/*重复调用直到至少0.2秒，返回每次调用的ns*/
+static double Bench_Time(uint8_t Kind)
+{
+	char String[24];
+	uint32_t Count = 0, i, IntNum, FraNum;
+	double Start = Test_Seconds(), Seconds;
+
+	do
+	{
+		for (i = 0; i < BENCH_VALUES; i ++)
+		{
+			switch (Kind)
+			{
+				case 0: EPD_ShowFloatNum(0, 0, Bench_Double[i], 5, 2, EPD_8X16); break;
+				case 1: EPD_ShowFixedNum(0, 0, Bench_Q16[i], 5, 2, EPD_8X16); break;
+				case 2: EPD_ShowScaledNum(0, 0, Bench_Scaled[i], 2, 5, 2, EPD_8X16); break;
+				case 3: Bench_FloatParts(Bench_Double[i], 2, &IntNum, &FraNum); Bench_Sink = IntNum + FraNum; break;
+				case 4: Format_Q16(String, Bench_Q16[i], 5, 2); Bench_Sink = String[3]; break;
+				default: Format_Scaled(String, Bench_Scaled[i], 2, 5, 2); Bench_Sink = String[3]; break;
+			}
+		}
+		Count += BENCH_VALUES;
+		Seconds = Test_Seconds() - Start;
+	} while (Seconds < 0.2);
+	return Seconds * 1e9 / Count;
+}
+
+int main(void)
+{
+	static const char *const Names[6] = {
+		"EPD_ShowFloatNum", "EPD_ShowFixedNum", "EPD_ShowScaledNum",
+		"double arithmetic", "Format_Q16", "Format_Scaled",
+	};
+	uint32_t Seed = 1, i;
+	uint8_t Kind;
+
+	/*-999.99~999.99，精确到0.01，三种表示的数值相同*/
+	for (i = 0; i < BENCH_VALUES; i ++)
+	{
+		Seed = Seed * 1103515245 + 12345;
+		Bench_Scaled[i] = (int32_t)((Seed >> 8) % 199999) - 99999;
+		Bench_Double[i] = Bench_Scaled[i] / 100.0;
+		Bench_Q16[i] = Format_FloatToQ16((float)Bench_Double[i]);
+	}
+
+	printf("  %u values in -999.99~999.99, IntLength 5, FraLength 2 (host, ns/call):\n", BENCH_VALUES);
+	for (Kind = 0; Kind < 6; Kind ++)
+	{
+		printf("  %-18s %7.1f\n", Names[Kind], Bench_Time(Kind));
+	}
+	return Test_Result("Bench_Fixed");
+}
@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include "Test.h"
+#include "Format.h"
+#include "OLED.h"
+
+/**
+  * 格式化打印的主机性能测量
+  * 比较OLED_Printf（Format_Stream逐字符显示）与原OLED_Printf（vsprintf到256字节数组后再显示）的耗时与栈用量
+  * 栈用量的测法：先把一段栈空间填成固定图案，调用被测函数后检查被改写的深度，包括被测函数调用的全部函数
+  * 结果在电脑上用glibc的vsprintf测得，只说明两种写法的相对大小，不代表单片机上的耗时与栈用量
+  */
+
+extern uint8_t OLED_DisplayBuf[8][128];
+
+#define BENCH_STACK_SIZE		32768
+#define BENCH_PATTERN			0xA5
+
+static uintptr_t Bench_StackLow;
+static volatile uint32_t Bench_Sink;
+
+/*原OLED_Printf的写法*/
+static void Bench_OldPrintf(int16_t X, int16_t Y, uint8_t FontSize, char *format, ...)
+{
+	char String[256];
+	va_list arg;
+	va_start(arg, format);
+	vsprintf(String, format, arg);
+	va_end(arg);
+	OLED_ShowString(X, Y, String, FontSize);
+}
+
+/*两种写法打印同一行*/
+static void Bench_Old(uint32_t n)
+{
+	Bench_OldPrintf(0, 0, OLED_6X8, "T%05u %4d %X %s|", n, (int)(n % 2000) - 1000, n * 2654435761u, "ok");
+}
+
+static void Bench_New(uint32_t n)
+{
+	OLED_Printf(0, 0, OLED_6X8, "T%05u %4d %X %s|", n, (int)(n % 2000) - 1000, n * 2654435761u, "ok");
+}
+
+/*把调用者之下的一段栈空间填成固定图案，记录最低地址*/
+static void __attribute__((noinline)) Bench_Paint(void)
+{
+	volatile uint8_t Area[BENCH_STACK_SIZE];
+	uint32_t i;
+
+	for (i = 0; i < BENCH_STACK_SIZE; i ++) {Area[i] = BENCH_PATTERN;}
+	Bench_StackLow = (uintptr_t)Area;
+}
+
+/*从最低地址向上找到第一个被改写的字节，返回被改写的深度*/
+static uint32_t __attribute__((noinline)) Bench_Used(void)
+{
+	volatile uint8_t *Area = (volatile uint8_t *)Bench_StackLow;
+	uint32_t i;
+
+	for (i = 0; i < BENCH_STACK_SIZE && Area[i] == BENCH_PATTERN; i ++);
+	return BENCH_STACK_SIZE - i;
+}
+
+static uint32_t Bench_Stack(void (*Func)(uint32_t))
+{
+	Bench_Paint();
+	Func(12345);
+	return Bench_Used();
+}
+
+static double Bench_Time(void (*Func)(uint32_t))
+{
+	uint32_t Count = 0;
+	double Start = Test_Seconds(), Seconds;
+
+	do
+	{
+		Func(Count ++);
+		Seconds = Test_Seconds() - Start;
+	} while (Seconds < 0.2 || Count < 1000);
+	return Seconds * 1e9 / Count;
+}
+
+/*只格式化、不显示时的字符接收函数*/
+static void Bench_Count(char Char, void *Arg)
+{
+	(*(uint32_t *)Arg) += Char;
+}
+
+static void Bench_StreamOnly(uint32_t n)
+{
+	uint32_t Sum = 0;
+	Format_Print(Bench_Count, &Sum, "T%05u %4d %X %s|", n, (int)(n % 2000) - 1000, n * 2654435761u, "ok");
+	Bench_Sink = Sum;
+}
+
+static void Bench_SprintfOnly(uint32_t n)
+{
+	char String[256];
+	sprintf(String, "T%05u %4d %X %s|", n, (int)(n % 2000) - 1000, n * 2654435761u, "ok");
+	Bench_Sink = String[3];
+}
+
+static void __attribute__((noinline)) Bench_Nothing(uint32_t n)
+{
+	(void)n;
+}
+
+int main(void)
+{
+	static uint8_t Old[8][128];
+	static void (*const Funcs[4])(uint32_t) = {Bench_New, Bench_Old, Bench_StreamOnly, Bench_SprintfOnly};
+	static const char *const Names[4] = {
+		"OLED_Printf (Format_Stream)", "vsprintf + OLED_ShowString", "Format_Print only", "sprintf only",
+	};
+	uint32_t n, Bad = 0, Baseline, Stack;
+	double Time;
+	uint8_t i;
+
+	/*两种写法的显示结果相同*/
+	for (n = 0; n < 20000; n += 7)
+	{
+		memset(OLED_DisplayBuf, 0, sizeof(OLED_DisplayBuf));
+		Bench_Old(n);
+		memcpy(Old, OLED_DisplayBuf, sizeof(Old));
+		memset(OLED_DisplayBuf, 0, sizeof(OLED_DisplayBuf));
+		Bench_New(n);
+		if (memcmp(Old, OLED_DisplayBuf, sizeof(Old))) {Bad ++;}
+	}
+	TEST_EQUAL(Bad, 0);
+
+	/*空函数的深度只有调用本身的开销，作为基准扣除；每个函数先调用一次，排除动态链接首次解析符号的栈用量*/
+	Baseline = Bench_Stack(Bench_Nothing);
+	printf("  \"T%%05u %%4d %%X %%s|\" on OLED 6x8 (host):\n");
+	printf("  %-28s %8s %10s\n", "", "ns/call", "stack");
+	for (i = 0; i < 4; i ++)
+	{
+		Funcs[i](0);
+		Stack = Bench_Stack(Funcs[i]) - Baseline;
+		Time = Bench_Time(Funcs[i]);
+		printf("  %-28s %8.1f %7u B\n", Names[i], Time, Stack);
+	}
+	return Test_Result("Bench_Printf");
+}
@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <string.h>
+#include "Test.h"
+#include "EPD.h"
+#include "EPD_Data.h"
+#include "Canvas.h"
+
+/**
+  * 放大字符的主机性能测量
+  * 在EPD上显示一行4倍放大的8*16数字（7个字符，每个32*64），与逐点放大画点的写法比较耗时，并检查两者结果相同
+  * 分别测量Y按页对齐与不对齐的情况，不对齐时每列跨越的页数多一页
+  * 耗时在电脑上测得，只能比较两种写法的相对快慢，不代表单片机上的速度
+  */
+
+extern uint8_t EPD_DisplayBuf[16][248];
+
+#define BENCH_TEXT				"1234567"
+
+/*逐点放大：读出字模的每个点，画Zoom*Zoom个点*/
+static void Bench_PerPixel(int16_t X, int16_t Y, const char *String, uint8_t Zoom)
+{
+	const uint8_t *Glyph;
+	uint8_t Col, Row, dx, dy, Point;
+
+	for (; *String; String ++, X += 8 * Zoom)
+	{
+		Glyph = EPD_F8x16[*String - ' '];
+		for (Row = 0; Row < 16; Row ++)
+		{
+			for (Col = 0; Col < 8; Col ++)
+			{
+				Point = (Glyph[Row / 8 * 8 + Col] >> (Row % 8)) & 0x01;
+				for (dy = 0; dy < Zoom; dy ++)
+				{
+					for (dx = 0; dx < Zoom; dx ++)
+					{
+						Canvas_DrawPoint(&EPD_Canvas, X + Col * Zoom + dx, Y + Row * Zoom + dy, Point);
+					}
+				}
+			}
+		}
+	}
+}
+
+static double Bench_Time(uint8_t PerPixel, int16_t Y, uint8_t Zoom)
+{
+	uint32_t Count = 0;
+	double Start = Test_Seconds(), Seconds;
+
+	do
+	{
+		if (PerPixel) {Bench_PerPixel(0, Y, BENCH_TEXT, Zoom);}
+		else {EPD_ShowZoomString(0, Y, BENCH_TEXT, EPD_8X16, Zoom);}
+		Count ++;
+		Seconds = Test_Seconds() - Start;
+	} while (Seconds < 0.2);
+	return Seconds * 1e6 / Count;
+}
+
+int main(void)
+{
+	static const int16_t Ys[2] = {32, 35};
+	static uint8_t Zoomed[16][248];
+	double Fast, Slow;
+	uint8_t i, Zoom;
+
+	/*与逐点放大的结果相同，1倍时与EPD_ShowString相同*/
+	for (Zoom = 1; Zoom <= 4; Zoom ++)
+	{
+		for (i = 0; i < 2; i ++)
+		{
+			memset(EPD_DisplayBuf, 0x5A, sizeof(EPD_DisplayBuf));
+			EPD_ShowZoomString(0, Ys[i], BENCH_TEXT, EPD_8X16, Zoom);
+			memcpy(Zoomed, EPD_DisplayBuf, sizeof(Zoomed));
+			memset(EPD_DisplayBuf, 0x5A, sizeof(EPD_DisplayBuf));
+			Bench_PerPixel(0, Ys[i], BENCH_TEXT, Zoom);
+			TEST_ASSERT(memcmp(Zoomed, EPD_DisplayBuf, sizeof(Zoomed)) == 0);
+		}
+	}
+	memset(EPD_DisplayBuf, 0x5A, sizeof(EPD_DisplayBuf));
+	EPD_ShowString(0, 35, BENCH_TEXT, EPD_8X16);
+	memcpy(Zoomed, EPD_DisplayBuf, sizeof(Zoomed));
+	memset(EPD_DisplayBuf, 0x5A, sizeof(EPD_DisplayBuf));
+	Bench_PerPixel(0, 35, BENCH_TEXT, 1);
+	TEST_ASSERT(memcmp(Zoomed, EPD_DisplayBuf, sizeof(Zoomed)) == 0);
+
+	printf("  \"%s\" in 8x16 at 1x~4x on EPD (host, us/line):\n", BENCH_TEXT);
+	printf("  zoom   Y   EPD_ShowZoomString   per-pixel   lines/s\n");
+	for (Zoom = 1; Zoom <= 4; Zoom ++)
+	{
+		for (i = 0; i < 2; i ++)
+		{
+			Fast = Bench_Time(0, Ys[i], Zoom);
+			Slow = Bench_Time(1, Ys[i], Zoom);
+			printf("  %3ux  %3d %16.2f %13.2f %9.0f   %.0fx\n", Zoom, Ys[i], Fast, Slow, 1e6 / Fast, Slow / Fast);
+		}
+	}
+	return Test_Result("Bench_Zoom");
+}
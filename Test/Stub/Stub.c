@@ -0,0 +1,86 @@
+#include "stm32f10x.h"
+#include "Delay.h"
+#include "EPD_Sim.h"
+
+/*全局变量*********************/
+
+/*GPIO端口，输入与输出均为低，即EPD的BUSY空闲，测试可改写IDR模拟其他输入*/
+GPIO_TypeDef Stub_GPIOA = {0x0000, 0x0000};
+GPIO_TypeDef Stub_GPIOB = {0x0000, 0x0000};
+
+/*延时的累计时间，单位us，延时函数不实际等待，测试可以读取它估算耗时*/
+uint32_t Stub_DelayUs;
+
+/*********************全局变量*/
+
+
+/*工具函数*********************/
+
+/*延时计入累计时间，并使EPD控制器模拟的时钟前进相同的时间*/
+static void Stub_Delay(uint32_t Us)
+{
+	Stub_DelayUs += Us;
+#ifdef EPD_SIM
+	EPD_Sim_Delay(Us);
+#endif
+}
+
+/*********************工具函数*/
+
+
+/*GPIO*********************/
+
+void GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_InitStruct)
+{
+	(void)GPIOx;
+	(void)GPIO_InitStruct;
+}
+
+uint8_t GPIO_ReadInputDataBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+	return (GPIOx->IDR & GPIO_Pin) ? 1 : 0;
+}
+
+void GPIO_SetBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+	GPIOx->ODR |= GPIO_Pin;
+}
+
+void GPIO_ResetBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+	GPIOx->ODR &= ~GPIO_Pin;
+}
+
+void GPIO_WriteBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, BitAction BitVal)
+{
+	if (BitVal) {GPIOx->ODR |= GPIO_Pin;}
+	else {GPIOx->ODR &= ~GPIO_Pin;}
+}
+
+void RCC_APB2PeriphClockCmd(uint32_t RCC_APB2Periph, FunctionalState NewState)
+{
+	(void)RCC_APB2Periph;
+	(void)NewState;
+}
+
+/*********************GPIO*/
+
+
+/*延时*********************/
+
+void Delay_us(uint32_t xus)
+{
+	Stub_Delay(xus);
+}
+
+void Delay_ms(uint32_t xms)
+{
+	Stub_Delay(xms * 1000);
+}
+
+void Delay_s(uint32_t xs)
+{
+	Stub_Delay(xs * 1000000);
+}
+
+/*********************延时*/
@@ -0,0 +1,97 @@
+#ifndef __STM32F10x_H
+#define __STM32F10x_H
+
+#include <stdint.h>
+
+/**
+  * 主机测试用的器件头文件替身
+  * 只提供显示驱动（EPD.c、OLED.c）用到的类型、宏与库函数声明，函数由Stub.c实现
+  * GPIO端口是普通的全局变量，测试可以读写其中的输出/输入电平
+  * 仅在Test目录的主机编译中使用，Keil工程仍使用Start中的stm32f10x.h
+  */
+
+/*类型定义*********************/
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {Bit_RESET = 0, Bit_SET} BitAction;
+
+typedef enum
+{
+	GPIO_Speed_10MHz = 1,
+	GPIO_Speed_2MHz,
+	GPIO_Speed_50MHz
+} GPIOSpeed_TypeDef;
+
+typedef enum
+{
+	GPIO_Mode_AIN = 0x0,
+	GPIO_Mode_IN_FLOATING = 0x04,
+	GPIO_Mode_IPD = 0x28,
+	GPIO_Mode_IPU = 0x48,
+	GPIO_Mode_Out_OD = 0x14,
+	GPIO_Mode_Out_PP = 0x10,
+	GPIO_Mode_AF_OD = 0x1C,
+	GPIO_Mode_AF_PP = 0x18
+} GPIOMode_TypeDef;
+
+typedef struct
+{
+	uint16_t GPIO_Pin;
+	GPIOSpeed_TypeDef GPIO_Speed;
+	GPIOMode_TypeDef GPIO_Mode;
+} GPIO_InitTypeDef;
+
+/*GPIO端口，只保留输入与输出数据寄存器*/
+typedef struct
+{
+	uint16_t IDR;
+	uint16_t ODR;
+} GPIO_TypeDef;
+
+/*********************类型定义*/
+
+
+/*宏定义*********************/
+
+extern GPIO_TypeDef Stub_GPIOA, Stub_GPIOB;
+
+#define GPIOA					(&Stub_GPIOA)
+#define GPIOB					(&Stub_GPIOB)
+
+#define GPIO_Pin_0				((uint16_t)0x0001)
+#define GPIO_Pin_1				((uint16_t)0x0002)
+#define GPIO_Pin_2				((uint16_t)0x0004)
+#define GPIO_Pin_3				((uint16_t)0x0008)
+#define GPIO_Pin_4				((uint16_t)0x0010)
+#define GPIO_Pin_5				((uint16_t)0x0020)
+#define GPIO_Pin_6				((uint16_t)0x0040)
+#define GPIO_Pin_7				((uint16_t)0x0080)
+#define GPIO_Pin_8				((uint16_t)0x0100)
+#define GPIO_Pin_9				((uint16_t)0x0200)
+#define GPIO_Pin_10				((uint16_t)0x0400)
+#define GPIO_Pin_11				((uint16_t)0x0800)
+#define GPIO_Pin_12				((uint16_t)0x1000)
+#define GPIO_Pin_13				((uint16_t)0x2000)
+#define GPIO_Pin_14				((uint16_t)0x4000)
+#define GPIO_Pin_15				((uint16_t)0x8000)
+#define GPIO_Pin_All			((uint16_t)0xFFFF)
+
+#define RCC_APB2Periph_GPIOA	((uint32_t)0x00000004)
+#define RCC_APB2Periph_GPIOB	((uint32_t)0x00000008)
+
+/*********************宏定义*/
+
+
+/*函数声明*********************/
+
+void GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_InitStruct);
+uint8_t GPIO_ReadInputDataBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+void GPIO_SetBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+void GPIO_ResetBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+void GPIO_WriteBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, BitAction BitVal);
+void RCC_APB2PeriphClockCmd(uint32_t RCC_APB2Periph, FunctionalState NewState);
+
+/*********************函数声明*/
+
+#endif
@@ -0,0 +1,152 @@
+#define _POSIX_C_SOURCE 199309L
+#include "Test.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*全局变量*********************/
+
+static uint32_t Test_Failures;
+
+/*********************全局变量*/
+
+
+/*工具函数*********************/
+
+/*PBM文件的最大字节数，按248*128的EPD画布加文件头留出余量*/
+#define TEST_PBM_SIZE			8192
+
+typedef struct
+{
+	uint8_t Data[TEST_PBM_SIZE];
+	uint32_t Length;
+} Test_Buffer_t;
+
+static void Test_Put(char Char, void *Arg)
+{
+	Test_Buffer_t *Buffer = Arg;
+	if (Buffer->Length < TEST_PBM_SIZE) {Buffer->Data[Buffer->Length] = (uint8_t)Char;}
+	Buffer->Length ++;
+}
+
+static void Test_WriteFile(const char *Path, const Test_Buffer_t *Buffer)
+{
+	FILE *File = fopen(Path, "wb");
+	if (File == NULL) {printf("  cannot write %s\n", Path); return;}
+	fwrite(Buffer->Data, 1, Buffer->Length, File);
+	fclose(File);
+}
+
+/*********************工具函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：记录一次失败的检查
+  * 参    数：File Line 检查所在的文件与行号
+  * 参    数：Expr 检查的表达式
+  * 返 回 值：无
+  */
+void Test_Fail(const char *File, int Line, const char *Expr)
+{
+	Test_Failures ++;
+	printf("  FAIL %s:%d: %s\n", File, Line, Expr);
+}
+
+/**
+  * 函    数：记录一次失败的相等检查，同时输出两边的值
+  * 参    数：File Line 检查所在的文件与行号
+  * 参    数：ExprA ExprB 两边的表达式
+  * 参    数：A B 两边的值
+  * 返 回 值：无
+  */
+void Test_FailEqual(const char *File, int Line, const char *ExprA, const char *ExprB, long long A, long long B)
+{
+	Test_Failures ++;
+	printf("  FAIL %s:%d: %s == %s (%lld != %lld)\n", File, Line, ExprA, ExprB, A, B);
+}
+
+/**
+  * 函    数：画布与Golden图像比较
+  * 参    数：Canvas 指定画布
+  * 参    数：Name 图像名，对应Golden/<Name>.pbm
+  * 返 回 值：不同的字节数，0表示一致，Golden文件不存在时返回PBM的总字节数
+  * 说    明：不一致时实际图像写到Build/<Name>.pbm，并计为一次失败
+  *           环境变量TEST_UPDATE非空时改为写入Golden/<Name>.pbm，不计失败
+  */
+uint32_t Test_Golden(const Canvas_t *Canvas, const char *Name)
+{
+	static Test_Buffer_t Actual, Golden;
+	char Path[128];
+	FILE *File;
+	uint32_t i, Diff = 0;
+
+	Actual.Length = 0;
+	Canvas_WritePBM(Canvas, Test_Put, &Actual);
+
+	if (getenv("TEST_UPDATE") && getenv("TEST_UPDATE")[0])
+	{
+		snprintf(Path, sizeof(Path), "Golden/%s.pbm", Name);
+		Test_WriteFile(Path, &Actual);
+		printf("  updated %s\n", Path);
+		return 0;
+	}
+
+	snprintf(Path, sizeof(Path), "Golden/%s.pbm", Name);
+	File = fopen(Path, "rb");
+	Golden.Length = 0;
+	if (File)
+	{
+		Golden.Length = fread(Golden.Data, 1, TEST_PBM_SIZE, File);
+		fclose(File);
+	}
+
+	if (Golden.Length != Actual.Length) {Diff = Actual.Length;}
+	else
+	{
+		for (i = 0; i < Actual.Length; i ++)
+		{
+			if (Golden.Data[i] != Actual.Data[i]) {Diff ++;}
+		}
+	}
+
+	if (Diff)
+	{
+		Test_Failures ++;
+		snprintf(Path, sizeof(Path), "Build/%s.pbm", Name);
+		Test_WriteFile(Path, &Actual);
+		printf("  FAIL golden %s: %u bytes differ, actual image in %s\n", Name, Diff, Path);
+	}
+	return Diff;
+}
+
+/**
+  * 函    数：读取单调时钟
+  * 参    数：无
+  * 返 回 值：秒数，用于基准测试计时
+  */
+double Test_Seconds(void)
+{
+	struct timespec Time;
+	clock_gettime(CLOCK_MONOTONIC, &Time);
+	return Time.tv_sec + Time.tv_nsec * 1e-9;
+}
+
+/**
+  * 函    数：输出测试结果
+  * 参    数：Name 测试程序名
+  * 返 回 值：程序的退出码，0表示全部通过
+  */
+int Test_Result(const char *Name)
+{
+	if (Test_Failures)
+	{
+		printf("%s: %u failure(s)\n", Name, Test_Failures);
+		return 1;
+	}
+	printf("%s: ok\n", Name);
+	return 0;
+}
+
+/*********************功能函数*/
@@ -0,0 +1,39 @@
+#ifndef __TEST_H
+#define __TEST_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "Canvas.h"
+
+/**
+  * 主机测试的公共部分
+  * 每个Test_*.c编译为一个独立的程序，用TEST_ASSERT等宏检查结果，main最后返回Test_Result()
+  * 图像与Golden目录中的PBM文件逐字节比较，不一致时把实际图像写到Build目录便于查看
+  * 运行时设置环境变量TEST_UPDATE=1（make golden）则用实际图像覆盖Golden文件
+  */
+
+/*检查宏*********************/
+
+#define TEST_ASSERT(Cond)		do { \
+									if (!(Cond)) {Test_Fail(__FILE__, __LINE__, #Cond);} \
+								} while (0)
+
+#define TEST_EQUAL(A, B)		do { \
+									long long Test_a = (long long)(A), Test_b = (long long)(B); \
+									if (Test_a != Test_b) {Test_FailEqual(__FILE__, __LINE__, #A, #B, Test_a, Test_b);} \
+								} while (0)
+
+/*********************检查宏*/
+
+
+/*函数声明*********************/
+
+void Test_Fail(const char *File, int Line, const char *Expr);
+void Test_FailEqual(const char *File, int Line, const char *ExprA, const char *ExprB, long long A, long long B);
+uint32_t Test_Golden(const Canvas_t *Canvas, const char *Name);
+double Test_Seconds(void);
+int Test_Result(const char *Name);
+
+/*********************函数声明*/
+
+#endif
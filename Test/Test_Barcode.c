@@ -0,0 +1,327 @@
+#include <stdio.h>
+#include <string.h>
+#include "Test.h"
+#include "Barcode.h"
+
+/**
+  * 条码的绘制与解码测试
+  * 条码画在一块足够宽的画布上，取中间一行按条空宽度解码，与输入的内容比较
+  * 解码按标准的条空宽度表独立实现，不使用Barcode.c中的编码表
+  * 同时检查条码每一列上下一致、不写到条码区域之外，以及Barcode_Measure与Barcode_Draw的宽度一致
+  */
+
+/*测试画布，宽度足够放下最长的测试条码*/
+#define TEST_WIDTH				4096
+#define TEST_HEIGHT				64
+#define TEST_X					5
+#define TEST_Y					3
+#define TEST_BAR_HEIGHT			37
+
+static uint8_t Test_Buf[TEST_HEIGHT / 8][TEST_WIDTH];
+static const Canvas_t Test_Canvas = {Test_Buf[0], TEST_WIDTH, TEST_HEIGHT, 0};
+
+/*背景图案，用于检查条码区域外没有被改写*/
+#define TEST_BACKGROUND			0xA5
+
+/*Code128的107个符号，每个为3条3空的模块宽度，最后一个为终止符（多一条）*/
+static const char *const Test_Code128[107] = {
+	"212222", "222122", "222221", "121223", "121322", "131222", "122213", "122312", "132212", "221213",
+	"221312", "231212", "112232", "122132", "122231", "113222", "123122", "123221", "223211", "221132",
+	"221231", "213212", "223112", "312131", "311222", "321122", "321221", "312212", "322112", "322211",
+	"212123", "212321", "232121", "111323", "131123", "131321", "112313", "132113", "132311", "211313",
+	"231113", "231311", "112133", "112331", "132131", "113123", "113321", "133121", "313121", "211331",
+	"231131", "213113", "213311", "213131", "311123", "311321", "331121", "312113", "312311", "332111",
+	"314111", "221411", "431111", "111224", "111422", "121124", "121421", "141122", "141221", "112214",
+	"112412", "122114", "122411", "142112", "142211", "241211", "221114", "413111", "241112", "134111",
+	"111242", "121142", "121241", "114212", "124112", "124211", "411212", "421112", "421211", "212141",
+	"214121", "412121", "111143", "111341", "131141", "114113", "114311", "411113", "411311", "113141",
+	"114131", "311141", "411131", "211412", "211214", "211232", "2331112",
+};
+
+/*EAN-13左侧L编码（G编码为其反序）与右侧R编码（与L的条空宽度相同）*/
+static const char *const Test_EanL[10] = {
+	"3211", "2221", "2122", "1411", "1132", "1231", "1114", "1312", "1213", "3112",
+};
+
+/*EAN-13首位数字决定左侧6位的L/G组合*/
+static const char *const Test_EanParity[10] = {
+	"LLLLLL", "LLGLGG", "LLGGLG", "LLGGGL", "LGLLGG", "LGGLLG", "LGGGLL", "LGLGLG", "LGLGGL", "LGGLGL",
+};
+
+/*扫描得到的条空宽度，单位为模块*/
+static uint8_t Test_Runs[TEST_WIDTH];
+static uint16_t Test_RunCount;
+static uint16_t Test_Quiet[2];
+
+/*解码成功的条码数*/
+static uint32_t Test_Decoded[2];
+
+/**
+  * 扫描一行，得到两侧空白区与中间条空的模块宽度
+  * 返回0表示宽度不是模块的整数倍或两端不是空白
+  */
+static uint8_t Test_Scan(int16_t Y, uint16_t Width, uint8_t Module)
+{
+	uint16_t X, Run = 0, Count = 0;
+	uint8_t Color = Canvas_GetPoint(&Test_Canvas, TEST_X, Y);
+	static uint16_t Runs[TEST_WIDTH];
+
+	if (Color) {return 0;}
+	for (X = 0; X <= Width; X ++)
+	{
+		if (X < Width && Canvas_GetPoint(&Test_Canvas, TEST_X + X, Y) == Color) {Run ++; continue;}
+		if (Run % Module) {return 0;}
+		Runs[Count ++] = Run / Module;
+		Color = !Color;
+		Run = 1;
+	}
+	if (Count < 3 || Count % 2 == 0) {return 0;}		//空白、条、空……条、空白
+
+	Test_Quiet[0] = Runs[0];
+	Test_Quiet[1] = Runs[Count - 1];
+	Test_RunCount = Count - 2;
+	for (X = 0; X < Test_RunCount; X ++) {Test_Runs[X] = Runs[X + 1];}
+	return 1;
+}
+
+/*把n个条空宽度拼成字符串，用于查表*/
+static void Test_Pattern(char *Pattern, uint16_t Start, uint8_t n)
+{
+	uint8_t i;
+	for (i = 0; i < n; i ++) {Pattern[i] = '0' + Test_Runs[Start + i];}
+	Pattern[n] = '\0';
+}
+
+/**
+  * 解码Code128，返回解码的字符数，失败时返回-1
+  */
+static int Test_DecodeCode128(char *Out)
+{
+	char Pattern[8];
+	uint8_t Values[256], Set;
+	uint16_t Count = 0, i, j;
+	uint32_t Sum;
+	int Length = 0;
+
+	if (Test_Quiet[0] < 10 || Test_Quiet[1] < 10) {return -1;}
+	if (Test_RunCount < 6 + 6 + 7 || (Test_RunCount - 7) % 6) {return -1;}
+
+	for (i = 0; i + 7 < Test_RunCount; i += 6)
+	{
+		Test_Pattern(Pattern, i, 6);
+		for (j = 0; j < 106; j ++) {if (strcmp(Pattern, Test_Code128[j]) == 0) {break;}}
+		if (j == 106) {return -1;}
+		Values[Count ++] = j;
+	}
+	Test_Pattern(Pattern, i, 7);
+	if (strcmp(Pattern, Test_Code128[106])) {return -1;}
+
+	/*起始符与校验符*/
+	if (Values[0] < 103 || Values[0] > 105) {return -1;}
+	Sum = Values[0];
+	for (i = 1; i + 1 < Count; i ++) {Sum += Values[i] * i;}
+	if (Sum % 103 != Values[Count - 1]) {return -1;}
+
+	Set = Values[0] - 103;			//0：A，1：B，2：C
+	for (i = 1; i + 1 < Count; i ++)
+	{
+		uint8_t v = Values[i];
+		if (Set == 2)
+		{
+			if (v < 100) {Out[Length ++] = '0' + v / 10; Out[Length ++] = '0' + v % 10;}
+			else if (v == 100) {Set = 1;}
+			else if (v == 101) {Set = 0;}
+			else {return -1;}
+		}
+		else
+		{
+			if (v == 99) {Set = 2;}
+			else if (v == 100 && Set == 0) {Set = 1;}
+			else if (v == 101 && Set == 1) {Set = 0;}
+			else if (v >= 96) {return -1;}				//FNC与SHIFT不会由编码器生成
+			else if (Set == 1) {Out[Length ++] = v + 32;}
+			else {Out[Length ++] = (v < 64) ? v + 32 : v - 64;}
+		}
+	}
+	Out[Length] = '\0';
+	return Length;
+}
+
+/**
+  * 解码EAN-13，返回1表示成功，Out为13位数字
+  */
+static uint8_t Test_DecodeEan13(char *Out)
+{
+	char Pattern[5], Reverse[5], Parity[7];
+	uint8_t Digit[13], i, j, Sum = 0;
+
+	if (Test_Quiet[0] < 11 || Test_Quiet[1] < 7 || Test_RunCount != 59) {return 0;}
+	for (i = 0; i < 3; i ++) {if (Test_Runs[i] != 1 || Test_Runs[56 + i] != 1) {return 0;}}
+	for (i = 27; i < 32; i ++) {if (Test_Runs[i] != 1) {return 0;}}
+
+	for (i = 0; i < 12; i ++)
+	{
+		Test_Pattern(Pattern, i < 6 ? 3 + 4 * i : 32 + 4 * (i - 6), 4);
+		for (j = 0; j < 4; j ++) {Reverse[j] = Pattern[3 - j];}
+		Reverse[4] = '\0';
+		for (j = 0; j < 10; j ++)
+		{
+			if (strcmp(Pattern, Test_EanL[j]) == 0) {if (i < 6) {Parity[i] = 'L';} break;}
+			if (i < 6 && strcmp(Reverse, Test_EanL[j]) == 0) {Parity[i] = 'G'; break;}
+		}
+		if (j == 10) {return 0;}
+		Digit[i + 1] = j;
+	}
+	Parity[6] = '\0';
+	for (j = 0; j < 10; j ++) {if (strcmp(Parity, Test_EanParity[j]) == 0) {break;}}
+	if (j == 10) {return 0;}
+	Digit[0] = j;
+
+	for (i = 0; i < 13; i ++)
+	{
+		Sum += Digit[i] * ((i % 2) ? 3 : 1);
+		Out[i] = '0' + Digit[i];
+	}
+	Out[13] = '\0';
+	return Sum % 10 == 0;
+}
+
+/**
+  * 绘制并检查条码的几何形状，返回条码宽度，失败时返回0
+  */
+static uint16_t Test_Draw(uint8_t Type, const char *Text, uint8_t Module)
+{
+	uint16_t Width, Drawn, X;
+	int16_t Y;
+	uint8_t Color;
+
+	memset(Test_Buf, TEST_BACKGROUND, sizeof(Test_Buf));
+	Width = Barcode_Measure(Type, Text, Module);
+	Drawn = Barcode_Draw(&Test_Canvas, TEST_X, TEST_Y, Type, Text, Module, TEST_BAR_HEIGHT);
+	TEST_EQUAL(Width, Drawn);
+	if (Width == 0 || Width != Drawn) {return 0;}
+
+	for (X = TEST_X; X < TEST_X + Width; X ++)
+	{
+		Color = Canvas_GetPoint(&Test_Canvas, X, TEST_Y);
+		for (Y = TEST_Y; Y < TEST_Y + TEST_BAR_HEIGHT; Y ++)
+		{
+			if (Canvas_GetPoint(&Test_Canvas, X, Y) != Color) {TEST_ASSERT(!"column not uniform"); return 0;}
+		}
+		if (Canvas_GetPoint(&Test_Canvas, X, TEST_Y - 1) != ((TEST_BACKGROUND >> ((TEST_Y - 1) % 8)) & 1) ||
+			Canvas_GetPoint(&Test_Canvas, X, TEST_Y + TEST_BAR_HEIGHT) != ((TEST_BACKGROUND >> ((TEST_Y + TEST_BAR_HEIGHT) % 8)) & 1))
+		{
+			TEST_ASSERT(!"drawn outside the bar height");
+			return 0;
+		}
+	}
+	if (Canvas_GetPoint(&Test_Canvas, TEST_X - 1, TEST_Y) != ((TEST_BACKGROUND >> (TEST_Y % 8)) & 1) ||
+		Canvas_GetPoint(&Test_Canvas, TEST_X + Width, TEST_Y) != ((TEST_BACKGROUND >> (TEST_Y % 8)) & 1))
+	{
+		TEST_ASSERT(!"drawn outside the barcode width");
+		return 0;
+	}
+	return Width;
+}
+
+static void Test_Code128Case(const char *Text, uint8_t Module)
+{
+	char Out[256];
+	uint16_t Width = Test_Draw(BARCODE_CODE128, Text, Module);
+
+	if (Width == 0) {printf("  Code128 \"%s\" x%u not drawn\n", Text, Module); return;}
+	if (!Test_Scan(TEST_Y + TEST_BAR_HEIGHT / 2, Width, Module) || Test_DecodeCode128(Out) < 0 || strcmp(Out, Text))
+	{
+		TEST_ASSERT(!"Code128 decode");
+		printf("  Code128 \"%s\" x%u decoded wrong\n", Text, Module);
+		return;
+	}
+	Test_Decoded[0] ++;
+}
+
+static void Test_Ean13Case(const char *Text, uint8_t Module, const char *Expect)
+{
+	char Out[16];
+	uint16_t Width = Test_Draw(BARCODE_EAN13, Text, Module);
+
+	if (Width == 0) {printf("  EAN-13 %s x%u not drawn\n", Text, Module); return;}
+	TEST_EQUAL(Width, 113 * Module);
+	if (!Test_Scan(TEST_Y + TEST_BAR_HEIGHT / 2, Width, Module) || !Test_DecodeEan13(Out) || strcmp(Out, Expect))
+	{
+		TEST_ASSERT(!"EAN-13 decode");
+		printf("  EAN-13 %s x%u decoded wrong\n", Text, Module);
+		return;
+	}
+	Test_Decoded[1] ++;
+}
+
+/*固定种子的伪随机数，保证每次运行的测试内容相同*/
+static uint32_t Test_Seed = 1;
+static uint32_t Test_Random(uint32_t n)
+{
+	Test_Seed = Test_Seed * 1103515245 + 12345;
+	return (Test_Seed >> 16) % n;
+}
+
+int main(void)
+{
+	static const char *const Cases[] = {
+		"A", "0", "12", "123", "1234", "12345", "123456", "1234567890", "Hello, World!",
+		"ABC123456789xyz", "abc1234", "1234abcd5678", "LZ1104", "\t\x01" "ctrl\x1F", "~`{|}\x7F",
+		" !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~",
+	};
+	static const char Digits[] = "0123456789";
+	char Text[32], Expect[16];
+	uint8_t i, j, Length, Module, Check;
+	uint16_t n;
+
+	/*Code128：固定内容覆盖A/B/C字符集的切换*/
+	for (i = 0; i < sizeof(Cases) / sizeof(Cases[0]); i ++)
+	{
+		for (Module = 1; Module <= 3; Module ++) {Test_Code128Case(Cases[i], Module);}
+	}
+
+	/*Code128：随机内容，包括控制字符与长数字串*/
+	for (n = 0; n < 500; n ++)
+	{
+		Length = 1 + Test_Random(24);
+		for (j = 0; j < Length; j ++)
+		{
+			switch (Test_Random(3))
+			{
+				case 0: Text[j] = 1 + Test_Random(127); break;
+				case 1: Text[j] = Digits[Test_Random(10)]; break;
+				default: Text[j] = (Test_Random(4) == 0) ? 'a' + Test_Random(26) : Digits[Test_Random(10)]; break;
+			}
+		}
+		Text[Length] = '\0';
+		Test_Code128Case(Text, 1 + Test_Random(3));
+	}
+
+	/*Code128：非ASCII字符不能编码*/
+	TEST_EQUAL(Barcode_Measure(BARCODE_CODE128, "caf\xC3\xA9", 1), 0);
+	Test_Code128Case("", 1);							//空内容只有起始符、校验符与终止符
+
+	/*EAN-13：标准示例与随机的12位数字，校验位由绘制函数计算*/
+	Test_Ean13Case("400638133393", 1, "4006381333931");
+	Test_Ean13Case("4006381333931", 2, "4006381333931");
+	for (n = 0; n < 300; n ++)
+	{
+		for (j = 0; j < 12; j ++) {Text[j] = Digits[Test_Random(10)];}
+		Text[12] = '\0';
+		for (j = 0, Check = 0; j < 12; j ++) {Check += (Text[j] - '0') * ((j % 2) ? 3 : 1);}
+		memcpy(Expect, Text, 12);
+		Expect[12] = '0' + (10 - Check % 10) % 10;
+		Expect[13] = '\0';
+		Test_Ean13Case(Text, 1 + Test_Random(3), Expect);
+
+		/*校验位错误的13位数字被拒绝*/
+		Expect[12] = '0' + (Expect[12] - '0' + 1) % 10;
+		TEST_EQUAL(Barcode_Measure(BARCODE_EAN13, Expect, 1), 0);
+	}
+	TEST_EQUAL(Barcode_Measure(BARCODE_EAN13, "12345678901", 1), 0);
+	TEST_EQUAL(Barcode_Measure(BARCODE_EAN13, "12345678901a", 1), 0);
+
+	printf("  decoded %u Code128 and %u EAN-13 barcodes, module 1~3\n", Test_Decoded[0], Test_Decoded[1]);
+	return Test_Result("Test_Barcode");
+}
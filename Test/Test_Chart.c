@@ -0,0 +1,166 @@
+#include <stdio.h>
+#include <string.h>
+#include "Test.h"
+#include "Canvas.h"
+#include "Chart.h"
+
+/**
+  * 曲线图的增量绘制测试
+  * 在EPD与OLED画布的四个绘图区域上各送入一段随机游走的采样，每次Chart_Push之后检查：
+  * 增量绘制的结果与Chart_Redraw整体重画的结果相同（包括左移后的最左一列），
+  * 显存中改变的像素全部位于返回的脏矩形内，自动调整时纵轴范围包含缓冲区内的全部数据
+  */
+
+extern uint8_t EPD_DisplayBuf[16][248];
+extern uint8_t OLED_DisplayBuf[8][128];
+
+/*采样总数，平均分给各绘图区域*/
+#define TEST_SAMPLES			12000
+
+static uint8_t Test_Before[16 * 248];
+static uint8_t Test_Pushed[16 * 248];
+
+typedef struct
+{
+	const Canvas_t *Canvas;
+	int16_t X, Y, Width, Height;
+	uint8_t AutoScale;
+	int16_t Step;			//随机游走每步的最大变化
+} TestArea_t;
+
+/*快照的画布，与被测画布的大小、页序相同*/
+static Canvas_t Test_Snapshot(const Canvas_t *Canvas)
+{
+	Canvas_t Snapshot = *Canvas;
+	Snapshot.Buf = Test_Before;
+	return Snapshot;
+}
+
+/*统计脏矩形之外改变的像素数*/
+static uint32_t Test_Outside(const Canvas_t *Canvas, const TextRect_t *Dirty)
+{
+	Canvas_t Before = Test_Snapshot(Canvas);
+	int16_t Pages = Canvas->Height / 8, Page, X, Y, Bit;
+	uint32_t Count = 0;
+
+	for (Page = 0; Page < Pages; Page ++)
+	{
+		for (X = 0; X < Canvas->Width; X ++)
+		{
+			if (Test_Before[Page * Canvas->Width + X] == Canvas->Buf[Page * Canvas->Width + X]) {continue;}
+			for (Bit = 0; Bit < 8; Bit ++)
+			{
+				Y = (Canvas->PageFlip ? Pages - 1 - Page : Page) * 8 + Bit;
+				if (Canvas_GetPoint(&Before, X, Y) == Canvas_GetPoint(Canvas, X, Y)) {continue;}
+				if (X < Dirty->X || X >= Dirty->X + Dirty->Width ||
+					Y < Dirty->Y || Y >= Dirty->Y + Dirty->Height) {Count ++;}
+			}
+		}
+	}
+	return Count;
+}
+
+static void Test_Area(const TestArea_t *Area, uint32_t Samples, uint32_t *Seed)
+{
+	static Chart_t Chart;
+	uint32_t Size = Area->Canvas->Height / 8 * Area->Canvas->Width;
+	uint32_t n, Mismatch = 0, Outside = 0, Column0 = 0, Rescales = 0, Scrolls = 0, Range = 0;
+	TextRect_t Dirty;
+	int32_t Value = 0;
+	uint16_t i;
+
+	memset(Area->Canvas->Buf, 0x5A, Size);
+	Chart_Init(&Chart, Area->Canvas, Area->X, Area->Y, Area->Width, Area->Height, -100, 100, Area->AutoScale);
+
+	for (n = 0; n < Samples; n ++)
+	{
+		*Seed = *Seed * 1103515245 + 12345;
+		Value += (int32_t)((*Seed >> 16) % (2 * Area->Step + 1)) - Area->Step;
+		if (n % 1000 == 999) {Value /= 8;}		//偶尔大幅回落，数据跨度变小，自动调整时缩小范围
+		if (Value > 30000) {Value = 30000;}
+		if (Value < -30000) {Value = -30000;}
+
+		memcpy(Test_Before, Area->Canvas->Buf, Size);
+		if (Chart_Push(&Chart, Value, &Dirty)) {Rescales ++;}
+		if (Chart.Count == Chart.Width && n >= (uint32_t)Chart.Width) {Scrolls ++;}
+
+		/*脏矩形在绘图区域之内，显存改变的像素都在脏矩形之内*/
+		TEST_ASSERT(Dirty.Width > 0 && Dirty.Height > 0);
+		TEST_ASSERT(Dirty.X >= Area->X && Dirty.X + Dirty.Width <= Area->X + Area->Width);
+		TEST_ASSERT(Dirty.Y >= Area->Y && Dirty.Y + Dirty.Height <= Area->Y + Area->Height);
+		Outside += Test_Outside(Area->Canvas, &Dirty);
+
+		/*与整体重画的结果相同，左移后最左一列不能留下与被丢弃的点之间的连线*/
+		memcpy(Test_Pushed, Area->Canvas->Buf, Size);
+		Chart_Redraw(&Chart);
+		if (memcmp(Test_Pushed, Area->Canvas->Buf, Size))
+		{
+			Mismatch ++;
+			for (i = 0; i < Size; i += Area->Canvas->Width)
+			{
+				if (Test_Pushed[i + Area->X] != Area->Canvas->Buf[i + Area->X]) {Column0 ++; break;}
+			}
+		}
+
+		/*固定范围不变，自动调整时范围包含全部数据*/
+		for (i = 0; i < Chart.Count; i ++)
+		{
+			if (Chart.Buf[i] < Chart.Min || Chart.Buf[i] > Chart.Max) {Range ++; break;}
+		}
+	}
+
+	TEST_EQUAL(Mismatch, 0);
+	TEST_EQUAL(Column0, 0);
+	TEST_EQUAL(Outside, 0);
+	TEST_ASSERT(Scrolls > 0);
+	if (Area->AutoScale)
+	{
+		TEST_EQUAL(Range, 0);
+		TEST_ASSERT(Rescales > 0 && Rescales * 10 < Samples);		//留有余量，不会每个采样都重画
+	}
+	else
+	{
+		TEST_EQUAL(Rescales, 0);
+		TEST_ASSERT(Chart.Min == -100 && Chart.Max == 100);
+	}
+	printf("  %s %3dx%-3d at (%3d,%3d) %s: %u samples, %u scrolled, %u rescaled\n",
+		   Area->Canvas == &OLED_Canvas ? "OLED" : "EPD ", Area->Width, Area->Height, Area->X, Area->Y,
+		   Area->AutoScale ? "auto " : "fixed", Samples, Scrolls, Rescales);
+}
+
+/*持续上升的信号：每次扩大范围都留出约1/4跨度的余量，重画的次数远少于采样数*/
+static void Test_Ramp(void)
+{
+	static Chart_t Chart;
+	uint32_t Rescales = 0;
+	int16_t n;
+
+	Chart_Init(&Chart, &EPD_Canvas, 0, 0, 100, 64, 0, 10, CHART_AUTO);
+	for (n = 0; n < 1000; n ++)
+	{
+		Rescales += Chart_Push(&Chart, n, NULL);
+		TEST_ASSERT(Chart.Max >= n);
+	}
+	TEST_ASSERT(Rescales < 60);
+
+	/*刚调整后的范围不会立即满足缩小的条件，同一个值再送一次不重画*/
+	TEST_EQUAL(Chart_Push(&Chart, 999, NULL), 0);
+}
+
+int main(void)
+{
+	static const TestArea_t Areas[] = {
+		{&EPD_Canvas, 0, 0, 248, 128, CHART_FIXED, 9},			//整屏，超出范围的点限制在边缘
+		{&EPD_Canvas, 13, 37, 100, 45, CHART_AUTO, 40},			//上下都不按页对齐，跨越24行的分段
+		{&OLED_Canvas, 5, 3, 120, 58, CHART_AUTO, 200},
+		{&OLED_Canvas, 126, 8, 1, 16, CHART_FIXED, 5},		//宽度为1，每个采样都左移
+	};
+	uint32_t Seed = 1, i;
+
+	for (i = 0; i < sizeof(Areas) / sizeof(Areas[0]); i ++)
+	{
+		Test_Area(&Areas[i], TEST_SAMPLES / (sizeof(Areas) / sizeof(Areas[0])), &Seed);
+	}
+	Test_Ramp();
+	return Test_Result("Test_Chart");
+}
@@ -0,0 +1,141 @@
+#include <stdio.h>
+#include <string.h>
+#include "Test.h"
+#include "EPD.h"
+#include "EPD_Sim.h"
+#include "Digits.h"
+
+/**
+  * 数字控件的增量更新测试
+  * 计数器从0开始连续加1，每次统计显存实际改变的字节数与脏矩形覆盖的字节数（按页取整，即EPD_UpdateArea发送的数据量）
+  * 每隔一段把增量结果与重新整体绘制的结果比较，并用EPD控制器模拟检查局部更新后屏幕与显存一致
+  */
+
+extern uint8_t EPD_DisplayBuf[16][248];
+
+/*增量次数，覆盖5位计数器的10万个值*/
+#define TEST_COUNT				100000
+
+/*与main.c中的计数器位置一致*/
+#define TEST_X					0
+#define TEST_Y					32
+#define TEST_LENGTH				5
+
+static uint8_t Test_Before[16][248];
+static uint8_t Test_Fresh[16][248];
+
+/*脏矩形按页取整后的字节数*/
+static uint32_t Test_DirtyBytes(const TextRect_t *Dirty)
+{
+	if (Dirty->Width <= 0 || Dirty->Height <= 0) {return 0;}
+	return Dirty->Width * ((Dirty->Y + Dirty->Height - 1) / 8 - Dirty->Y / 8 + 1);
+}
+
+/*检查改变的字节全部位于脏矩形内*/
+static uint32_t Test_Changed(const TextRect_t *Dirty, uint8_t *Outside)
+{
+	uint32_t Count = 0;
+	int16_t X, Y, Page;
+
+	*Outside = 0;
+	for (Page = 0; Page < 16; Page ++)
+	{
+		for (X = 0; X < 248; X ++)
+		{
+			if (Test_Before[Page][X] == EPD_DisplayBuf[Page][X]) {continue;}
+			Count ++;
+			Y = (15 - Page) * 8;		//EPD画布第0页位于最下方
+			if (X < Dirty->X || X >= Dirty->X + Dirty->Width ||
+				Y + 8 <= Dirty->Y || Y >= Dirty->Y + Dirty->Height) {*Outside = 1;}
+		}
+	}
+	return Count;
+}
+
+static void Test_Increment(void)
+{
+	Digits_t Digits, Fresh;
+	TextRect_t Dirty;
+	uint64_t DirtySum = 0, ChangedSum = 0;
+	uint32_t DirtyMax = 0, Bytes, Changed, Widget, Mismatch = 0, Outside = 0, n;
+	uint8_t Out;
+
+	memset(EPD_DisplayBuf, 0, sizeof(EPD_DisplayBuf));
+	Digits_Init(&Digits, &EPD_Canvas, TEST_X, TEST_Y, TEST_LENGTH, &Font_Prop16);
+	Digits_ShowNum(&Digits, 0, &Dirty);
+	Widget = Digits.CellWidth * TEST_LENGTH * 2;
+
+	for (n = 1; n < TEST_COUNT; n ++)
+	{
+		memcpy(Test_Before, EPD_DisplayBuf, sizeof(EPD_DisplayBuf));
+		TEST_ASSERT(Digits_ShowNum(&Digits, n, &Dirty));
+		Bytes = Test_DirtyBytes(&Dirty);
+		Changed = Test_Changed(&Dirty, &Out);
+		DirtySum += Bytes;
+		ChangedSum += Changed;
+		if (Bytes > DirtyMax) {DirtyMax = Bytes;}
+		Outside += Out;
+
+		/*每隔997次与整体重画的结果比较*/
+		if (n % 997 == 0)
+		{
+			memcpy(Test_Before, EPD_DisplayBuf, sizeof(EPD_DisplayBuf));
+			memset(EPD_DisplayBuf, 0, sizeof(EPD_DisplayBuf));
+			Digits_Init(&Fresh, &EPD_Canvas, TEST_X, TEST_Y, TEST_LENGTH, &Font_Prop16);
+			Digits_ShowNum(&Fresh, n, NULL);
+			memcpy(Test_Fresh, EPD_DisplayBuf, sizeof(EPD_DisplayBuf));
+			memcpy(EPD_DisplayBuf, Test_Before, sizeof(EPD_DisplayBuf));
+			if (memcmp(Test_Fresh, EPD_DisplayBuf, sizeof(EPD_DisplayBuf))) {Mismatch ++;}
+		}
+	}
+
+	printf("  %u increments: dirty %.2f bytes/increment (max %u), changed %.2f bytes/increment\n",
+		   TEST_COUNT - 1, (double)DirtySum / (TEST_COUNT - 1), DirtyMax, (double)ChangedSum / (TEST_COUNT - 1));
+	printf("  whole widget %u bytes, full frame %u bytes\n", Widget, 16 * 248);
+
+	TEST_EQUAL(Mismatch, 0);
+	TEST_EQUAL(Outside, 0);
+	TEST_ASSERT(DirtyMax <= Widget);
+	/*个位每次都变，十位每10次变一次，平均约1.11个字符格*/
+	TEST_ASSERT(DirtySum < (uint64_t)(TEST_COUNT - 1) * Widget / TEST_LENGTH * 12 / 10);
+}
+
+static void Test_Refresh(void)
+{
+	Digits_t Digits;
+	TextRect_t Dirty;
+	EPD_SimStats_t Last;
+	uint32_t n, Sent = 0, Bad = 0, Full;
+
+	EPD_Sim_Reset();
+	EPD_Init();
+	EPD_Clear();
+	Digits_Init(&Digits, &EPD_Canvas, TEST_X, TEST_Y, TEST_LENGTH, &Font_Prop16);
+	Digits_ShowNum(&Digits, 0, &Dirty);
+	EPD_Update();							//第一次更新包括EPD_Init的通信，取第二次的字节数
+	EPD_Update();
+	EPD_Sim_GetStats(&Last, NULL);
+	Full = Last.Bytes;
+	EPD_UpdateArea(0, 0, 248, 128);			//EPD_Update的RAM光标未在实际屏幕上验证，用整屏局部更新对齐屏幕
+	TEST_EQUAL(EPD_Sim_Compare(&EPD_Canvas), 0);
+
+	/*每次增量只发送脏矩形，发送后屏幕应与显存完全一致*/
+	for (n = 1; n <= 2000; n ++)
+	{
+		Digits_ShowNum(&Digits, n, &Dirty);
+		EPD_UpdateArea(Dirty.X, Dirty.Y, Dirty.Width, Dirty.Height);
+		EPD_Sim_GetStats(&Last, NULL);
+		Sent += Last.Bytes;
+		if (EPD_Sim_Compare(&EPD_Canvas)) {Bad ++;}
+	}
+	printf("  EPD_UpdateArea: %.1f bytes/increment on the bus, EPD_Update: %u bytes\n", Sent / 2000.0, Full);
+	TEST_EQUAL(Bad, 0);
+	TEST_ASSERT(Sent / 2000 < Full / 10);
+}
+
+int main(void)
+{
+	Test_Increment();
+	Test_Refresh();
+	return Test_Result("Test_Digits");
+}
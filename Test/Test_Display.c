@@ -0,0 +1,175 @@
+#include <string.h>
+#include "Test.h"
+#include "EPD.h"
+#include "OLED.h"
+#include "Canvas.h"
+#include "Font.h"
+#include "Text.h"
+#include "Dither.h"
+
+/**
+  * 显示模块的Golden图像测试
+  * 分别在EPD与OLED的显存上绘制字符、数字、汉字、图形与排版文字，与Golden目录中的图像逐字节比较
+  * 修改了绘制代码且确认新图像正确后，运行make golden更新Golden文件
+  */
+
+extern uint8_t EPD_DisplayBuf[16][248];
+extern uint8_t OLED_DisplayBuf[8][128];
+
+/*EPD_Data.h与OLED.h包含的OLED_Data.h定义了同名、同布局的ChineseCell_t，不能同时包含，这里用OLED的类型声明EPD的字模库*/
+extern const ChineseCell_t EPD_CF16x16[];
+extern const uint16_t EPD_CF16x16_Num;
+
+/*EPD.c、OLED.c中未在头文件声明的汉字查找函数*/
+uint8_t EPD_DecodeChar(const char *String, uint32_t *Code);
+uint16_t EPD_FindChinese(uint32_t Code);
+uint8_t OLED_DecodeChar(const char *String, uint32_t *Code);
+uint16_t OLED_FindChinese(uint32_t Code);
+
+static void Test_EPDText(void)
+{
+	EPD_Clear();
+	EPD_ShowString(0, 0, "EPD 8x16 ABC xyz", EPD_8X16);
+	EPD_ShowString(0, 16, "EPD 6x8 !\"#$%&'()*+,-./", EPD_6X8);
+	EPD_ShowNum(0, 24, 1234567890, 10, EPD_8X16);
+	EPD_ShowSignedNum(88, 24, -4321, 5, EPD_8X16);
+	EPD_ShowHexNum(144, 24, 0xBEEF, 4, EPD_8X16);
+	EPD_ShowBinNum(0, 40, 0xA5, 8, EPD_6X8);
+	EPD_ShowFloatNum(56, 40, 3.14159, 2, 3, EPD_6X8);
+	EPD_ShowFixedNum(112, 40, -5L << 15, 2, 2, EPD_6X8);
+	EPD_ShowScaledNum(168, 40, 12345, 2, 3, 2, EPD_6X8);
+	EPD_Printf(0, 48, EPD_8X16, "Printf %d %05u %x %s", -7, 42u, 0x1Fu, "ok");
+	EPD_ShowZoomString(0, 64, "Zx2", EPD_8X16, 2);
+	EPD_ShowZoomString(56, 64, "Z3", EPD_6X8, 3);
+	EPD_ShowString(120, 100, "Clip at edge", EPD_8X16);
+	Test_Golden(&EPD_Canvas, "EPD_Text");
+}
+
+static void Test_EPDShapes(void)
+{
+	EPD_Clear();
+	Canvas_FillRect(&EPD_Canvas, 4, 4, 60, 30, 1);
+	Canvas_FillRect(&EPD_Canvas, 10, 10, 20, 10, 0);
+	Canvas_FillRect(&EPD_Canvas, -10, 100, 40, 40, 1);
+	Canvas_DrawPoint(&EPD_Canvas, 0, 0, 1);
+	Canvas_DrawPoint(&EPD_Canvas, 247, 127, 1);
+	Canvas_DrawPoint(&EPD_Canvas, 248, 128, 1);
+	Canvas_WriteColumn(&EPD_Canvas, 100, 3, 0x2AAAAAAA, 30);
+	EPD_ShowString(80, 60, "Reversed", EPD_8X16);
+	EPD_Reverse();
+	Test_Golden(&EPD_Canvas, "EPD_Shapes");
+}
+
+static void Test_EPDLayout(void)
+{
+	TextRect_t Rect = {8, 8, 120, 60};
+
+	EPD_Clear();
+	Font_ShowString(&EPD_Canvas, 130, 8, "Prop16 Wide Mill", &Font_Prop16);
+	Font_ShowString(&EPD_Canvas, 130, 30, "Prop8 iiii WWWW", &Font_Prop8);
+	Text_Layout(&EPD_Canvas, &Rect, "Wrapped text is centred in the box and cut with an ellipsis when it does not fit",
+				&EPD_TextFace, TEXT_CENTER | TEXT_MIDDLE | TEXT_ELLIPSIS, NULL);
+	Rect.X = 8; Rect.Y = 80; Rect.Width = 232; Rect.Height = 40;
+	Text_Layout(&EPD_Canvas, &Rect, "Right aligned\nsecond line", &EPD_TextFace, TEXT_RIGHT | TEXT_BOTTOM, NULL);
+	Test_Golden(&EPD_Canvas, "EPD_Layout");
+}
+
+static void Test_OLED(void)
+{
+	OLED_Clear();
+	OLED_ShowString(0, 0, "OLED 8x16", OLED_8X16);
+	OLED_ShowNum(80, 0, 42, 3, OLED_6X8);
+	OLED_ShowString(0, 16, "6x8 font 0123", OLED_6X8);
+	OLED_DrawLine(0, 63, 127, 24);
+	OLED_DrawRectangle(2, 28, 30, 20, OLED_UNFILLED);
+	OLED_DrawRectangle(36, 28, 20, 20, OLED_FILLED);
+	OLED_DrawCircle(74, 40, 10, OLED_UNFILLED);
+	OLED_DrawCircle(100, 40, 8, OLED_FILLED);
+	OLED_DrawTriangle(2, 62, 20, 50, 30, 62, OLED_FILLED);
+	OLED_DrawEllipse(60, 56, 20, 6, OLED_UNFILLED);
+	OLED_DrawArc(110, 56, 7, -90, 90, OLED_FILLED);
+	OLED_ReverseArea(80, 16, 40, 8);
+	Test_Golden(&OLED_Canvas, "OLED_Shapes");
+}
+
+static void Test_Dither(void)
+{
+	static uint8_t Gray[16][128], Before[8][128];
+	uint8_t Mode, X, Y;
+
+	for (Y = 0; Y < 16; Y ++)
+	{
+		for (X = 0; X < 128; X ++) {Gray[Y][X] = X * 2 + (Y & 0x01);}
+	}
+
+	/*宽度为0时不输出，也不改写显存*/
+	memset(OLED_DisplayBuf, 0x5A, sizeof(OLED_DisplayBuf));
+	memcpy(Before, OLED_DisplayBuf, sizeof(Before));
+	for (Mode = DITHER_BAYER4; Mode <= DITHER_ATKINSON; Mode ++)
+	{
+		Dither_Image(&OLED_Canvas, 0, 0, 0, 16, Gray[0], Mode);
+	}
+	TEST_ASSERT(memcmp(Before, OLED_DisplayBuf, sizeof(Before)) == 0);
+
+	/*四种方式各画一条横向渐变，最后一条超出屏幕底部*/
+	OLED_Clear();
+	for (Mode = DITHER_BAYER4; Mode <= DITHER_ATKINSON; Mode ++)
+	{
+		Dither_Image(&OLED_Canvas, Mode * 2 - 4, Mode * 16 + 4, 128, 16, Gray[0], Mode);
+	}
+	Test_Golden(&OLED_Canvas, "OLED_Dither");
+}
+
+/*字模库的每个汉字都能查到自己：索引是一个完整的字符，编码严格递增，二分查找返回它所在的位置*/
+static void Test_ChineseTable(const ChineseCell_t *Table, uint16_t Num,
+							  uint8_t (*Decode)(const char *, uint32_t *), uint16_t (*Find)(uint32_t))
+{
+	uint32_t Code, Last = 0;
+	uint16_t i;
+
+	TEST_ASSERT(Num > 0);
+	for (i = 0; i < Num; i ++)
+	{
+		TEST_EQUAL(Decode(Table[i].Index, &Code), strlen(Table[i].Index));
+		TEST_ASSERT(Code >= 0x80 && Code != 0xFFFD);
+		TEST_ASSERT(i == 0 || Code > Last);
+		TEST_EQUAL(Find(Code), i);
+		Last = Code;
+	}
+
+	/*不在表中的编码返回末尾默认图形的位置*/
+	TEST_EQUAL(Find(0x6D4B), Num);			//“测”
+	TEST_EQUAL(Find(Last + 1), Num);
+	TEST_EQUAL(Table[Num].Index[0], '\0');
+}
+
+static void Test_Chinese(void)
+{
+	Test_ChineseTable(EPD_CF16x16, EPD_CF16x16_Num, EPD_DecodeChar, EPD_FindChinese);
+	Test_ChineseTable(OLED_CF16x16, OLED_CF16x16_Num, OLED_DecodeChar, OLED_FindChinese);
+
+	/*ASCII与汉字混合，ASCII宽8像素，汉字宽16像素，不在表中的汉字显示默认图形，超出屏幕的部分被裁剪*/
+	EPD_Clear();
+	EPD_ShowChinese(0, 0, "Hi你好，世界。");
+	EPD_ShowChinese(0, 20, "A测B世C");
+	EPD_ShowChinese(-8, 40, "你x好 y");
+	EPD_ShowChinese(200, 60, "Ab你好界");
+	Test_Golden(&EPD_Canvas, "EPD_Chinese");
+
+	OLED_Clear();
+	OLED_ShowChinese(0, 0, "Hi你好，世界。");
+	OLED_ShowChinese(0, 20, "A测B世C");
+	OLED_ShowChinese(88, 44, "x你好");
+	Test_Golden(&OLED_Canvas, "OLED_Chinese");
+}
+
+int main(void)
+{
+	Test_EPDText();
+	Test_EPDShapes();
+	Test_EPDLayout();
+	Test_OLED();
+	Test_Dither();
+	Test_Chinese();
+	return Test_Result("Test_Display");
+}
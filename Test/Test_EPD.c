@@ -0,0 +1,196 @@
+#include <stdio.h>
+#include <string.h>
+#include "Test.h"
+#include "EPD.h"
+#include "EPD_Sim.h"
+#include "Canvas.h"
+
+/**
+  * EPD驱动在控制器模拟上的回归测试
+  * 检查EPD_Init写入的配置、EPD_UpdateArea后屏幕与显存一致、每次更新的通信量与耗时，
+  * 以及驱动在BUSY为高时没有发送任何字节，分两步刷新（EPD_UpdateAreaStart/EPD_UpdateFinish）时同样如此
+  * EPD_Update保留原驱动的RAM光标(15, 247)，模拟器按字面执行时整帧会错开一个字节，
+  * 实际屏幕上的效果尚未验证，所以这里只检查它的通信量与耗时，不检查图像的位置
+  */
+
+extern uint8_t EPD_DisplayBuf[16][248];
+
+/*EPD.c中未在EPD.h声明的通信函数*/
+void EPD_WriteCommand(uint8_t Command);
+void EPD_WriteData(uint8_t Data);
+void EPD_WaitBusy(void);
+
+/*EPD_Update的字节数：设置窗口15字节，0x24及3968字节显存，0x22及参数，0x20*/
+#define TEST_UPDATE_BYTES		(15 + 1 + 16 * 248 + 2 + 1)
+
+static void Test_Init(void)
+{
+	const EPD_SimState_t *State = EPD_Sim_GetState();
+	EPD_SimStats_t Total;
+
+	EPD_Sim_Reset();
+	EPD_Init();
+	EPD_Sim_GetStats(NULL, &Total);
+
+	TEST_EQUAL(State->Mux, 0xF7);
+	TEST_EQUAL(State->Scan, 0x00);
+	TEST_EQUAL(State->Entry, 0x04);
+	TEST_EQUAL(State->XStart, 0x0E);
+	TEST_EQUAL(State->XEnd, 0x03);
+	TEST_EQUAL(State->YStart, 0xF7);
+	TEST_EQUAL(State->YEnd, 0x00);
+	TEST_EQUAL(State->LutLength, 224);
+	TEST_EQUAL(State->Lut[0], 0xFF);
+	TEST_EQUAL(State->Lut[223], 0xFF);
+
+	/*软件复位1条，配置9条命令，参数16字节，波形表224字节，不刷新*/
+	TEST_EQUAL(Total.Commands, 10);
+	TEST_EQUAL(Total.Bytes, 10 + 16 + 224);
+	TEST_EQUAL(Total.Refreshes, 0);
+	TEST_EQUAL(Total.BusyBytes, 0);
+
+	/*复位后30ms，软件复位等待EPD_SIM_RESET_MS，每次等待BUSY后再延时10ms*/
+	TEST_ASSERT(Total.Time >= 30000 + EPD_SIM_RESET_MS * 1000 + 3 * 10000);
+	printf("  EPD_Init: %u bytes, %u pin writes, %.1f ms\n", Total.Bytes, Total.Writes, Total.Time / 1000.0);
+}
+
+static void Test_Update(void)
+{
+	EPD_SimStats_t Last;
+	int16_t i;
+
+	EPD_Clear();
+	EPD_ShowString(3, 3, "Hello sim", EPD_8X16);
+	Canvas_FillRect(&EPD_Canvas, 100, 50, 60, 40, 1);
+	for (i = 0; i < 248; i += 3) {Canvas_DrawPoint(&EPD_Canvas, i, 127 - i % 128, 1);}
+	Canvas_DrawPoint(&EPD_Canvas, 0, 0, 1);
+	Canvas_DrawPoint(&EPD_Canvas, 247, 127, 1);
+	EPD_Update();							//第一次更新包括EPD_Init的通信
+	EPD_Update();
+	EPD_Sim_GetStats(&Last, NULL);
+
+	TEST_EQUAL(Last.Commands, 8);
+	TEST_EQUAL(Last.Bytes, TEST_UPDATE_BYTES);
+	TEST_EQUAL(Last.Refreshes, 1);
+	TEST_EQUAL(Last.BusyBytes, 0);
+	TEST_EQUAL(EPD_Sim_GetState()->Update, 0xF7);
+
+	/*耗时为引脚写入、刷新等待与读BUSY之和，上一次更新末尾的10ms延时计入本次*/
+	TEST_ASSERT(Last.Time >= EPD_SIM_REFRESH_MS * 1000ULL + Last.Writes * EPD_SIM_WRITE_NS / 1000);
+	TEST_ASSERT(Last.Time <= EPD_SIM_REFRESH_MS * 1000ULL + Last.Writes * EPD_SIM_WRITE_NS / 1000 + 10000 + 100);
+
+	printf("  EPD_Update: %u commands, %u bytes, %u pin writes, %.1f toggles/byte, %u BUSY polls, %.1f ms (%.1f ms sending)\n",
+		   Last.Commands, Last.Bytes, Last.Writes, (double)Last.Toggles / Last.Bytes, Last.Polls,
+		   Last.Time / 1000.0, Last.Writes * EPD_SIM_WRITE_NS / 1e6);
+
+	/*整屏区域的局部更新后，屏幕与显存逐点一致，RAM与显存逐字节一致*/
+	EPD_UpdateArea(0, 0, 248, 128);
+	TEST_EQUAL(EPD_Sim_Compare(&EPD_Canvas), 0);
+	TEST_ASSERT(memcmp(EPD_Sim_Ram[EPD_SIM_RAM_BW], EPD_DisplayBuf, sizeof(EPD_DisplayBuf)) == 0);
+}
+
+static void Test_UpdateArea(void)
+{
+	EPD_SimStats_t Last, Total;
+
+	/*区域内改变的内容被发送*/
+	Canvas_FillRect(&EPD_Canvas, 10, 100, 20, 10, 1);
+	TEST_ASSERT(EPD_Sim_Compare(&EPD_Canvas) != 0);
+	EPD_UpdateArea(10, 100, 20, 10);
+	EPD_Sim_GetStats(&Last, NULL);
+	TEST_EQUAL(EPD_Sim_Compare(&EPD_Canvas), 0);
+	TEST_EQUAL(Last.BusyBytes, 0);
+
+	/*Y为100~109，跨第2、3页，每页20字节*/
+	TEST_EQUAL(Last.Bytes, 15 + 1 + 2 * 20 + 2 + 1);
+	printf("  EPD_UpdateArea 20x10: %u bytes, %.1f ms\n", Last.Bytes, Last.Time / 1000.0);
+
+	/*区域外改变的内容不发送*/
+	Canvas_DrawPoint(&EPD_Canvas, 200, 5, 1);
+	Canvas_DrawPoint(&EPD_Canvas, 50, 50, 1);
+	EPD_UpdateArea(40, 40, 20, 20);
+	TEST_EQUAL(EPD_Sim_Compare(&EPD_Canvas), 1);
+	TEST_EQUAL(Canvas_GetPoint(&EPD_Sim_Canvas, 200, 5), 0);
+	TEST_EQUAL(Canvas_GetPoint(&EPD_Sim_Canvas, 50, 50), 1);
+
+	/*裁剪：完全在屏幕外的区域不产生任何通信*/
+	EPD_Sim_GetStats(NULL, &Last);
+	EPD_UpdateArea(300, 10, 20, 20);
+	EPD_UpdateArea(-40, 10, 20, 20);
+	EPD_Sim_GetStats(NULL, &Total);
+	TEST_EQUAL(Total.Bytes, Last.Bytes);
+
+	/*边角：超出屏幕的整屏区域被裁剪，四角都被发送*/
+	Canvas_DrawPoint(&EPD_Canvas, 0, 127, 1);
+	Canvas_DrawPoint(&EPD_Canvas, 247, 0, 1);
+	EPD_UpdateArea(-5, -5, 255, 140);
+	TEST_EQUAL(EPD_Sim_Compare(&EPD_Canvas), 0);
+}
+
+static void Test_Async(void)
+{
+	EPD_SimStats_t Before, After;
+
+	/*屏幕外的区域不开始刷新，也没有需要结束的刷新*/
+	EPD_Sim_GetStats(NULL, &Before);
+	TEST_EQUAL(EPD_UpdateAreaStart(300, 10, 20, 20), 0);
+	TEST_EQUAL(EPD_IsBusy(), 0);
+	EPD_UpdateFinish();
+	EPD_Sim_GetStats(NULL, &After);
+	TEST_EQUAL(After.Bytes, Before.Bytes);
+
+	/*开始后立即返回，刷新尚未完成；连续开始时先结束上一次，BUSY为高时不发送*/
+	Canvas_FillRect(&EPD_Canvas, 60, 8, 30, 20, 1);
+	TEST_EQUAL(EPD_UpdateAreaStart(60, 8, 30, 20), 1);
+	EPD_Sim_GetStats(NULL, &After);
+	TEST_EQUAL(After.Refreshes - Before.Refreshes, 1);
+	Canvas_FillRect(&EPD_Canvas, 120, 64, 16, 16, 1);
+	TEST_EQUAL(EPD_UpdateAreaStart(120, 64, 16, 16), 1);
+	EPD_Sim_GetStats(NULL, &After);
+	TEST_EQUAL(After.Refreshes - Before.Refreshes, 2);
+	TEST_EQUAL(After.BusyBytes, Before.BusyBytes);
+
+	/*BUSY变低后结束，屏幕与显存一致；再次结束不产生通信*/
+	EPD_Sim_Delay(EPD_SIM_REFRESH_MS * 1000);
+	TEST_EQUAL(EPD_IsBusy(), 0);
+	EPD_UpdateFinish();
+	TEST_EQUAL(EPD_Sim_Compare(&EPD_Canvas), 0);
+	EPD_Sim_GetStats(NULL, &Before);
+	EPD_UpdateFinish();
+	EPD_Sim_GetStats(NULL, &After);
+	TEST_EQUAL(After.Bytes, Before.Bytes);
+}
+
+static void Test_BusyModel(void)
+{
+	EPD_SimStats_t Last, Before, After;
+
+	/*刷新后不等待BUSY就发送，模拟器应能发现，并把刷新之前的通信作为一次完整的更新*/
+	EPD_Sim_GetStats(NULL, &Before);
+	EPD_WriteCommand(0x22);
+	EPD_WriteData(0xF7);
+	EPD_WriteCommand(0x20);
+	EPD_WriteCommand(0x24);
+	EPD_WaitBusy();
+	EPD_Sim_GetStats(&Last, &After);
+	TEST_EQUAL(After.BusyBytes - Before.BusyBytes, 1);
+	TEST_EQUAL(Last.Bytes, 3);
+	TEST_EQUAL(Last.Refreshes, 1);
+	TEST_ASSERT(Last.Time < 10000 + 1000);		//没有等待刷新，只有上一次更新末尾的10ms延时与发送时间
+
+	/*等待BUSY时读到的第一次为高，之后为低*/
+	EPD_WriteCommand(0x20);
+	TEST_EQUAL(EPD_Sim_ReadBusy(), 1);
+	TEST_EQUAL(EPD_Sim_ReadBusy(), 0);
+	TEST_EQUAL(EPD_Sim_ReadBusy(), 0);
+}
+
+int main(void)
+{
+	Test_Init();
+	Test_Update();
+	Test_UpdateArea();
+	Test_Async();
+	Test_BusyModel();
+	return Test_Result("Test_EPD");
+}
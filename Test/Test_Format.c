@@ -0,0 +1,310 @@
+#include <stdio.h>
+#include <string.h>
+#include "Test.h"
+#include "Format.h"
+#include "EPD.h"
+#include "OLED.h"
+
+/**
+  * 数字格式化测试
+  * 把Format_Dec、Format_Hex、Format_Bin与原ShowNum、ShowHexNum、ShowBinNum中
+  * Number / Pow(Base, Length - i - 1) % Base逐位提取的写法比较，并比较两者每位的耗时
+  * 原写法中的除以0按Cortex-M3的UDIV处理（未开启DIV_0_TRP时结果为0），与单片机上的行为一致
+  * 耗时在电脑上测得，只能说明两种写法的相对快慢，不代表单片机上的周期数
+  * 另检查ShowFixedNum、ShowScaledNum与ShowFloatNum的四舍五入相同，包括正好一半、进位与接近0的负数
+  */
+
+extern uint8_t EPD_DisplayBuf[16][248];
+extern uint8_t OLED_DisplayBuf[8][128];
+
+/*各进制在显示函数缓冲区内的最大位数*/
+static const uint8_t Test_MaxLength[3] = {10, 8, 32};
+static const uint32_t Test_Base[3] = {10, 16, 2};
+
+/*原EPD_Pow、OLED_Pow*/
+static uint32_t Test_Pow(uint32_t X, uint32_t Y)
+{
+	uint32_t Result = 1;
+	while (Y --)
+	{
+		Result *= X;
+	}
+	return Result;
+}
+
+/*原显示函数逐位提取的写法，输出到字符串*/
+static void Test_Legacy(char *String, uint32_t Number, uint8_t Length, uint32_t Base)
+{
+	uint32_t Pow, Digit;
+	uint8_t i;
+
+	for (i = 0; i < Length; i ++)
+	{
+		Pow = Test_Pow(Base, Length - i - 1);
+		Digit = (Pow ? Number / Pow : 0) % Base;
+		String[i] = Digit < 10 ? Digit + '0' : Digit - 10 + 'A';
+	}
+	String[Length] = '\0';
+}
+
+static uint8_t Test_Format(uint8_t Type, char *String, uint32_t Number, uint8_t Length)
+{
+	switch (Type)
+	{
+		case 0: return Format_Dec(String, Number, Length);
+		case 1: return Format_Hex(String, Number, Length);
+		default: return Format_Bin(String, Number, Length);
+	}
+}
+
+/**
+  * 比较一个数在0~MaxLength全部长度下的结果，返回不一致的次数
+  * 不超过最大位数时与原写法逐字比较，超过时高位应为0，低位与最大位数时的结果相同
+  */
+static uint32_t Test_Compare(uint8_t Type, uint32_t Number, uint8_t MaxLength)
+{
+	char New[48], Old[48];
+	uint8_t Length, Max = Test_MaxLength[Type];
+	uint32_t Bad = 0;
+
+	for (Length = 0; Length <= MaxLength; Length ++)
+	{
+		if (Test_Format(Type, New, Number, Length) != Length || strlen(New) != Length) {Bad ++; continue;}
+		if (Length <= Max)
+		{
+			Test_Legacy(Old, Number, Length, Test_Base[Type]);
+		}
+		else
+		{
+			memset(Old, '0', Length - Max);
+			Test_Legacy(Old + Length - Max, Number, Max, Test_Base[Type]);
+		}
+		if (strcmp(New, Old)) {Bad ++;}
+	}
+	return Bad;
+}
+
+static void Test_Digits(void)
+{
+	static const uint32_t Edges[] = {
+		0, 1, 9, 10, 99, 100, 999999999, 1000000000, 1410065407, 1410065408, 4294967294, 4294967295,
+		0x0F, 0x10, 0x0FFFFFFF, 0x10000000, 0x7FFFFFFF, 0x80000000,
+	};
+	char String[16];
+	uint64_t n;
+	uint32_t Bad = 0, Count = 0, i;
+	uint8_t Type;
+
+	/*十进制的最后一位覆盖全部2^32个数：余数全部正确，即乘倒数的除以10对全部输入精确，其余各位由同一运算逐次得到*/
+	for (n = 0; n <= 0xFFFFFFFFULL; n ++)
+	{
+		Format_Dec(String, (uint32_t)n, 1);
+		if (String[0] != (char)('0' + n % 10)) {Bad ++;}
+	}
+	TEST_EQUAL(Bad, 0);
+
+	/*2^16以下的全部数，以及整个32位范围内按质数步长取的数，在全部长度下与原写法比较，长度比最大位数多6位*/
+	for (Type = 0; Type < 3; Type ++)
+	{
+		for (n = 0; n < (1UL << 16); n ++, Count ++) {Bad += Test_Compare(Type, (uint32_t)n, Test_MaxLength[Type] + 6);}
+		for (n = 1UL << 16; n <= 0xFFFFFFFFULL; n += 65521, Count ++) {Bad += Test_Compare(Type, (uint32_t)n, Test_MaxLength[Type] + 6);}
+		for (i = 0; i < sizeof(Edges) / sizeof(Edges[0]); i ++, Count ++) {Bad += Test_Compare(Type, Edges[i], Test_MaxLength[Type] + 6);}
+	}
+	TEST_EQUAL(Bad, 0);
+	printf("  last decimal digit of all 2^32 values, %u values x all lengths equal to the Pow-based digits\n", Count);
+
+	/*原写法在十进制第11位上10^10溢出为1410065408，不再补0；新的显示函数在这里显示0*/
+	Test_Legacy(String, 1410065408, 11, 10);
+	TEST_ASSERT(strcmp(String, "11410065408") == 0);
+	Format_Dec(String, 1410065408, 11);
+	TEST_ASSERT(strcmp(String, "01410065408") == 0);
+}
+
+static void Test_Display(void)
+{
+	static uint8_t Expect[16][248];
+	static uint8_t OledExpect[8][128];
+
+	/*显示函数超过最大位数时高位显示0，与显示补0后的字符串结果相同*/
+	memset(EPD_DisplayBuf, 0, sizeof(EPD_DisplayBuf));
+	EPD_ShowNum(2, 0, 4294967295UL, 13, EPD_8X16);
+	EPD_ShowSignedNum(2, 20, -2147483647 - 1, 12, EPD_8X16);
+	EPD_ShowHexNum(2, 40, 0xDEADBEEF, 11, EPD_8X16);
+	EPD_ShowBinNum(2, 60, 0x80000001, 35, EPD_6X8);
+	EPD_ShowSignedNum(2, 80, 123, 3, EPD_8X16);
+	memcpy(Expect, EPD_DisplayBuf, sizeof(Expect));
+
+	memset(EPD_DisplayBuf, 0, sizeof(EPD_DisplayBuf));
+	EPD_ShowString(2, 0, "0004294967295", EPD_8X16);
+	EPD_ShowString(2, 20, "-002147483648", EPD_8X16);
+	EPD_ShowString(2, 40, "000DEADBEEF", EPD_8X16);
+	EPD_ShowString(2, 60, "00010000000000000000000000000000001", EPD_6X8);
+	EPD_ShowString(2, 80, "+123", EPD_8X16);
+	TEST_ASSERT(memcmp(Expect, EPD_DisplayBuf, sizeof(Expect)) == 0);
+
+	memset(OLED_DisplayBuf, 0, sizeof(OLED_DisplayBuf));
+	OLED_ShowNum(0, 0, 42, 12, OLED_8X16);
+	OLED_ShowSignedNum(0, 16, -7, 11, OLED_6X8);
+	OLED_ShowHexNum(0, 32, 0xAB, 9, OLED_8X16);
+	OLED_ShowBinNum(0, 48, 5, 33, OLED_6X8);
+	memcpy(OledExpect, OLED_DisplayBuf, sizeof(OledExpect));
+
+	memset(OLED_DisplayBuf, 0, sizeof(OLED_DisplayBuf));
+	OLED_ShowString(0, 0, "000000000042", OLED_8X16);
+	OLED_ShowString(0, 16, "-00000000007", OLED_6X8);
+	OLED_ShowString(0, 32, "0000000AB", OLED_8X16);
+	OLED_ShowString(0, 48, "000000000000000000000000000000101", OLED_6X8);
+	TEST_ASSERT(memcmp(OledExpect, OLED_DisplayBuf, sizeof(OledExpect)) == 0);
+}
+
+/*ShowFloatNum的显示结果，作为比较的基准*/
+static uint8_t Test_FloatBuf[8][128];
+
+static void Test_ShowFloat(double Number, uint8_t IntLength, uint8_t FraLength)
+{
+	memset(OLED_DisplayBuf, 0, sizeof(OLED_DisplayBuf));
+	OLED_ShowFloatNum(0, 0, Number, IntLength, FraLength, OLED_6X8);
+	memcpy(Test_FloatBuf, OLED_DisplayBuf, sizeof(Test_FloatBuf));
+}
+
+/*与基准不同时返回1*/
+static uint32_t Test_FixedDiffers(int32_t Number, uint8_t IntLength, uint8_t FraLength)
+{
+	memset(OLED_DisplayBuf, 0, sizeof(OLED_DisplayBuf));
+	OLED_ShowFixedNum(0, 0, Number, IntLength, FraLength, OLED_6X8);
+	return memcmp(Test_FloatBuf, OLED_DisplayBuf, sizeof(Test_FloatBuf)) != 0;
+}
+
+static uint32_t Test_ScaledDiffers(int32_t Number, uint8_t Scale, uint8_t IntLength, uint8_t FraLength)
+{
+	memset(OLED_DisplayBuf, 0, sizeof(OLED_DisplayBuf));
+	OLED_ShowScaledNum(0, 0, Number, Scale, IntLength, FraLength, OLED_6X8);
+	return memcmp(Test_FloatBuf, OLED_DisplayBuf, sizeof(Test_FloatBuf)) != 0;
+}
+
+/**
+  * 三种小数显示的四舍五入
+  * 十进制的x.xx5（如9.995）不能用double精确表示，直接写成double时会略小于一半，与缩放整数的结果不同，
+  * 所以与ShowFloatNum比较时都取double能精确表示的值：Q16.16的值，以及分母为2的幂的正好一半
+  */
+static void Test_Rounding(void)
+{
+	static const uint32_t Ints[] = {0, 9, 99, 999};
+	static const struct
+	{
+		int32_t Number;
+		uint8_t Scale, IntLength, FraLength;
+		const char *String;
+	} Decimal[] = {
+		{1005, 3, 1, 2, "+1.01"}, {1004, 3, 1, 2, "+1.00"}, {9995, 3, 2, 2, "+10.00"}, {-9995, 3, 2, 2, "-10.00"},
+		{999995, 3, 4, 2, "+1000.00"}, {12345, 4, 1, 3, "+1.235"}, {-12345, 4, 1, 3, "-1.235"},
+		{5, 1, 1, 0, "+1."}, {95, 1, 2, 0, "+10."}, {-5, 3, 1, 2, "-0.01"}, {-4, 3, 1, 2, "-0.00"},
+		{-1, 9, 1, 4, "-0.0000"}, {-50000, 9, 1, 4, "-0.0001"}, {-49999, 9, 1, 4, "-0.0000"},
+	};
+	static const int32_t Small[] = {-1, -2, -3, -327, -328, -3276, -3277, -32767, -32768, -32769, -65535};
+	char String[24];
+	uint32_t Ks[9], Bad = 0, Count = 0, Pow, Five, Center, Fra, i, j, k, m;
+	int32_t Number, Sign, d;
+	uint8_t FraLength;
+
+	for (FraLength = 0, Pow = 1, Five = 5; FraLength <= 4; FraLength ++, Pow *= 10, Five *= 5)
+	{
+		/*一半的位置k + 0.5，k取最小、中间与进位前的几个*/
+		Ks[0] = 0; Ks[1] = 1; Ks[2] = 4; Ks[3] = 5; Ks[4] = 9;
+		Ks[5] = Pow / 2 - 1; Ks[6] = Pow / 2; Ks[7] = Pow - 2; Ks[8] = Pow - 1;
+		for (i = 0; i < sizeof(Ints) / sizeof(Ints[0]); i ++)
+		{
+			for (Sign = 1; Sign >= -1; Sign -= 2)
+			{
+				/*Q16.16：每个十进制一半（k + 0.5）/ 10^FraLength附近的5个值*/
+				for (j = 0; j < 9; j ++)
+				{
+					k = Ks[j];
+					if (k >= Pow) {continue;}
+					Center = ((2 * k + 1) * 65536 + Pow) / (2 * Pow);
+					for (d = -2; d <= 2; d ++, Count ++)
+					{
+						Fra = Center + d;
+						if (Fra >= 65536) {continue;}
+						Number = Sign * (int32_t)(Ints[i] * 65536 + Fra);
+						Test_ShowFloat(Number / 65536.0, 4, FraLength);
+						Bad += Test_FixedDiffers(Number, 4, FraLength);
+					}
+				}
+
+				/*分母为2^(FraLength+1)的正好一半，三种表示都精确，m / 2^(n+1) = m * 5^(n+1) / 10^(n+1)*/
+				for (m = 1; m < 2 * Pow && m < (2U << FraLength); m += 2, Count ++)
+				{
+					Test_ShowFloat(Sign * (Ints[i] + m / (double)(2U << FraLength)), 4, FraLength);
+					Bad += Test_FixedDiffers(Sign * (int32_t)(Ints[i] * 65536 + (m << (15 - FraLength))), 4, FraLength);
+					Bad += Test_ScaledDiffers(Sign * (int32_t)(Ints[i] * Pow * 10 + m * Five), FraLength + 1, 4, FraLength);
+				}
+			}
+		}
+
+		/*接近0的负数，舍入为0时仍显示负号*/
+		for (i = 0; i < sizeof(Small) / sizeof(Small[0]); i ++, Count ++)
+		{
+			Test_ShowFloat(Small[i] / 65536.0, 1, FraLength);
+			Bad += Test_FixedDiffers(Small[i], 1, FraLength);
+		}
+		Test_ShowFloat(-1.0 / 512, 1, FraLength);
+		Bad += Test_ScaledDiffers(-1953125, 9, 1, FraLength);			//-1/512 = -0.001953125
+		Count ++;
+	}
+	TEST_EQUAL(Bad, 0);
+
+	/*缩放整数按十进制精确地四舍五入，一半时远离0*/
+	for (i = 0; i < sizeof(Decimal) / sizeof(Decimal[0]); i ++)
+	{
+		Format_Scaled(String, Decimal[i].Number, Decimal[i].Scale, Decimal[i].IntLength, Decimal[i].FraLength);
+		TEST_ASSERT(strcmp(String, Decimal[i].String) == 0);
+	}
+	printf("  %u values at FraLength 0~4 round the same in ShowFloatNum, ShowFixedNum and ShowScaledNum\n", Count);
+}
+
+/*每位的耗时，单位ns，防止编译器把结果优化掉*/
+static volatile char Test_Sink;
+
+static double Test_Time(uint8_t Type, uint8_t Length, uint8_t Legacy)
+{
+	char String[40];
+	uint32_t n, Count = 2000000 / Length;
+	double Start = Test_Seconds();
+
+	for (n = 0; n < Count; n ++)
+	{
+		if (Legacy) {Test_Legacy(String, n * 2654435761u, Length, Test_Base[Type]);}
+		else {Test_Format(Type, String, n * 2654435761u, Length);}
+		Test_Sink = String[0];
+	}
+	return (Test_Seconds() - Start) * 1e9 / ((double)Count * Length);
+}
+
+static void Test_Speed(void)
+{
+	static const uint8_t Lengths[3][2] = {{5, 10}, {4, 8}, {16, 32}};
+	static const char *const Names[3] = {"Dec", "Hex", "Bin"};
+	double New, Old;
+	uint8_t Type, i;
+
+	for (Type = 0; Type < 3; Type ++)
+	{
+		for (i = 0; i < 2; i ++)
+		{
+			New = Test_Time(Type, Lengths[Type][i], 0);
+			Old = Test_Time(Type, Lengths[Type][i], 1);
+			printf("  Format_%s %2u digits: %5.2f ns/digit, Pow-based %6.2f ns/digit (host, %.1fx)\n",
+				   Names[Type], Lengths[Type][i], New, Old, Old / New);
+		}
+	}
+}
+
+int main(void)
+{
+	Test_Digits();
+	Test_Display();
+	Test_Rounding();
+	Test_Speed();
+	return Test_Result("Test_Format");
+}
@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <string.h>
+#include "Test.h"
+#include "EPD.h"
+#include "EPD_Sim.h"
+#include "Digits.h"
+#include "Power.h"
+
+/**
+  * 休眠占空比与平均电流的主机估算
+  * 按main.c的计数任务，每个周期计数加1、重画变化的数字并局部刷新，由EPD控制器模拟得到每个周期的运行时间
+  * 刷新按Display.c的方式分两步：EPD_UpdateAreaStart发送后返回，BUSY为高期间MCU处于STOP，
+  * BUSY变低唤醒后EPD_UpdateFinish结束刷新，运行时间包括发送数据与其后的10ms延时，其余时间按STOP模式计算
+  * 唤醒与调度本身的耗时没有计入，约为数十us，相比10ms延时可以忽略
+  * 电流取Power.h中的数据手册典型值，只包括MCU，不包括EPD与其他外部器件
+  * 绘制数字的时间在电脑上无法代表单片机的耗时，不计入，相比刷新等待可以忽略
+  * 刷新时间取EPD_SIM_REFRESH_MS，是参考值，实际屏幕的局部刷新可能更短，可在编译时重新定义后再估算
+  */
+
+/*模拟的周期数*/
+#define TEST_PERIODS			100
+
+/*Power_Estimate的加权平均与边界*/
+static void Test_Estimate(void)
+{
+	TEST_EQUAL(Power_Estimate(0, 0), 0);
+	TEST_EQUAL(Power_Estimate(0, 100), 0);
+	TEST_EQUAL(Power_Estimate(1, 0), POWER_STOP_UA);
+	TEST_EQUAL(Power_Estimate(1000, 0), POWER_STOP_UA);
+	TEST_EQUAL(Power_Estimate(1000, 1000), POWER_RUN_UA);
+	TEST_EQUAL(Power_Estimate(1000, 5000), POWER_RUN_UA);			//运行时间超过周期时按一直运行计算
+	TEST_EQUAL(Power_Estimate(2000, 1000), (POWER_RUN_UA + POWER_STOP_UA) / 2);
+	TEST_EQUAL(Power_Estimate(1000, 10), (POWER_RUN_UA * 10 + POWER_STOP_UA * 990) / 1000);
+
+	/*一天的周期按64位计算，不会溢出*/
+	TEST_EQUAL(Power_Estimate(86400000, 86400000 / 4), (POWER_RUN_UA + POWER_STOP_UA * 3) / 4);
+	TEST_EQUAL(Power_Estimate(0xFFFFFFFF, 0xFFFFFFFF), POWER_RUN_UA);
+}
+
+int main(void)
+{
+	static const uint32_t Periods[] = {2000, 5000, 10000, 60000};
+	Digits_t Counter;
+	TextRect_t Dirty;
+	EPD_SimStats_t Last;
+	uint64_t Active = 0, Send = 0;
+	uint32_t i, n, Period, Run, Current, Blocking;
+
+	Test_Estimate();
+
+	EPD_Sim_Reset();
+	EPD_Init();
+	EPD_Clear();
+	Digits_Init(&Counter, &EPD_Canvas, 0, 32, 5, &Font_Prop16);
+	Digits_ShowNum(&Counter, 0, &Dirty);
+	EPD_Update();
+
+	for (n = 1; n <= TEST_PERIODS; n ++)
+	{
+		TEST_ASSERT(Digits_ShowNum(&Counter, n, &Dirty));
+		TEST_ASSERT(EPD_UpdateAreaStart(Dirty.X, Dirty.Y, Dirty.Width, Dirty.Height));
+		EPD_Sim_Delay(EPD_SIM_REFRESH_MS * 1000);				//STOP模式，直到BUSY变低；模拟中读BUSY会跳过忙的时间，期间不读
+		TEST_ASSERT(!EPD_IsBusy());
+		EPD_UpdateFinish();
+		TEST_ASSERT(!EPD_IsBusy());
+		EPD_Sim_GetStats(&Last, NULL);
+		TEST_EQUAL(Last.BusyBytes, 0);
+		TEST_ASSERT(Last.Time > EPD_SIM_REFRESH_MS * 1000);
+		Active += Last.Time - EPD_SIM_REFRESH_MS * 1000;
+		Send += (uint64_t)Last.Writes * EPD_SIM_WRITE_NS / 1000;
+	}
+	Run = (uint32_t)(Active / TEST_PERIODS / 1000);		//每个周期的运行时间，单位ms
+
+	Blocking = Run + EPD_SIM_REFRESH_MS;						//原EPD_UpdateArea空转等待BUSY时的运行时间
+
+	printf("  per update: %.1f ms running (%.2f ms sending), refresh %u ms in STOP\n",
+		   Active / 1000.0 / TEST_PERIODS, Send / 1000.0 / TEST_PERIODS, EPD_SIM_REFRESH_MS);
+	printf("  period    duty    MCU avg   charge/period   (if BUSY were polled)\n");
+	for (i = 0; i < sizeof(Periods) / sizeof(Periods[0]); i ++)
+	{
+		Period = Periods[i];
+		Current = Power_Estimate(Period, Run);
+		printf("  %6u ms %5.1f%% %7u uA %10.1f uC      %5u uA\n",
+			   Period, Run > Period ? 100.0 : Run * 100.0 / Period, Current, Current * (Period / 1000.0),
+			   Power_Estimate(Period, Blocking));
+
+		TEST_ASSERT(Current >= POWER_STOP_UA && Current <= POWER_RUN_UA);
+		TEST_ASSERT(Current * 10 < Power_Estimate(Period, Blocking));
+	}
+
+	/*刷新等待不再计入运行时间，每个周期只运行发送与10ms延时*/
+	TEST_ASSERT(Run >= 10 && Run * 100 < EPD_SIM_REFRESH_MS);
+	return Test_Result("Test_Power");
+}
@@ -0,0 +1,472 @@
+#include <stdio.h>
+#include <string.h>
+#include "Test.h"
+#include "QRCode.h"
+
+/**
+  * QR码的生成与解码测试
+  * QR码画在画布上后按模块读回，检查定位、定时、校正图形与格式、版本信息，
+  * 去掩模、按块解交织并用RS校验子检查每一块，最后按模式解析出字符串与输入比较
+  * 解码使用按标准独立写出的版本参数表与GF(256)对数表，不使用QRCode.c中的表与函数
+  */
+
+/*测试画布*/
+#define TEST_WIDTH				256
+#define TEST_HEIGHT				256
+#define TEST_X					7
+#define TEST_Y					5
+
+static uint8_t Test_Buf[TEST_HEIGHT / 8][TEST_WIDTH];
+static const Canvas_t Test_Canvas = {Test_Buf[0], TEST_WIDTH, TEST_HEIGHT, 0};
+
+/*背景图案，用于检查QR码区域外没有被改写*/
+#define TEST_BACKGROUND			0xA5
+
+#define TEST_BACKGROUND_POINT(Y)	((TEST_BACKGROUND >> ((Y) % 8)) & 0x01)
+
+/*版本1~10的总码字数，以及L、M级每块的纠错码字数与块数*/
+static const uint16_t Test_Total[10] = {26, 44, 70, 100, 134, 172, 196, 242, 292, 346};
+static const uint8_t Test_EccWords[2][10] = {
+	{7, 10, 15, 20, 26, 18, 20, 24, 30, 18},
+	{10, 16, 26, 18, 24, 16, 18, 22, 22, 26},
+};
+static const uint8_t Test_Blocks[2][10] = {
+	{1, 1, 1, 1, 1, 2, 2, 2, 2, 4},
+	{1, 1, 1, 2, 2, 4, 4, 4, 5, 5},
+};
+
+/*版本1~10的字节模式与字母数字模式容量，用于检查自动选择的版本*/
+static const uint16_t Test_ByteCapacity[2][10] = {
+	{17, 32, 53, 78, 106, 134, 154, 192, 230, 271},
+	{14, 26, 42, 62, 84, 106, 122, 152, 180, 213},
+};
+static const uint16_t Test_AlnumCapacity[2][10] = {
+	{25, 47, 77, 114, 154, 195, 224, 279, 335, 395},
+	{20, 38, 61, 90, 122, 154, 178, 221, 262, 311},
+};
+
+static const char Test_AlnumChars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+
+static uint8_t Test_Matrix[QRCODE_MAX_SIZE][QRCODE_MAX_SIZE];
+static uint8_t Test_Function[QRCODE_MAX_SIZE][QRCODE_MAX_SIZE];
+static uint8_t Test_Size;
+
+static uint8_t Test_Exp[512], Test_Log[256];
+
+/*最近一次解码得到的码字（交织顺序）、纠错等级与掩模*/
+static uint8_t Test_Codewords[QRCODE_MAX_CODEWORDS];
+static uint8_t Test_Ecc, Test_Mask;
+
+/*解码成功的QR码数，按纠错等级与版本统计*/
+static uint32_t Test_Decoded[2][10];
+
+static void Test_InitGF(void)
+{
+	uint16_t i, Value = 1;
+
+	for (i = 0; i < 255; i ++)
+	{
+		Test_Exp[i] = Value;
+		Test_Log[Value] = i;
+		Value <<= 1;
+		if (Value & 0x100) {Value ^= 0x11D;}
+	}
+	for (i = 255; i < 512; i ++) {Test_Exp[i] = Test_Exp[i - 255];}
+}
+
+static uint8_t Test_Mul(uint8_t A, uint8_t B)
+{
+	return (A == 0 || B == 0) ? 0 : Test_Exp[Test_Log[A] + Test_Log[B]];
+}
+
+/**
+  * 从画布读回模块矩阵，每个模块的Scale*Scale个点必须同色，返回0表示失败
+  */
+static uint8_t Test_Read(uint8_t Size, uint8_t Scale)
+{
+	uint8_t Row, Col, dx, dy;
+	int16_t i;
+
+	Test_Size = Size;
+	for (Row = 0; Row < Size; Row ++)
+	{
+		for (Col = 0; Col < Size; Col ++)
+		{
+			Test_Matrix[Row][Col] = Canvas_GetPoint(&Test_Canvas, TEST_X + Col * Scale, TEST_Y + Row * Scale);
+			for (dy = 0; dy < Scale; dy ++)
+			{
+				for (dx = 0; dx < Scale; dx ++)
+				{
+					if (Canvas_GetPoint(&Test_Canvas, TEST_X + Col * Scale + dx, TEST_Y + Row * Scale + dy) !=
+						Test_Matrix[Row][Col]) {return 0;}
+				}
+			}
+		}
+	}
+
+	/*四周紧邻的一圈点保持背景不变*/
+	for (i = -1; i <= Size * Scale; i ++)
+	{
+		if (Canvas_GetPoint(&Test_Canvas, TEST_X + i, TEST_Y - 1) != TEST_BACKGROUND_POINT(TEST_Y - 1) ||
+			Canvas_GetPoint(&Test_Canvas, TEST_X + i, TEST_Y + Size * Scale) != TEST_BACKGROUND_POINT(TEST_Y + Size * Scale) ||
+			Canvas_GetPoint(&Test_Canvas, TEST_X - 1, TEST_Y + i) != TEST_BACKGROUND_POINT(TEST_Y + i) ||
+			Canvas_GetPoint(&Test_Canvas, TEST_X + Size * Scale, TEST_Y + i) != TEST_BACKGROUND_POINT(TEST_Y + i)) {return 0;}
+	}
+	return 1;
+}
+
+static uint8_t Test_Module(uint8_t X, uint8_t Y)
+{
+	return Test_Matrix[Y][X];
+}
+
+/**
+  * 读取并核对两份格式信息，返回0表示失败
+  */
+static uint8_t Test_ReadFormat(void)
+{
+	uint16_t First = 0, Second = 0, Data, Remainder, Code;
+	uint8_t i, Size = Test_Size;
+
+	for (i = 0; i <= 5; i ++) {First |= Test_Module(8, i) << i;}
+	First |= Test_Module(8, 7) << 6 | Test_Module(8, 8) << 7 | Test_Module(7, 8) << 8;
+	for (i = 9; i < 15; i ++) {First |= Test_Module(14 - i, 8) << i;}
+	for (i = 0; i < 8; i ++) {Second |= Test_Module(Size - 1 - i, 8) << i;}
+	for (i = 8; i < 15; i ++) {Second |= Test_Module(8, Size - 15 + i) << i;}
+	if (First != Second || Test_Module(8, Size - 8) != 1) {return 0;}
+
+	for (Data = 0; Data < 32; Data ++)
+	{
+		Remainder = Data;
+		for (i = 0; i < 10; i ++) {Remainder = (Remainder << 1) ^ ((Remainder >> 9) * 0x537);}
+		Code = ((Data << 10) | (Remainder & 0x3FF)) ^ 0x5412;
+		if (Code != First) {continue;}
+
+		/*格式信息中L级为01，M级为00，Q、H级不会由编码器生成*/
+		if ((Data >> 3) == 1) {Test_Ecc = QRCODE_ECC_L;}
+		else if ((Data >> 3) == 0) {Test_Ecc = QRCODE_ECC_M;}
+		else {return 0;}
+		Test_Mask = Data & 0x07;
+		return 1;
+	}
+	return 0;
+}
+
+/**
+  * 核对功能图形并标记功能模块，返回0表示失败
+  */
+static uint8_t Test_CheckFunctions(uint8_t Version)
+{
+	static const uint8_t Align[10][3] = {
+		{0}, {6, 18}, {6, 22}, {6, 26}, {6, 30}, {6, 34}, {6, 22, 38}, {6, 24, 42}, {6, 26, 46}, {6, 28, 50},
+	};
+	uint8_t Size = Test_Size, Count = Version == 1 ? 0 : (Version < 7 ? 2 : 3);
+	uint8_t i, j, Corner, Dist;
+	int8_t dx, dy;
+	int16_t X, Y;
+	uint32_t Remainder, Bits;
+
+	memset(Test_Function, 0, sizeof(Test_Function));
+
+	/*定位图形及分隔符*/
+	for (Corner = 0; Corner < 3; Corner ++)
+	{
+		int16_t CX = (Corner == 1) ? Size - 4 : 3, CY = (Corner == 2) ? Size - 4 : 3;
+		for (dy = -4; dy <= 4; dy ++)
+		{
+			for (dx = -4; dx <= 4; dx ++)
+			{
+				X = CX + dx;
+				Y = CY + dy;
+				if (X < 0 || X >= Size || Y < 0 || Y >= Size) {continue;}
+				Dist = (dx < 0 ? -dx : dx) > (dy < 0 ? -dy : dy) ? (dx < 0 ? -dx : dx) : (dy < 0 ? -dy : dy);
+				if (Test_Module(X, Y) != (Dist != 2 && Dist != 4)) {return 0;}
+				Test_Function[Y][X] = 1;
+			}
+		}
+	}
+
+	/*定时图形*/
+	for (i = 0; i < Size; i ++)
+	{
+		if (i >= 8 && i < Size - 8 && (Test_Module(i, 6) != (i % 2 == 0) || Test_Module(6, i) != (i % 2 == 0))) {return 0;}
+		Test_Function[6][i] = Test_Function[i][6] = 1;
+	}
+
+	/*校正图形*/
+	for (i = 0; i < Count; i ++)
+	{
+		for (j = 0; j < Count; j ++)
+		{
+			if ((i == 0 && j == 0) || (i == 0 && j == Count - 1) || (i == Count - 1 && j == 0)) {continue;}
+			for (dy = -2; dy <= 2; dy ++)
+			{
+				for (dx = -2; dx <= 2; dx ++)
+				{
+					X = Align[Version - 1][i] + dx;
+					Y = Align[Version - 1][j] + dy;
+					Dist = (dx < 0 ? -dx : dx) > (dy < 0 ? -dy : dy) ? (dx < 0 ? -dx : dx) : (dy < 0 ? -dy : dy);
+					if (Test_Module(X, Y) != (Dist != 1)) {return 0;}
+					Test_Function[Y][X] = 1;
+				}
+			}
+		}
+	}
+
+	/*格式信息*/
+	for (i = 0; i < 9; i ++) {Test_Function[8][i] = Test_Function[i][8] = 1;}
+	for (i = 0; i < 8; i ++) {Test_Function[8][Size - 1 - i] = Test_Function[Size - 1 - i][8] = 1;}
+
+	/*版本信息*/
+	if (Version >= 7)
+	{
+		Remainder = Version;
+		for (i = 0; i < 12; i ++) {Remainder = (Remainder << 1) ^ ((Remainder >> 11) * 0x1F25);}
+		Bits = ((uint32_t)Version << 12) | (Remainder & 0xFFF);
+		for (i = 0; i < 18; i ++)
+		{
+			if (Test_Module(Size - 11 + i % 3, i / 3) != ((Bits >> i) & 0x01) ||
+				Test_Module(i / 3, Size - 11 + i % 3) != ((Bits >> i) & 0x01)) {return 0;}
+			Test_Function[i / 3][Size - 11 + i % 3] = Test_Function[Size - 11 + i % 3][i / 3] = 1;
+		}
+	}
+	return 1;
+}
+
+static uint8_t Test_MaskBit(uint8_t Mask, uint8_t X, uint8_t Y)
+{
+	switch (Mask)
+	{
+		case 0: return (X + Y) % 2 == 0;
+		case 1: return Y % 2 == 0;
+		case 2: return X % 3 == 0;
+		case 3: return (X + Y) % 3 == 0;
+		case 4: return (X / 3 + Y / 2) % 2 == 0;
+		case 5: return X * Y % 2 + X * Y % 3 == 0;
+		case 6: return (X * Y % 2 + X * Y % 3) % 2 == 0;
+		default: return ((X + Y) % 2 + X * Y % 3) % 2 == 0;
+	}
+}
+
+/*按之字形顺序读出数据区，去掩模后组成码字*/
+static void Test_ReadCodewords(uint8_t Version)
+{
+	uint16_t Count = 0, Total = Test_Total[Version - 1] * 8;
+	int16_t Right, Vert, X, Y, j;
+
+	memset(Test_Codewords, 0, sizeof(Test_Codewords));
+	for (Right = Test_Size - 1; Right >= 1; Right -= 2)
+	{
+		if (Right == 6) {Right = 5;}
+		for (Vert = 0; Vert < Test_Size; Vert ++)
+		{
+			for (j = 0; j < 2; j ++)
+			{
+				X = Right - j;
+				Y = ((Right + 1) & 2) == 0 ? Test_Size - 1 - Vert : Vert;
+				if (Test_Function[Y][X] || Count >= Total) {continue;}
+				if (Test_Module(X, Y) ^ Test_MaskBit(Test_Mask, X, Y))
+				{
+					Test_Codewords[Count / 8] |= 0x80 >> (Count % 8);
+				}
+				Count ++;
+			}
+		}
+	}
+}
+
+/**
+  * 解交织、RS校验并解析数据，返回解出的字符数，失败时返回-1
+  */
+static int Test_Parse(uint8_t Version, char *Out)
+{
+	static uint8_t Data[QRCODE_MAX_CODEWORDS];
+	uint8_t Block[QRCODE_MAX_CODEWORDS];
+	uint16_t Total = Test_Total[Version - 1], EccWords = Test_EccWords[Test_Ecc][Version - 1];
+	uint16_t Blocks = Test_Blocks[Test_Ecc][Version - 1], DataWords = Total - EccWords * Blocks;
+	uint16_t Short = DataWords / Blocks, Long = DataWords % Blocks, b, i, k, Offset = 0, Length;
+	uint32_t Bit = 0, Value, CountBits;
+	uint8_t Syndrome, Mode;
+
+	for (b = 0; b < Blocks; b ++)
+	{
+		/*前Blocks-Long块为短块，后Long块多一个数据码字*/
+		Length = Short + (b >= Blocks - Long);
+		for (i = 0, k = 0; i < Length; i ++)
+		{
+			Block[k ++] = Test_Codewords[i * Blocks + b - (i == Short ? Blocks - Long : 0)];
+		}
+		for (i = 0; i < EccWords; i ++) {Block[k ++] = Test_Codewords[DataWords + i * Blocks + b];}
+
+		for (i = 0; i < EccWords; i ++)
+		{
+			Syndrome = 0;
+			for (k = 0; k < Length + EccWords; k ++) {Syndrome = Test_Mul(Syndrome, Test_Exp[i]) ^ Block[k];}
+			if (Syndrome) {return -1;}
+		}
+		memcpy(Data + Offset, Block, Length);
+		Offset += Length;
+	}
+
+	/*模式指示与字符数*/
+	for (i = 0, Mode = 0; i < 4; i ++, Bit ++) {Mode = (Mode << 1) | ((Data[Bit / 8] >> (7 - Bit % 8)) & 0x01);}
+	if (Mode == 4) {CountBits = Version < 10 ? 8 : 16;}
+	else if (Mode == 2) {CountBits = Version < 10 ? 9 : 11;}
+	else {return -1;}
+
+	Value = 0;
+	for (i = 0; i < CountBits; i ++, Bit ++) {Value = (Value << 1) | ((Data[Bit / 8] >> (7 - Bit % 8)) & 0x01);}
+	Length = Value;
+	if (Bit + (Mode == 4 ? 8 * Length : 11 * (Length / 2) + 6 * (Length % 2)) > DataWords * 8u) {return -1;}
+
+	for (k = 0; k < Length; )
+	{
+		CountBits = (Mode == 4) ? 8 : (k + 1 < Length ? 11 : 6);
+		Value = 0;
+		for (i = 0; i < CountBits; i ++, Bit ++) {Value = (Value << 1) | ((Data[Bit / 8] >> (7 - Bit % 8)) & 0x01);}
+		if (Mode == 4) {Out[k ++] = Value;}
+		else if (CountBits == 11)
+		{
+			if (Value >= 45 * 45) {return -1;}
+			Out[k ++] = Test_AlnumChars[Value / 45];
+			Out[k ++] = Test_AlnumChars[Value % 45];
+		}
+		else
+		{
+			if (Value >= 45) {return -1;}
+			Out[k ++] = Test_AlnumChars[Value];
+		}
+	}
+	Out[Length] = '\0';
+
+	/*终止符（最多4位0）、补齐到字节的0，之后交替填充0xEC、0x11*/
+	for (i = 0; i < 4 && Bit < DataWords * 8u; i ++, Bit ++)
+	{
+		if ((Data[Bit / 8] >> (7 - Bit % 8)) & 0x01) {return -1;}
+	}
+	for (; Bit % 8; Bit ++)
+	{
+		if ((Data[Bit / 8] >> (7 - Bit % 8)) & 0x01) {return -1;}
+	}
+	for (i = 0; Bit < DataWords * 8u; i ++, Bit += 8)
+	{
+		if (Data[Bit / 8] != ((i % 2) ? 0x11 : 0xEC)) {return -1;}
+	}
+	return Length;
+}
+
+/**
+  * 生成、绘制并解码，返回解码得到的版本，失败时返回0
+  */
+static uint8_t Test_Case(const char *Text, uint8_t Ecc, uint8_t Scale)
+{
+	char Out[512];
+	uint8_t Version = QRCode_Encode(Text, Ecc);
+
+	if (Version == 0) {TEST_ASSERT(!"not encoded"); printf("  %u bytes ECC %c not encoded\n", (unsigned)strlen(Text), "LM"[Ecc]); return 0;}
+	TEST_EQUAL(QRCode_GetSize(), Version * 4 + 17);
+
+	memset(Test_Buf, TEST_BACKGROUND, sizeof(Test_Buf));
+	QRCode_Draw(&Test_Canvas, TEST_X, TEST_Y, Scale);
+
+	if (!Test_Read(QRCode_GetSize(), Scale)) {TEST_ASSERT(!"module not solid or drawn outside"); return 0;}
+	if (!Test_ReadFormat()) {TEST_ASSERT(!"format information"); return 0;}
+	if (!Test_CheckFunctions(Version)) {TEST_ASSERT(!"function patterns"); return 0;}
+	TEST_EQUAL(Test_Ecc, Ecc);
+
+	Test_ReadCodewords(Version);
+	if (Test_Parse(Version, Out) < 0 || strcmp(Out, Text))
+	{
+		TEST_ASSERT(!"decode");
+		printf("  v%u-%c \"%.40s\" decoded wrong\n", Version, "LM"[Ecc], Text);
+		return 0;
+	}
+	Test_Decoded[Ecc][Version - 1] ++;
+	return Version;
+}
+
+/*固定种子的伪随机数，保证每次运行的测试内容相同*/
+static uint32_t Test_Seed = 1;
+static uint32_t Test_Random(uint32_t n)
+{
+	Test_Seed = Test_Seed * 1103515245 + 12345;
+	return (Test_Seed >> 16) % n;
+}
+
+/*生成指定长度的字节模式或字母数字模式字符串*/
+static void Test_MakeText(char *Text, uint16_t Length, uint8_t Alnum)
+{
+	uint16_t i;
+
+	for (i = 0; i < Length; i ++)
+	{
+		Text[i] = Alnum ? Test_AlnumChars[Test_Random(45)] : 'a' + Test_Random(26);
+		if (!Alnum && Test_Random(4) == 0) {Text[i] = 1 + Test_Random(255);}
+	}
+	Text[Length] = '\0';
+}
+
+int main(void)
+{
+	/*常见QR码教程中的示例：“HELLO WORLD”版本1-M的16个数据码字与10个纠错码字*/
+	static const uint8_t Hello[26] = {
+		32, 91, 11, 120, 209, 114, 220, 77, 67, 64, 236, 17, 236, 17, 236, 17,
+		196, 35, 39, 119, 235, 215, 231, 226, 93, 23,
+	};
+	static const uint8_t Versions[] = {1, 5, 10};
+	char Text[512];
+	uint8_t Ecc, Alnum, i, Version;
+	uint16_t Capacity, n;
+
+	Test_InitGF();
+
+	TEST_EQUAL(Test_Case("HELLO WORLD", QRCODE_ECC_M, 1), 1);
+	TEST_ASSERT(memcmp(Test_Codewords, Hello, sizeof(Hello)) == 0);
+	TEST_EQUAL(Test_Case("https://example.com/", QRCODE_ECC_L, 2), 2);
+	TEST_EQUAL(Test_Case("A", QRCODE_ECC_M, 3), 1);
+	TEST_EQUAL(Test_Case("", QRCODE_ECC_L, 1), 1);
+
+	/*版本1、5、10的容量边界：刚好装满时为该版本，多一个字符时升一版，版本10装满后多一个字符失败*/
+	for (Ecc = QRCODE_ECC_L; Ecc <= QRCODE_ECC_M; Ecc ++)
+	{
+		for (Alnum = 0; Alnum <= 1; Alnum ++)
+		{
+			for (i = 0; i < sizeof(Versions); i ++)
+			{
+				Version = Versions[i];
+				Capacity = Alnum ? Test_AlnumCapacity[Ecc][Version - 1] : Test_ByteCapacity[Ecc][Version - 1];
+				Test_MakeText(Text, Capacity, Alnum);
+				TEST_EQUAL(Test_Case(Text, Ecc, Version == 10 ? 4 : 2), Version);
+
+				Test_MakeText(Text, Capacity + 1, Alnum);
+				if (Version < 10) {TEST_EQUAL(Test_Case(Text, Ecc, 1), Version + 1);}
+				else {TEST_EQUAL(QRCode_Encode(Text, Ecc), 0);}
+			}
+		}
+	}
+
+	/*随机长度，覆盖全部10个版本*/
+	for (n = 0; n < 400; n ++)
+	{
+		Ecc = Test_Random(2);
+		Alnum = Test_Random(2);
+		Capacity = Alnum ? Test_AlnumCapacity[Ecc][9] : Test_ByteCapacity[Ecc][9];
+		Test_MakeText(Text, 1 + Test_Random(Capacity), Alnum);
+		Version = Test_Case(Text, Ecc, 1 + Test_Random(4));
+
+		/*自动选择的是能容纳字符串的最小版本*/
+		if (Version > 1)
+		{
+			Capacity = Alnum ? Test_AlnumCapacity[Ecc][Version - 2] : Test_ByteCapacity[Ecc][Version - 2];
+			TEST_ASSERT(strlen(Text) > Capacity);
+		}
+	}
+
+	for (Ecc = QRCODE_ECC_L; Ecc <= QRCODE_ECC_M; Ecc ++)
+	{
+		printf("  decoded ECC %c by version:", "LM"[Ecc]);
+		for (i = 0; i < 10; i ++) {printf(" %u", Test_Decoded[Ecc][i]);}
+		printf("\n");
+	}
+	return Test_Result("Test_QRCode");
+}
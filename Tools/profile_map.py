@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Map a Profile_Dump histogram to functions using the .axf symbol table.
+
+Usage: python profile_map.py Objects/Bench.axf profile.txt [count]
+
+profile.txt is the serial output captured while Profile_Dump ran; any lines
+before "profile ..." and after "end" are ignored.  A bucket covers
+2^PROFILE_SHIFT bytes; when several functions overlap it, its samples are
+split between them in proportion to the bytes each one occupies in the
+bucket, so small helpers next to large functions still show up.  Samples
+are therefore fractional.  Lower PROFILE_SHIFT in Profile.h for sharper
+attribution.
+"""
+
+import struct
+import sys
+
+
+def read_functions(path):
+    """Return a sorted list of (start, end, name) for STT_FUNC symbols."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:4] != b'\x7fELF' or data[4] != 1:
+        raise SystemExit('%s: not a 32-bit ELF file' % path)
+    shoff, = struct.unpack_from('<I', data, 0x20)
+    shentsize, shnum = struct.unpack_from('<HH', data, 0x2E)
+
+    sections = [struct.unpack_from('<IIIIIIIIII', data, shoff + i * shentsize)
+                for i in range(shnum)]
+    funcs = {}
+    for sh in sections:
+        if sh[1] != 2:                          # SHT_SYMTAB
+            continue
+        strtab = sections[sh[6]]                # sh_link
+        stroff = strtab[4]
+        for off in range(sh[4], sh[4] + sh[5], 16):
+            name, value, size, info, _, _ = struct.unpack_from('<IIIBBH', data, off)
+            if info & 0x0F != 2:                # STT_FUNC
+                continue
+            end = data.index(b'\0', stroff + name)
+            funcs[value & ~1] = (size, data[stroff + name:end].decode())
+    result = []
+    starts = sorted(funcs)
+    for i, start in enumerate(starts):
+        size, name = funcs[start]
+        end = start + size if size else (starts[i + 1] if i + 1 < len(starts) else start + 1)
+        result.append((start, end, name))
+    return result
+
+
+def read_dump(path):
+    """Return (total, outside, shift, {address: count}) from a Profile_Dump capture."""
+    buckets = {}
+    total = outside = shift = None
+    with open(path, errors='replace') as f:
+        for line in f:
+            words = line.split()
+            if words[:1] == ['profile'] and len(words) == 5:
+                shift, total, outside = int(words[2]), int(words[3]), int(words[4])
+                buckets = {}
+            elif words[:1] == ['end']:
+                if total is not None:
+                    break
+            elif total is not None and len(words) == 2:
+                buckets[int(words[0], 16)] = int(words[1])
+    if total is None:
+        raise SystemExit('%s: no "profile" header found' % path)
+    return total, outside, shift, buckets
+
+
+def split_bucket(funcs, starts, address, size):
+    """Return [(name, bytes)] for the functions overlapping [address, address + size)."""
+    end = address + size
+    lo, hi = 0, len(starts)
+    while lo < hi:                              # first function starting at or after end
+        mid = (lo + hi) // 2
+        if starts[mid] < end:
+            lo = mid + 1
+        else:
+            hi = mid
+    parts = []
+    i = lo - 1
+    while i >= 0:
+        start, stop, name = funcs[i]
+        overlap = min(stop, end) - max(start, address)
+        if overlap > 0:
+            parts.append((name, overlap))
+        if stop <= address and start < address - 0x1000:
+            break                               # functions this far back cannot overlap
+        i -= 1
+    return parts
+
+
+def main():
+    if len(sys.argv) < 3:
+        raise SystemExit(__doc__)
+    funcs = read_functions(sys.argv[1])
+    total, outside, shift, buckets = read_dump(sys.argv[2])
+    count = int(sys.argv[3]) if len(sys.argv) > 3 else 30
+
+    hits = {}
+    starts = [f[0] for f in funcs]
+    for address, samples in buckets.items():
+        parts = split_bucket(funcs, starts, address, 1 << shift)
+        covered = sum(n for _, n in parts)
+        if not parts:
+            hits['?'] = hits.get('?', 0) + samples
+        for name, n in parts:
+            hits[name] = hits.get(name, 0) + samples * float(n) / covered
+    if outside:
+        hits['(outside)'] = outside
+
+    print('%d samples' % total)
+    print('%8s %7s  %s' % ('samples', '%', 'function'))
+    for name, samples in sorted(hits.items(), key=lambda x: -x[1])[:count]:
+        print('%8.1f %6.2f%%  %s' % (samples, samples * 100.0 / max(total, 1), name))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,240 @@
+#include "Ambient.h"
+#include "Light_Senor.h"
+#include "EPD.h"
+#include "OLED.h"
+#include "Sched.h"
+#include "Display.h"
+
+/*任务事件*/
+#define AMBIENT_EVENT_SAMPLE		0x01		//开始一次采样
+#define AMBIENT_EVENT_BURST_END		0x02		//采样结束
+
+/*全局变量*********************/
+
+static Ambient_Config_t Ambient_Config = {
+	AMBIENT_DARK_BELOW, AMBIENT_BRIGHT_ABOVE, AMBIENT_SAMPLE_PERIOD, AMBIENT_MAX_DEFER,
+	AMBIENT_CONTRAST_MIN, AMBIENT_CONTRAST_MAX, 0,
+};
+static Ambient_Stats_t Ambient_Stats;
+
+static uint8_t Ambient_TaskId = SCHED_INVALID;
+static uint8_t Ambient_Dark;			//当前是否为暗，采样之前视为亮
+static uint8_t Ambient_Burst;			//是否正在采样，期间PA0为模拟输入
+static uint8_t Ambient_FlushReq;		//采样期间调用了Ambient_Flush，采样结束后执行
+static uint16_t Ambient_Contrast;		//上次设置的对比度，0x100表示还未设置
+
+/*待刷新的区域，Full为1时全屏刷新*/
+static uint8_t Ambient_Pending;
+static uint8_t Ambient_Full;
+static int16_t Ambient_X0, Ambient_Y0, Ambient_X1, Ambient_Y1;
+static uint32_t Ambient_Since;			//最早一个未执行的请求的时刻
+
+/*********************全局变量*/
+
+
+/*工具函数*********************/
+
+/**
+  * 函    数：执行待刷新的请求
+  * 参    数：Forced 是否因推迟超时而执行
+  * 返 回 值：无
+  * 说    明：交给显示任务异步刷新，立即返回
+  */
+static void Ambient_Refresh(uint8_t Forced)
+{
+	if (!Ambient_Pending) {return;}
+	
+	if (Ambient_Full)
+	{
+		Display_RequestFull();
+	}
+	else
+	{
+		Display_Request(Ambient_X0, Ambient_Y0, Ambient_X1 - Ambient_X0, Ambient_Y1 - Ambient_Y0);
+	}
+	Ambient_Pending = 0;
+	Ambient_Full = 0;
+	Ambient_Stats.Refreshes ++;
+	if (Forced) {Ambient_Stats.Forced ++;}
+}
+
+/**
+  * 函    数：按亮度设置OLED对比度
+  * 参    数：Value 滤波后的亮度
+  * 返 回 值：无
+  * 说    明：对比度在ContrastMin到ContrastMax之间线性变化，与上次相同时不发送命令
+  */
+static void Ambient_SetContrast(uint16_t Value)
+{
+	uint8_t Contrast;
+	
+	if (!Ambient_Config.Oled) {return;}
+	Contrast = Ambient_Config.ContrastMin
+			 + (uint32_t)(Ambient_Config.ContrastMax - Ambient_Config.ContrastMin) * Value / 0xFFFF;
+	if (Contrast != Ambient_Contrast)
+	{
+		OLED_SetContrast(Contrast);
+		Ambient_Contrast = Contrast;
+	}
+}
+
+/**
+  * 函    数：策略任务
+  * 参    数：Events 收到的事件
+  * 返 回 值：无
+  * 说    明：采样开始时暂停显示任务的发送并打开ADC，AMBIENT_BURST_MS后关闭ADC、恢复EPD引脚与发送，
+  *           取出亮暗事件更新状态，再决定是否执行推迟的刷新
+  *           任务只有一个定时器，采样开始与结束交替设置单次定时
+  */
+static void Ambient_Task(uint32_t Events)
+{
+	LightSenor_Event_t Event;
+	
+	if ((Events & AMBIENT_EVENT_SAMPLE) && !Ambient_Burst)
+	{
+		Ambient_Burst = 1;
+		Display_Hold();
+		LightSenor_Start();
+		Sched_SetTimer(Ambient_TaskId, AMBIENT_BURST_MS, TICK_ONESHOT, AMBIENT_EVENT_BURST_END);
+	}
+	
+	if ((Events & AMBIENT_EVENT_BURST_END) && Ambient_Burst)
+	{
+		LightSenor_Stop();
+		EPD_Resume();
+		Display_Release();
+		Ambient_Burst = 0;
+		Ambient_Stats.Samples ++;
+		
+		while (LightSenor_Read(&Event))
+		{
+			Ambient_Dark = (Event.Type == LIGHTSENOR_EVENT_DARK);
+		}
+		if (LightSenor_GetCount()) {Ambient_SetContrast(LightSenor_GetValue());}
+		
+		if (!Ambient_Dark || Ambient_FlushReq)
+		{
+			Ambient_Refresh(0);
+			Ambient_FlushReq = 0;
+		}
+		else if (Ambient_Pending && Ambient_Config.MaxDefer
+				 && Tick_Millis() - Ambient_Since >= Ambient_Config.MaxDefer)
+		{
+			Ambient_Refresh(1);
+		}
+		
+		Sched_SetTimer(Ambient_TaskId, Ambient_Config.SamplePeriod - AMBIENT_BURST_MS,
+					   TICK_ONESHOT, AMBIENT_EVENT_SAMPLE);
+	}
+}
+
+/*********************工具函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：环境光策略初始化
+  * 参    数：Config 配置，为0时使用AMBIENT_*的默认值（不调节OLED），调用后不再需要保留
+  * 参    数：Priority 策略任务的优先级，范围：0~SCHED_PRIORITIES-1
+  * 返 回 值：策略任务的编号，任务已满时返回SCHED_INVALID
+  * 说    明：需在Sched_Init之后、EPD初始化与Display_Init之后调用，调用后立即开始第一次采样
+  *           调节OLED对比度时需先调用OLED_Init
+  */
+uint8_t Ambient_Init(const Ambient_Config_t *Config, uint8_t Priority)
+{
+	if (Config) {Ambient_Config = *Config;}
+	Ambient_Contrast = 0x100;
+	
+	LightSenor_AnalogInit();
+	LightSenor_SetThreshold(Ambient_Config.DarkBelow, Ambient_Config.BrightAbove);
+	
+	Ambient_TaskId = Sched_Add("Ambient", Ambient_Task, Priority);
+	Sched_Post(Ambient_TaskId, AMBIENT_EVENT_SAMPLE);
+	return Ambient_TaskId;
+}
+
+/**
+  * 函    数：请求刷新EPD的指定区域
+  * 参    数：X 区域左上角的横坐标，范围：0~247
+  * 参    数：Y 区域左上角的纵坐标，范围：0~127
+  * 参    数：Width 区域宽度，范围：0~248
+  * 参    数：Height 区域高度，范围：0~128
+  * 返 回 值：无
+  * 说    明：代替EPD_UpdateArea，显存应已写好
+  *           亮时立即交给显示任务刷新（正在采样时在采样结束后交给显示任务），不等待刷新完成
+  *           暗时与之前未执行的请求合并为包含两者的矩形，等待光线恢复
+  */
+void Ambient_Request(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
+{
+	Ambient_Stats.Requests ++;
+	
+	if (!Ambient_Pending)
+	{
+		Ambient_Pending = 1;
+		Ambient_Since = Tick_Millis();
+		Ambient_X0 = X;
+		Ambient_Y0 = Y;
+		Ambient_X1 = X + Width;
+		Ambient_Y1 = Y + Height;
+	}
+	else
+	{
+		if (X < Ambient_X0) {Ambient_X0 = X;}
+		if (Y < Ambient_Y0) {Ambient_Y0 = Y;}
+		if (X + Width > Ambient_X1) {Ambient_X1 = X + Width;}
+		if (Y + Height > Ambient_Y1) {Ambient_Y1 = Y + Height;}
+	}
+	
+	if (!Ambient_Dark && !Ambient_Burst) {Ambient_Refresh(0);}
+}
+
+/**
+  * 函    数：请求全屏刷新EPD
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：代替EPD_Update，推迟规则与Ambient_Request相同，合并后整体执行一次全屏刷新
+  */
+void Ambient_RequestFull(void)
+{
+	Ambient_Full = 1;
+	Ambient_Request(0, 0, 248, 128);
+}
+
+/**
+  * 函    数：立即执行推迟的刷新
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：不论亮暗，如按键操作说明有人在看屏幕时调用，正在采样时在采样结束后执行
+  */
+void Ambient_Flush(void)
+{
+	if (Ambient_Burst)
+	{
+		Ambient_FlushReq = 1;
+		return;
+	}
+	Ambient_Refresh(0);
+}
+
+/**
+  * 函    数：获取当前是否为暗
+  * 参    数：无
+  * 返 回 值：1：暗，EPD刷新被推迟，0：亮
+  */
+uint8_t Ambient_IsDark(void)
+{
+	return Ambient_Dark;
+}
+
+/**
+  * 函    数：获取统计
+  * 参    数：无
+  * 返 回 值：统计数据，从初始化开始累计
+  */
+const Ambient_Stats_t *Ambient_GetStats(void)
+{
+	return &Ambient_Stats;
+}
+
+/*********************功能函数*/
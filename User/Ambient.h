@@ -0,0 +1,67 @@
+#ifndef __AMBIENT_H
+#define __AMBIENT_H
+
+#include <stdint.h>
+
+/**
+  * 环境光显示策略
+  * 每隔一段时间用光敏传感器采样一小段时间，按带回差的阈值判断环境亮暗：
+  * 亮时EPD的刷新请求立即执行；暗时（无人观看）请求只记录下来，多次请求的区域合并，
+  * 光线恢复或推迟时间超过上限时合并为一次刷新，减少EPD的刷新次数与耗电
+  * 同时按亮度线性调节OLED的对比度
+  * EPD的刷新都应通过Ambient_Request/Ambient_RequestFull发出，执行时交给Display模块异步刷新，不阻塞调用者
+  * 采样期间用Display_Hold暂停发送，保证不在PA0用于ADC采样时向EPD发送数据
+  */
+
+/*参数宏定义*********************/
+
+/*默认配置，Ambient_Init的Config参数为0时使用*/
+#define AMBIENT_DARK_BELOW			0x1000		//亮度低于此值变为暗
+#define AMBIENT_BRIGHT_ABOVE		0x1800		//亮度高于此值变为亮，与上一项之差为回差
+#define AMBIENT_SAMPLE_PERIOD		5000		//采样周期，单位ms
+#define AMBIENT_MAX_DEFER			600000		//暗时最长推迟时间，单位ms，0为一直推迟到变亮
+#define AMBIENT_CONTRAST_MIN		0x08		//最暗时的OLED对比度
+#define AMBIENT_CONTRAST_MAX		0xFF		//最亮时的OLED对比度
+
+/*每次采样ADC工作的时间，单位ms，期间约输出9个滤波值*/
+#define AMBIENT_BURST_MS			50
+
+/*********************参数宏定义*/
+
+
+/*配置与统计*********************/
+
+typedef struct
+{
+	uint16_t DarkBelow;			//亮度低于此值变为暗，亮度为LightSenor_GetValue的值
+	uint16_t BrightAbove;		//亮度高于此值变为亮
+	uint32_t SamplePeriod;		//采样周期，单位ms，应大于AMBIENT_BURST_MS
+	uint32_t MaxDefer;			//暗时最长推迟时间，单位ms，按采样周期检查，0为一直推迟到变亮
+	uint8_t ContrastMin;		//最暗时的OLED对比度
+	uint8_t ContrastMax;		//最亮时的OLED对比度
+	uint8_t Oled;				//是否调节OLED对比度，1：调节，0：不使用OLED
+} Ambient_Config_t;
+
+typedef struct
+{
+	uint32_t Requests;			//收到的刷新请求数
+	uint32_t Refreshes;			//实际执行的刷新次数，与请求数之差即节省的刷新次数
+	uint32_t Forced;			//因推迟时间超过上限而在暗时执行的刷新次数
+	uint32_t Samples;			//采样次数
+} Ambient_Stats_t;
+
+/*********************配置与统计*/
+
+
+/*函数声明*********************/
+
+uint8_t Ambient_Init(const Ambient_Config_t *Config, uint8_t Priority);
+void Ambient_Request(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
+void Ambient_RequestFull(void);
+void Ambient_Flush(void);
+uint8_t Ambient_IsDark(void);
+const Ambient_Stats_t *Ambient_GetStats(void);
+
+/*********************函数声明*/
+
+#endif
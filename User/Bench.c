@@ -0,0 +1,275 @@
+#include "Bench.h"
+
+#ifdef BENCH
+
+#include "stm32f10x.h"
+#include "EPD.h"
+#include "OLED.h"
+#include "Canvas.h"
+#include "Format.h"
+#include "Serial.h"
+#include "Cycle.h"
+#include "Trace.h"
+#include "Profile.h"
+
+/*测试项描述*********************/
+
+typedef struct
+{
+	const char *Name;		//名称
+	void (*Func)(void);		//测试函数
+	uint16_t Bytes;			//向屏幕发送的显存字节数，不发送时为0
+} Bench_t;
+
+/*********************测试项描述*/
+
+
+/*测试函数*********************/
+
+/*每个测试函数的内容固定，不依赖上一次运行的结果，保证多次运行、不同版本之间可比*/
+
+static void Bench_Empty(void)
+{
+}
+
+static void Bench_EPD_Update(void)
+{
+	EPD_Update();
+}
+
+static void Bench_EPD_UpdateArea(void)
+{
+	EPD_UpdateArea(0, 0, 64, 16);
+}
+
+static void Bench_EPD_Clear(void)
+{
+	EPD_Clear();
+}
+
+static void Bench_EPD_Text16(void)
+{
+	uint8_t i;
+	for (i = 0; i < 8; i ++)
+	{
+		EPD_ShowString(0, i * 16, "The quick brown fox jumps over ", EPD_8X16);
+	}
+}
+
+static void Bench_EPD_Text8(void)
+{
+	uint8_t i;
+	for (i = 0; i < 16; i ++)
+	{
+		EPD_ShowString(0, i * 8, "The quick brown fox jumps over the lazy d", EPD_6X8);
+	}
+}
+
+static void Bench_EPD_Image(void)
+{
+	uint8_t i;
+	for (i = 0; i < 15; i ++)
+	{
+		EPD_ShowImage(i * 16, 3, 16, 16, Diode);
+	}
+}
+
+static void Bench_EPD_ZoomImage(void)
+{
+	Canvas_DrawZoomImage(&EPD_Canvas, 0, 0, 16, 16, Diode, 4);
+}
+
+static void Bench_EPD_FillRect(void)
+{
+	Canvas_FillRect(&EPD_Canvas, 0, 3, 248, 122, 1);
+}
+
+static void Bench_EPD_ShowNum(void)
+{
+	uint8_t i;
+	for (i = 0; i < 8; i ++)
+	{
+		EPD_ShowNum(0, i * 16, 1234567890, 10, EPD_8X16);
+	}
+}
+
+static void Bench_EPD_Printf(void)
+{
+	uint8_t i;
+	for (i = 0; i < 8; i ++)
+	{
+		EPD_Printf(0, i * 16, EPD_8X16, "%5d %04X %.2f", -1234, 0xBEEF, 0x0003243F);
+	}
+}
+
+static void Bench_OLED_Update(void)
+{
+	OLED_Update();
+}
+
+static void Bench_OLED_Clear(void)
+{
+	OLED_Clear();
+}
+
+static void Bench_OLED_Text16(void)
+{
+	uint8_t i;
+	for (i = 0; i < 4; i ++)
+	{
+		OLED_ShowString(0, i * 16, "The quick brown ", OLED_8X16);
+	}
+}
+
+static void Bench_OLED_Rectangle(void)
+{
+	OLED_DrawRectangle(0, 0, 128, 64, OLED_FILLED);
+}
+
+static void Bench_OLED_Circle(void)
+{
+	OLED_DrawCircle(64, 32, 30, OLED_FILLED);
+}
+
+static void Bench_OLED_Ellipse(void)
+{
+	OLED_DrawEllipse(64, 32, 60, 30, OLED_FILLED);
+}
+
+static void Bench_OLED_Triangle(void)
+{
+	OLED_DrawTriangle(0, 63, 64, 0, 127, 63, OLED_FILLED);
+}
+
+static void Bench_OLED_Lines(void)
+{
+	uint8_t i;
+	for (i = 0; i < 16; i ++)
+	{
+		OLED_DrawLine(0, 0, 127, i * 4);
+	}
+}
+
+static void Bench_OLED_Image(void)
+{
+	uint8_t i;
+	for (i = 0; i < 8; i ++)
+	{
+		OLED_ShowImage(i * 16, 3, 16, 16, Diode);
+	}
+}
+
+static void Bench_Format(void)
+{
+	char String[12];
+	uint8_t i;
+	for (i = 0; i < 100; i ++)
+	{
+		Format_Dec(String, 1234567890, 10);
+	}
+}
+
+/*测试项列表，增加测试项时加在末尾，保持已有测试项的顺序与名称不变*/
+static const Bench_t Bench_List[] = {
+	{"EPD_Update",				Bench_EPD_Update,		3968},
+	{"EPD_UpdateArea 64x16",	Bench_EPD_UpdateArea,	128},
+	{"EPD_Clear",				Bench_EPD_Clear,		0},
+	{"EPD_ShowString 8x16 x8",	Bench_EPD_Text16,		0},
+	{"EPD_ShowString 6x8 x16",	Bench_EPD_Text8,		0},
+	{"EPD_ShowImage 16x16 x15",	Bench_EPD_Image,		0},
+	{"Canvas_DrawZoomImage x4",	Bench_EPD_ZoomImage,	0},
+	{"Canvas_FillRect 248x122",	Bench_EPD_FillRect,		0},
+	{"EPD_ShowNum 10 x8",		Bench_EPD_ShowNum,		0},
+	{"EPD_Printf x8",			Bench_EPD_Printf,		0},
+	{"OLED_Update",				Bench_OLED_Update,		1024},
+	{"OLED_Clear",				Bench_OLED_Clear,		0},
+	{"OLED_ShowString 8x16 x4",	Bench_OLED_Text16,		0},
+	{"OLED_DrawRectangle fill",	Bench_OLED_Rectangle,	0},
+	{"OLED_DrawCircle r30 fill",	Bench_OLED_Circle,		0},
+	{"OLED_DrawEllipse fill",	Bench_OLED_Ellipse,		0},
+	{"OLED_DrawTriangle fill",	Bench_OLED_Triangle,	0},
+	{"OLED_DrawLine x16",		Bench_OLED_Lines,		0},
+	{"OLED_ShowImage 16x16 x8",	Bench_OLED_Image,		0},
+	{"Format_Dec x100",			Bench_Format,			0},
+};
+
+/*********************测试函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：运行全部测试项
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：每项输出一行：名称、最小周期数、最大周期数、最小周期对应的微秒数、
+  *           发送的显存字节数及其吞吐率（字节/毫秒，即KB/s）
+  *           测得的周期数已减去计时本身的开销
+  *           EPD的更新函数包含等待BUSY的刷新时间
+  *           同时定义TRACE时，最后输出跟踪缓冲区，可看到更新内部各阶段的耗时
+  *           同时定义PROFILE时，测试期间以10kHz采样PC，最后输出直方图，采样中断会使测得的周期数略有增加
+  */
+void Bench_Run(void)
+{
+	uint32_t Start, Cycles, Min, Max, Overhead, Us;
+	uint8_t i, k;
+	
+	Cycle_Init();
+	Trace_Init();
+	Profile_Init(10000);
+	Serial_Init();
+	EPD_Init();
+	OLED_Init();
+	
+	/*计时开销，即测一个空函数的周期数*/
+	Overhead = 0xFFFFFFFF;
+	for (k = 0; k < BENCH_REPEAT; k ++)
+	{
+		Start = CYCLE_GET();
+		Bench_Empty();
+		Cycles = CYCLE_GET() - Start;
+		if (Cycles < Overhead) {Overhead = Cycles;}
+	}
+	
+	Serial_Printf("\r\nBench %s %s, %uHz, repeat %d, overhead %u\r\n",
+				  __DATE__, __TIME__, SystemCoreClock, BENCH_REPEAT, Overhead);
+	Serial_Printf("%-26s%12s%12s%10s%8s%8s\r\n", "name", "min cyc", "max cyc", "min us", "bytes", "KB/s");
+	
+	Profile_Start();
+	for (i = 0; i < sizeof(Bench_List) / sizeof(Bench_List[0]); i ++)
+	{
+		Min = 0xFFFFFFFF;
+		Max = 0;
+		for (k = 0; k < BENCH_REPEAT; k ++)
+		{
+			Start = CYCLE_GET();
+			Bench_List[i].Func();
+			Cycles = CYCLE_GET() - Start - Overhead;
+			if (Cycles < Min) {Min = Cycles;}
+			if (Cycles > Max) {Max = Cycles;}
+		}
+		
+		Us = Cycle_ToUs(Min);
+		Serial_Printf("%-26s%12u%12u%10u", Bench_List[i].Name, Min, Max, Us);
+		if (Bench_List[i].Bytes && Us)
+		{
+			Serial_Printf("%8u%8u\r\n", Bench_List[i].Bytes, (uint32_t)Bench_List[i].Bytes * 1000 / Us);
+		}
+		else
+		{
+			Serial_Printf("%8s%8s\r\n", "-", "-");
+		}
+	}
+	Profile_Stop();
+	Serial_Printf("Bench done\r\n");
+	
+	/*同时定义了TRACE时，输出测试过程中记录的跟踪事件*/
+	Trace_Dump(Serial_Put, 0);
+	
+	/*同时定义了PROFILE时，输出PC采样直方图，用Tools/profile_map.py映射到函数*/
+	Profile_Dump(Serial_Put, 0);
+}
+
+/*********************功能函数*/
+
+#endif
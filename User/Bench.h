@@ -0,0 +1,27 @@
+#ifndef __BENCH_H
+#define __BENCH_H
+
+#include <stdint.h>
+
+/**
+  * 性能测试
+  * 仅在定义BENCH宏时编译，对应Keil工程中的Bench目标
+  * 上电后依次运行固定的测试项，每项重复BENCH_REPEAT次，用DWT周期计数器计时
+  * 结果通过USART1（PA9，115200）输出，格式固定，可直接比对不同版本固件的输出
+  */
+
+/*参数宏定义*********************/
+
+/*每个测试项的重复次数，输出其中的最小值与最大值*/
+#define BENCH_REPEAT			5
+
+/*********************参数宏定义*/
+
+
+/*函数声明*********************/
+
+void Bench_Run(void);
+
+/*********************函数声明*/
+
+#endif
@@ -0,0 +1,236 @@
+#include "stm32f10x.h"                  // Device header
+#include "Display.h"
+#include "EPD.h"
+#include "Sched.h"
+
+/*任务事件*/
+#define DISPLAY_EVENT_REQUEST		0x01		//有新的刷新请求
+#define DISPLAY_EVENT_BUSY			0x02		//BUSY出现下降沿
+#define DISPLAY_EVENT_CHECK			0x04		//定时检查BUSY
+
+/*全局变量*********************/
+
+static Display_Stats_t Display_Stats;
+
+static uint8_t Display_TaskId = SCHED_INVALID;
+static uint8_t Display_Refreshing;		//是否有已开始、未结束的刷新
+static uint8_t Display_Held;			//是否暂停发送，由Display_Hold置1
+
+/*待发送的区域，Full为1时全屏刷新*/
+static uint8_t Display_Pending;
+static uint8_t Display_Full;
+static int16_t Display_X0, Display_Y0, Display_X1, Display_Y1;
+
+/*********************全局变量*/
+
+
+/*工具函数*********************/
+
+/**
+  * 函    数：发送待刷新的区域并开始刷新
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：发出刷新命令后立即返回，区域完全在屏幕外时不刷新
+  */
+static void Display_Start(void)
+{
+	uint8_t Started = 1;
+	
+	/*合并后的矩形先裁剪到屏幕范围内，宽高才能放进uint8_t*/
+	if (Display_X0 < 0) {Display_X0 = 0;}
+	if (Display_Y0 < 0) {Display_Y0 = 0;}
+	if (Display_X1 > 248) {Display_X1 = 248;}
+	if (Display_Y1 > 128) {Display_Y1 = 128;}
+	if (Display_X0 >= Display_X1 || Display_Y0 >= Display_Y1) {Started = 0;}
+	
+	if (Display_Full)
+	{
+		EPD_UpdateStart();
+	}
+	else if (Started)
+	{
+		Started = EPD_UpdateAreaStart(Display_X0, Display_Y0, Display_X1 - Display_X0, Display_Y1 - Display_Y0);
+	}
+	Display_Pending = 0;
+	Display_Full = 0;
+	if (!Started) {return;}
+	
+	Display_Refreshing = 1;
+	Display_Stats.Refreshes ++;
+	Sched_SetTimer(Display_TaskId, DISPLAY_CHECK_MS, TICK_ONESHOT, DISPLAY_EVENT_CHECK);
+}
+
+/**
+  * 函    数：显示任务
+  * 参    数：Events 收到的事件
+  * 返 回 值：无
+  * 说    明：刷新进行中时，BUSY仍为高则直接返回，等待下一次中断或定时检查
+  *           BUSY变低后结束本次刷新（EPD_UpdateFinish只剩10ms的延时），再发送期间合并的请求
+  *           复位等操作也会使BUSY出现下降沿，所以每次都重新读BUSY，不只依据事件判断
+  *           暂停发送期间只结束已开始的刷新，请求留到Display_Release后发送
+  */
+static void Display_Task(uint32_t Events)
+{
+	if (Display_Refreshing)
+	{
+		if (EPD_IsBusy())
+		{
+			if (Events & DISPLAY_EVENT_CHECK)
+			{
+				Display_Stats.Checks ++;
+				Sched_SetTimer(Display_TaskId, DISPLAY_CHECK_MS, TICK_ONESHOT, DISPLAY_EVENT_CHECK);
+			}
+			return;
+		}
+		Sched_StopTimer(Display_TaskId);
+		EPD_UpdateFinish();
+		Display_Refreshing = 0;
+	}
+	
+	if (Display_Pending && !Display_Held) {Display_Start();}
+}
+
+/*********************工具函数*/
+
+
+/*功能函数*********************/
+
+/**
+  * 函    数：异步刷新初始化
+  * 参    数：Priority 显示任务的优先级，范围：0~SCHED_PRIORITIES-1
+  * 返 回 值：显示任务的编号，任务已满时返回SCHED_INVALID
+  * 说    明：需在Sched_Init与EPD_Init（或EPD_Resume）之后调用
+  *           PA5的下降沿经EXTI第5线产生中断，EXTI第5线可从STOP模式唤醒
+  */
+uint8_t Display_Init(uint8_t Priority)
+{
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_AFIO, ENABLE);
+	GPIO_EXTILineConfig(GPIO_PortSourceGPIOA, GPIO_PinSource5);
+	
+	EXTI_InitTypeDef EXTI_InitStructure;
+	EXTI_InitStructure.EXTI_Line = EXTI_Line5;
+	EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+	EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Falling;
+	EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+	EXTI_Init(&EXTI_InitStructure);
+	EXTI_ClearITPendingBit(EXTI_Line5);
+	
+	NVIC_InitTypeDef NVIC_InitStructure;
+	NVIC_InitStructure.NVIC_IRQChannel = EXTI9_5_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+	
+	Display_TaskId = Sched_Add("Display", Display_Task, Priority);
+	return Display_TaskId;
+}
+
+/**
+  * 函    数：请求刷新EPD的指定区域
+  * 参    数：X 区域左上角的横坐标，范围：0~247
+  * 参    数：Y 区域左上角的纵坐标，范围：0~127
+  * 参    数：Width 区域宽度，范围：0~248
+  * 参    数：Height 区域高度，范围：0~128
+  * 返 回 值：无
+  * 说    明：代替EPD_UpdateArea，显存应已写好，立即返回，只能在主循环中调用
+  *           与之前未发送的请求合并为包含两者的矩形，由显示任务在EPD空闲时发送
+  *           发送之前仍可继续修改显存，发送的是当时显存中的内容
+  */
+void Display_Request(int16_t X, int16_t Y, uint8_t Width, uint8_t Height)
+{
+	Display_Stats.Requests ++;
+	
+	if (!Display_Pending)
+	{
+		Display_Pending = 1;
+		Display_X0 = X;
+		Display_Y0 = Y;
+		Display_X1 = X + Width;
+		Display_Y1 = Y + Height;
+	}
+	else
+	{
+		if (X < Display_X0) {Display_X0 = X;}
+		if (Y < Display_Y0) {Display_Y0 = Y;}
+		if (X + Width > Display_X1) {Display_X1 = X + Width;}
+		if (Y + Height > Display_Y1) {Display_Y1 = Y + Height;}
+	}
+	
+	Sched_Post(Display_TaskId, DISPLAY_EVENT_REQUEST);
+}
+
+/**
+  * 函    数：请求全屏刷新EPD
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：代替EPD_Update，与之前未发送的请求合并为一次全屏刷新
+  */
+void Display_RequestFull(void)
+{
+	Display_Full = 1;
+	Display_Request(0, 0, 248, 128);
+}
+
+/**
+  * 函    数：暂停发送
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：其他模块要临时改变EPD的引脚时调用，之后不再发送新的刷新，直到调用Display_Release
+  *           已开始的刷新不受影响，刷新期间控制器只驱动BUSY，不读取其他引脚
+  */
+void Display_Hold(void)
+{
+	Display_Held = 1;
+}
+
+/**
+  * 函    数：恢复发送
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：EPD的引脚恢复后调用，暂停期间的请求由显示任务发送
+  */
+void Display_Release(void)
+{
+	Display_Held = 0;
+	if (Display_Pending) {Sched_Post(Display_TaskId, DISPLAY_EVENT_REQUEST);}
+}
+
+/**
+  * 函    数：获取是否空闲
+  * 参    数：无
+  * 返 回 值：1：没有正在进行的刷新，也没有待发送的请求，0：忙
+  */
+uint8_t Display_IsIdle(void)
+{
+	return !Display_Refreshing && !Display_Pending;
+}
+
+/**
+  * 函    数：获取统计
+  * 参    数：无
+  * 返 回 值：统计数据，从初始化开始累计
+  */
+const Display_Stats_t *Display_GetStats(void)
+{
+	return &Display_Stats;
+}
+
+/*********************功能函数*/
+
+
+/*中断函数*********************/
+
+/**
+  * 函    数：BUSY下降沿中断处理
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：在EXTI9_5_IRQHandler中EXTI第5线挂起时调用，只通知显示任务
+  */
+void Display_BusyHandler(void)
+{
+	EXTI_ClearITPendingBit(EXTI_Line5);
+	Sched_Post(Display_TaskId, DISPLAY_EVENT_BUSY);
+}
+
+/*********************中断函数*/
@@ -0,0 +1,49 @@
+#ifndef __DISPLAY_H
+#define __DISPLAY_H
+
+#include <stdint.h>
+
+/**
+  * EPD异步刷新
+  * 任务中只提交刷新请求，由显示任务发送数据并发出刷新命令后立即返回调度器，不在任务中等待约2秒的刷新
+  * BUSY（PA5）变低时经EXTI第5线中断通知显示任务结束本次刷新，刷新期间调度器空闲，MCU可进入STOP模式
+  * 刷新期间收到的请求合并为包含全部区域的矩形，本次刷新结束后一次发送
+  * 另有一个单次定时器在刷新超过DISPLAY_CHECK_MS时检查BUSY，防止漏掉下降沿后一直等待
+  * 其他模块临时占用EPD的引脚时（如Ambient采样时PA0为模拟输入）用Display_Hold/Display_Release暂停发送
+  */
+
+/*参数宏定义*********************/
+
+/*刷新开始后经过此时间（单位ms）仍未收到BUSY变低的中断时，主动检查一次BUSY，应大于屏幕的刷新时间*/
+#define DISPLAY_CHECK_MS			4000
+
+/*********************参数宏定义*/
+
+
+/*统计描述*********************/
+
+typedef struct
+{
+	uint32_t Requests;			//收到的刷新请求数
+	uint32_t Refreshes;			//实际开始的刷新次数，与请求数之差即被合并的请求数
+	uint32_t Checks;			//定时检查时BUSY仍为高的次数，正常时为0
+} Display_Stats_t;
+
+/*********************统计描述*/
+
+
+/*函数声明*********************/
+
+uint8_t Display_Init(uint8_t Priority);
+void Display_Request(int16_t X, int16_t Y, uint8_t Width, uint8_t Height);
+void Display_RequestFull(void);
+void Display_Hold(void);
+void Display_Release(void);
+uint8_t Display_IsIdle(void);
+const Display_Stats_t *Display_GetStats(void);
+
+void Display_BusyHandler(void);
+
+/*********************函数声明*/
+
+#endif
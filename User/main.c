@@ -1,22 +1,216 @@
 #include "stm32f10x.h"                  // Device header
 #include "EPD.h"
 #include "Delay.h"
+#include "Digits.h"
+#include "Sched.h"
+#include "Power.h"
+#include "Cycle.h"
+#include "Bench.h"
+#include "key.h"
+#include "Ambient.h"
+#include "Beep.h"
+#include "Serial.h"
+#include "Display.h"
+
+/*两次计数之间的休眠方式，1：待机（STANDBY），唤醒即复位，0：STOP，由调度器管理*/
+#define COUNTER_HIBERNATE		0
+
+/*从待机唤醒后是否经串口输出唤醒耗时，1：输出，仅用于测量，0：不输出*/
+/*输出时占用USART1的引脚，且阻塞发送的时间会计入下一次唤醒前的运行时间，正常使用时保持为0*/
+#define COUNTER_RESUME_REPORT	0
+
+/*是否按环境光推迟刷新，1：刷新交给Ambient策略，暗时推迟并合并，0：直接刷新*/
+/*默认的光敏传感器引脚PA0同时是EPD的SCL，原板上读到的是时钟线的电平，只有把传感器接到其他ADC引脚*/
+/*（修改Light_Senor.h的LIGHTSENOR_PIN与LIGHTSENOR_CHANNEL）后才能打开*/
+#define COUNTER_AMBIENT			0
+
+/*计数周期，单位ms*/
+#define COUNTER_PERIOD			2000
+
+/*计数任务的事件*/
+#define COUNTER_EVENT_TICK		0x01
+
+/*输入任务的事件*/
+#define INPUT_EVENT_KEY			0x01
+
+/*待机时保存在备份寄存器中的应用状态*/
+typedef struct
+{
+	uint16_t Time;				//计数值
+	uint32_t ResumeCycles;		//上次从待机唤醒后，main开始到局部更新完成（含等待BUSY）的内核周期数，打开COUNTER_RESUME_REPORT时经串口输出
+								//不含唤醒事件到main之间的时间：调压器启动（数据手册典型值约50us）、
+								//启动文件中SystemInit等待HSE与PLL（约1~2ms）和C运行库初始化，
+								//这段时间DWT尚未启动，需在示波器上用唤醒信号与EPD的CS引脚测量
+} App_State_t;
 
 uint8_t In[]={0x00};
+
+static App_State_t State;
+static Digits_t Counter;
+
+/**
+  * 函    数：在显存中画出固定内容
+  * 参    数：无
+  * 返 回 值：无
+  * 说    明：开机画面与计数控件，只写显存，不发送
+  *           从待机唤醒后显存为0，也需要重画，否则之后的全屏刷新会擦掉屏幕上的开机画面
+  */
+static void App_DrawStatic(void)
+{
+	EPD_ShowString(0,0,"LZ1104",EPD_8X16);
+	Digits_Init(&Counter,&EPD_Canvas,0,32,5,&Font_Prop16);
+}
+
+/**
+  * 函    数：刷新EPD的指定区域
+  * 参    数：Rect 区域
+  * 返 回 值：无
+  * 说    明：打开COUNTER_AMBIENT时交给环境光策略，否则交给显示任务异步刷新，都立即返回
+  */
+static void App_Refresh(const TextRect_t *Rect)
+{
+#if COUNTER_AMBIENT
+	Ambient_Request(Rect->X,Rect->Y,Rect->Width,Rect->Height);
+#else
+	Display_Request(Rect->X,Rect->Y,Rect->Width,Rect->Height);
+#endif
+}
+
+/**
+  * 函    数：全屏刷新EPD
+  * 参    数：无
+  * 返 回 值：无
+  */
+static void App_RefreshFull(void)
+{
+#if COUNTER_AMBIENT
+	Ambient_RequestFull();
+#else
+	Display_RequestFull();
+#endif
+}
+
+/**
+  * 函    数：计数任务
+  * 参    数：Events 收到的事件
+  * 返 回 值：无
+  * 说    明：每2秒由定时器触发一次，计数加1，只重画变化的数字，只发送变化的区域
+  *           只提交刷新请求，不等待约2秒的刷新，刷新期间调度器空闲，MCU进入STOP模式
+  */
+static void Counter_Task(uint32_t Events)
+{
+	TextRect_t Dirty;
+	
+	if(Events & COUNTER_EVENT_TICK)
+	{
+		State.Time++;
+		if(Digits_ShowNum(&Counter,State.Time,&Dirty))
+		{
+			App_Refresh(&Dirty);
+		}
+	}
+}
+
+/**
+  * 函    数：输入任务
+  * 参    数：Events 收到的事件
+  * 返 回 值：无
+  * 说    明：有按键事件入队时运行，取完队列中的全部事件
+  *           KEY_0按下时计数清零，长按KEY_0时全屏刷新一次，消除局部刷新积累的残影
+  *           打开COUNTER_AMBIENT时，有按键操作说明有人在看，暗时推迟的刷新也立即执行
+  *           每次按下播放按键音，长按播放提示音，都在后台播放，不阻塞
+  */
+static void Input_Task(uint32_t Events)
+{
+	Key_Event_t Event;
+	TextRect_t Dirty;
+	
+	while(Key_Read(&Event))
+	{
+		if(Event.Type==KEY_EVENT_PRESS){Beep_Play(Beep_Click,BEEP_APPEND);}
+		else if(Event.Type==KEY_EVENT_LONG){Beep_Play(Beep_Alert,BEEP_PREEMPT);}
+		
+		if(Event.Key!=KEY_0){continue;}
+		if(Event.Type==KEY_EVENT_PRESS)
+		{
+			State.Time=0;
+			if(Digits_ShowNum(&Counter,State.Time,&Dirty))
+			{
+				App_Refresh(&Dirty);
+			}
+		}
+		else if(Event.Type==KEY_EVENT_LONG)
+		{
+			App_RefreshFull();
+		}
+	}
+#if COUNTER_AMBIENT
+	Ambient_Flush();
+#endif
+}
+
 int main(void)
 {
-	EPD_Init();
+	/*中断优先级分组：2位抢占优先级（0~3）、2位响应优先级，各模块的NVIC_Init都按此分组*/
+	/*不设置时为复位值，NVIC_Init的抢占优先级全部变为0，各模块设置的优先级不起作用*/
+	NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
 	
-	EPD_Clear();
-	uint16_t Time=0;
-	EPD_ShowString(0,0,"LZ1104",EPD_8X16);
-	EPD_Update();
+#ifdef BENCH
+	/*Bench目标只运行性能测试*/
+	Bench_Run();
+	while(1);
+#endif
 
-	while(1)
+	uint8_t CounterTask,InputTask;
+	TextRect_t Dirty;
+	
+	Cycle_Init();
+	
+	if(Power_Resume(&State,sizeof(State)))
 	{
-		EPD_ShowNum(0,32,Time,5,EPD_8X16);
-		Time++;
-		Delay_ms(2000);
+		/*从待机唤醒：屏幕上的图像还在，不初始化EPD、不清屏，开机画面只重画到显存，只发送计数*/
+		EPD_Resume();
+		App_DrawStatic();
+		State.Time++;
+		Digits_ShowNum(&Counter,State.Time,&Dirty);
+		EPD_UpdateArea(Dirty.X,Dirty.Y,Dirty.Width,Dirty.Height);
+		State.ResumeCycles=Cycle_Get();
+		
+#if COUNTER_RESUME_REPORT
+		Serial_Init();
+		Serial_Printf("resume %u cycles, %u us from main to updated pixels\r\n",
+					  State.ResumeCycles,Cycle_ToUs(State.ResumeCycles));
+#endif
+	}
+	else
+	{
+		EPD_Init();
+		
+		EPD_Clear();
+		App_DrawStatic();
+		Digits_ShowNum(&Counter,State.Time,&Dirty);
 		EPD_Update();
 	}
+
+#if COUNTER_HIBERNATE
+	/*保存计数值后待机，RTC闹钟到时复位重新进入main*/
+	Power_Init();
+	Power_Hibernate(&State,sizeof(State),COUNTER_PERIOD);
+#endif
+
+	/*主循环交给调度器，空闲时（包括EPD刷新期间）进入STOP模式，由RTC闹钟或BUSY变低唤醒*/
+	Sched_Init();
+	Power_Init();
+	Sched_SetIdle(Power_Idle);
+	Display_Init(0);
+	CounterTask=Sched_Add("Counter",Counter_Task,1);
+	Sched_SetTimer(CounterTask,COUNTER_PERIOD,TICK_PERIODIC,COUNTER_EVENT_TICK);
+	InputTask=Sched_Add("Input",Input_Task,0);
+	Beep_Init();
+	Key_Init();
+	Key_SetTask(InputTask,INPUT_EVENT_KEY);
+#if COUNTER_AMBIENT
+	Ambient_Init(0,2);
+#endif
+	Sched_Run();
 }
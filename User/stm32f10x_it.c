@@ -23,6 +23,12 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f10x_it.h"
+#include "Tick.h"
+#include "Power.h"
+#include "key.h"
+#include "Light_Senor.h"
+#include "Beep.h"
+#include "Display.h"
 
 /** @addtogroup STM32F10x_StdPeriph_Template
   * @{
@@ -134,6 +140,9 @@ void PendSV_Handler(void)
   */
 void SysTick_Handler(void)
 {
+  Tick_Handler();
+  Key_Tick();
+  Beep_Tick();
 }
 
 /******************************************************************************/
@@ -152,6 +161,54 @@ void SysTick_Handler(void)
 {
 }*/
 
+/**
+  * @brief  This function handles RTC Alarm interrupt request.
+  * @param  None
+  * @retval None
+  */
+void RTCAlarm_IRQHandler(void)
+{
+  Power_AlarmHandler();
+}
+
+/**
+  * @brief  This function handles External interrupt Line 2 request (PD2 key).
+  * @param  None
+  * @retval None
+  */
+void EXTI2_IRQHandler(void)
+{
+  Key_ExtiHandler();
+}
+
+/**
+  * @brief  This function handles External lines 9 to 5 interrupt request (PA5 EPD BUSY, PC8, PC9 keys).
+  *         Line 5 is served first; a key line still pending re-enters the handler.
+  * @param  None
+  * @retval None
+  */
+void EXTI9_5_IRQHandler(void)
+{
+  if (EXTI_GetITStatus(EXTI_Line5) != RESET)
+  {
+    Display_BusyHandler();
+  }
+  else
+  {
+    Key_ExtiHandler();
+  }
+}
+
+/**
+  * @brief  This function handles DMA1 Channel 1 interrupt request (light sensor ADC).
+  * @param  None
+  * @retval None
+  */
+void DMA1_Channel1_IRQHandler(void)
+{
+  LightSenor_DmaHandler();
+}
+
 /**
   * @}
   */ 